@@ -0,0 +1,601 @@
+// ------------------------- OpenPose Benchmarks - CPU Post-Processing -------------------------
+// Deterministic benchmarks of the CPU hot paths (input conversion, heat map resizing, NMS, body part connection,
+// face/hand maximum, keypoint rendering, LK tracking and 3-D triangulation). They run over synthetic heat maps (and
+// optionally over recorded ones) at several resolutions and numbers of people, and print 1 JSON line per benchmark
+// with its speed and memory allocations. If a baseline (a previous output) is given, it returns 1 when any
+// benchmark got slower than the allowed tolerance, so it can be used to catch regressions before deployment.
+
+// Third-party dependencies
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib> // std::malloc, std::free
+#include <fstream>
+#include <iostream> // std::cout
+#include <limits> // std::numeric_limits
+#include <map>
+#include <new> // std::bad_alloc
+#include <random>
+#include <opencv2/opencv.hpp>
+// Command-line user interface
+#define OPENPOSE_FLAGS_DISABLE_POSE
+#include <openpose/flags.hpp>
+// OpenPose dependencies
+#include <openpose/headers.hpp>
+#include <openpose_private/3d/poseTriangulationPrivate.hpp>
+#include <openpose_private/tracking/pyramidalLK.hpp>
+
+DEFINE_string(benchmark_filter,         "",             "Only run the benchmarks whose name contains this string (e.g., `Cpu`). Empty to run"
+                                                        " all of them.");
+DEFINE_int32(benchmark_iterations,      20,             "Number of timed iterations of each benchmark (after 2 non-timed warm-up iterations).");
+DEFINE_string(benchmark_resolutions,    "656x368,1312x736", "Comma-separated list of network input resolutions. The network output (heat maps)"
+                                                        " is 8 times smaller.");
+DEFINE_string(benchmark_people,         "1,4,16",       "Comma-separated list of number of people of the synthetic heat maps.");
+DEFINE_string(recorded_heat_maps,       "",             "Optional BODY_25 heat maps recorded with `--heatmaps_add_parts --heatmaps_add_bkg"
+                                                        " --heatmaps_add_PAFs --heatmaps_scale 2 --write_heatmaps_format float` (i.e., the"
+                                                        " format of `saveFloatArray()`). NMS and body part connection are also benchmarked"
+                                                        " on them.");
+DEFINE_string(benchmark_output,         "",             "Also write the JSON lines into this file.");
+DEFINE_string(benchmark_baseline,       "",             "Previous `--benchmark_output` file. If set, any benchmark whose mean time is higher"
+                                                        " than its baseline one by more than `--benchmark_tolerance` is reported, and the"
+                                                        " program returns 1.");
+DEFINE_double(benchmark_tolerance,      0.2,            "Maximum allowed relative slowdown with respect to `--benchmark_baseline`.");
+
+// Memory allocations (any operator new of the process, including the OpenPose library ones)
+std::atomic<unsigned long long> sNumberAllocations{0ull};
+
+void* operator new(std::size_t size)
+{
+    sNumberAllocations.fetch_add(1ull, std::memory_order_relaxed);
+    void* const ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        throw std::bad_alloc{};
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+const auto POSE_MODEL = op::PoseModel::BODY_25;
+// Deterministic (and platform independent, unlike std distributions) pseudo-random numbers
+std::mt19937 sRandomGenerator;
+
+float getRandom(const float minimum, const float maximum)
+{
+    return minimum + (maximum - minimum) * float(sRandomGenerator() / double(sRandomGenerator.max()));
+}
+
+std::vector<int> splitIntegers(const std::string& string)
+{
+    std::vector<int> integers;
+    for (const auto& token : op::splitString(string, ","))
+        integers.emplace_back(std::stoi(token));
+    return integers;
+}
+
+struct SyntheticPeople
+{
+    op::Point<int> netSize;
+    op::Point<int> heatMapSize;
+    // (1 x #channels x heatMapSize.y x heatMapSize.x), i.e., network output
+    op::Array<float> netOutput;
+    // (#people x #body parts x 3), in network input coordinates
+    op::Array<float> poseKeypoints;
+};
+
+// Body parts placed by walking the BODY_25 tree from the neck, Gaussian peaks and unit-vector PAFs
+SyntheticPeople createSyntheticPeople(const op::Point<int>& netSize, const int numberPeople)
+{
+    try
+    {
+        SyntheticPeople syntheticPeople;
+        syntheticPeople.netSize = netSize;
+        syntheticPeople.heatMapSize = op::Point<int>{netSize.x / 8, netSize.y / 8};
+        const auto numberBodyParts = (int)op::getPoseNumberBodyParts(POSE_MODEL);
+        const auto& bodyPartPairs = op::getPosePartPairs(POSE_MODEL);
+        const auto& mapIdx = op::getPoseMapIndex(POSE_MODEL);
+        const auto numberBodyPartPairs = (int)bodyPartPairs.size() / 2;
+        const auto numberBodyPartsAndBkg = numberBodyParts + 1;
+        const auto width = syntheticPeople.heatMapSize.x;
+        const auto height = syntheticPeople.heatMapSize.y;
+        const auto channelOffset = width * height;
+        // Keypoints
+        sRandomGenerator.seed(numberPeople * 1000003u + netSize.x);
+        syntheticPeople.poseKeypoints.reset({numberPeople, numberBodyParts, 3}, 0.f);
+        const auto personSize = netSize.y / (1.5f + std::sqrt((float)numberPeople));
+        for (auto person = 0 ; person < numberPeople ; person++)
+        {
+            auto* const keypointsPtr = syntheticPeople.poseKeypoints.getPtr() + person * numberBodyParts * 3;
+            keypointsPtr[3*bodyPartPairs[0]] = getRandom(0.5f * personSize, netSize.x - 0.5f * personSize);
+            keypointsPtr[3*bodyPartPairs[0]+1] = getRandom(0.5f * personSize, netSize.y - 0.5f * personSize);
+            keypointsPtr[3*bodyPartPairs[0]+2] = 1.f;
+            for (auto pass = 0 ; pass < numberBodyParts ; pass++)
+            {
+                for (auto pair = 0 ; pair < numberBodyPartPairs ; pair++)
+                {
+                    auto* const partA = keypointsPtr + 3*bodyPartPairs[2*pair];
+                    auto* const partB = keypointsPtr + 3*bodyPartPairs[2*pair+1];
+                    if (partA[2] > 0.f && partB[2] == 0.f)
+                    {
+                        const auto angle = getRandom(0.f, 6.2832f);
+                        const auto length = getRandom(0.1f, 0.2f) * personSize;
+                        partB[0] = std::min(std::max(partA[0] + length * std::cos(angle), 0.f), netSize.x - 1.f);
+                        partB[1] = std::min(std::max(partA[1] + length * std::sin(angle), 0.f), netSize.y - 1.f);
+                        partB[2] = getRandom(0.6f, 1.f);
+                    }
+                }
+            }
+        }
+        // Heat maps (network output resolution)
+        syntheticPeople.netOutput.reset(
+            {1, numberBodyPartsAndBkg + 2*numberBodyPartPairs, height, width}, 0.f);
+        auto* const netOutputPtr = syntheticPeople.netOutput.getPtr();
+        const auto sigma = 1.f;
+        for (auto person = 0 ; person < numberPeople ; person++)
+        {
+            const auto* const keypointsPtr = syntheticPeople.poseKeypoints.getConstPtr() + person*numberBodyParts*3;
+            // Body parts
+            for (auto part = 0 ; part < numberBodyParts ; part++)
+            {
+                const auto xPart = keypointsPtr[3*part] / 8.f;
+                const auto yPart = keypointsPtr[3*part+1] / 8.f;
+                auto* const channelPtr = netOutputPtr + part * channelOffset;
+                for (auto y = std::max(0, int(yPart - 3*sigma)) ; y < std::min(height, int(yPart + 3*sigma) + 1) ; y++)
+                    for (auto x = std::max(0, int(xPart - 3*sigma)) ; x < std::min(width, int(xPart + 3*sigma) + 1) ; x++)
+                        channelPtr[y*width + x] = std::max(channelPtr[y*width + x], keypointsPtr[3*part+2]
+                            * std::exp(-((x-xPart)*(x-xPart) + (y-yPart)*(y-yPart)) / (2*sigma*sigma)));
+            }
+            // PAFs
+            for (auto pair = 0 ; pair < numberBodyPartPairs ; pair++)
+            {
+                const auto* const partA = keypointsPtr + 3*bodyPartPairs[2*pair];
+                const auto* const partB = keypointsPtr + 3*bodyPartPairs[2*pair+1];
+                const auto vectorX = (partB[0] - partA[0]) / 8.f;
+                const auto vectorY = (partB[1] - partA[1]) / 8.f;
+                const auto length = std::sqrt(vectorX*vectorX + vectorY*vectorY);
+                if (length < 1e-3f)
+                    continue;
+                auto* const pafXPtr = netOutputPtr + (numberBodyPartsAndBkg + mapIdx[2*pair]) * channelOffset;
+                auto* const pafYPtr = netOutputPtr + (numberBodyPartsAndBkg + mapIdx[2*pair+1]) * channelOffset;
+                const auto xMin = std::max(0, int(std::min(partA[0], partB[0]) / 8.f - 1.f));
+                const auto xMax = std::min(width - 1, int(std::max(partA[0], partB[0]) / 8.f + 1.f));
+                const auto yMin = std::max(0, int(std::min(partA[1], partB[1]) / 8.f - 1.f));
+                const auto yMax = std::min(height - 1, int(std::max(partA[1], partB[1]) / 8.f + 1.f));
+                for (auto y = yMin ; y <= yMax ; y++)
+                {
+                    for (auto x = xMin ; x <= xMax ; x++)
+                    {
+                        const auto projection = ((x - partA[0]/8.f) * vectorX + (y - partA[1]/8.f) * vectorY) / length;
+                        const auto distance = std::abs(
+                            (x - partA[0]/8.f) * vectorY - (y - partA[1]/8.f) * vectorX) / length;
+                        if (projection >= 0.f && projection <= length && distance <= 1.f)
+                        {
+                            pafXPtr[y*width + x] = vectorX / length;
+                            pafYPtr[y*width + x] = vectorY / length;
+                        }
+                    }
+                }
+            }
+        }
+        // Background
+        auto* const backgroundPtr = netOutputPtr + numberBodyParts * channelOffset;
+        for (auto index = 0 ; index < channelOffset ; index++)
+        {
+            auto maximum = 0.f;
+            for (auto part = 0 ; part < numberBodyParts ; part++)
+                maximum = std::max(maximum, netOutputPtr[part * channelOffset + index]);
+            backgroundPtr[index] = 1.f - maximum;
+        }
+        return syntheticPeople;
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        return SyntheticPeople();
+    }
+}
+
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner(const int iterations, const std::string& filter, const std::string& outputPath) :
+        mIterations{iterations},
+        mFilter{filter}
+    {
+        if (!outputPath.empty())
+        {
+            mOutputFile.open(outputPath);
+            if (!mOutputFile.is_open())
+                op::error("Output file could not be opened: " + outputPath + ".", __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    // Times function (plus 2 warm-up iterations) and prints its JSON line
+    template<typename TFunction>
+    void run(
+        const std::string& name, const std::string& input, const std::string& resolution, const std::string& people,
+        const TFunction& function)
+    {
+        try
+        {
+            if (!mFilter.empty() && name.find(mFilter) == std::string::npos)
+                return;
+            for (auto warmUp = 0 ; warmUp < 2 ; warmUp++)
+                function();
+            op::ArrayAllocator::resetStatistics();
+            const auto statisticsBegin = op::ArrayAllocator::getStatistics();
+            const auto numberAllocationsBegin = sNumberAllocations.load();
+            auto totalMs = 0.;
+            auto minimumMs = std::numeric_limits<double>::max();
+            for (auto iteration = 0 ; iteration < mIterations ; iteration++)
+            {
+                const auto timerBegin = std::chrono::high_resolution_clock::now();
+                function();
+                const auto timerEnd = std::chrono::high_resolution_clock::now();
+                const auto iterationMs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    timerEnd - timerBegin).count() * 1e-6;
+                totalMs += iterationMs;
+                minimumMs = std::min(minimumMs, iterationMs);
+            }
+            const auto numberAllocations = sNumberAllocations.load() - numberAllocationsBegin;
+            const auto statisticsEnd = op::ArrayAllocator::getStatistics();
+            const auto meanMs = totalMs / mIterations;
+            // JSON line
+            std::stringstream jsonLine;
+            jsonLine << "{\"benchmark\": \"" << name << "\", \"input\": \"" << input
+                     << "\", \"resolution\": \"" << resolution << "\", \"people\": \"" << people
+                     << "\", \"iterations\": " << mIterations << ", \"mean_ms\": " << meanMs
+                     << ", \"min_ms\": " << minimumMs << ", \"throughput_hz\": " << 1e3 / meanMs
+                     << ", \"allocations_per_iteration\": " << double(numberAllocations) / mIterations
+                     << ", \"array_allocations_per_iteration\": "
+                     << double(statisticsEnd.misses - statisticsBegin.misses) / mIterations
+                     << ", \"array_pool_hits_per_iteration\": "
+                     << double(statisticsEnd.hits - statisticsBegin.hits) / mIterations
+                     << ", \"array_peak_bytes\": " << statisticsEnd.peakBytes << "}";
+            std::cout << jsonLine.str() << std::endl;
+            if (mOutputFile.is_open())
+                mOutputFile << jsonLine.str() << std::endl;
+            mMeanMs[name + "|" + input + "|" + resolution + "|" + people] = meanMs;
+        }
+        catch (const std::exception& e)
+        {
+            op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    // Returns the number of benchmarks slower than their baseline by more than tolerance
+    int compareToBaseline(const std::string& baselinePath, const double tolerance) const
+    {
+        try
+        {
+            std::ifstream baselineFile{baselinePath};
+            if (!baselineFile.is_open())
+                op::error("Baseline file could not be opened: " + baselinePath + ".", __LINE__, __FUNCTION__, __FILE__);
+            // Only parses the JSON lines written by run()
+            const auto getField = [](const std::string& line, const std::string& field) -> std::string
+            {
+                const auto key = "\"" + field + "\": ";
+                auto begin = line.find(key);
+                if (begin == std::string::npos)
+                    return "";
+                begin += key.size();
+                if (line[begin] == '"')
+                    return line.substr(begin + 1, line.find('"', begin + 1) - begin - 1);
+                return line.substr(begin, line.find_first_of(",}", begin) - begin);
+            };
+            auto numberRegressions = 0;
+            std::string line;
+            while (std::getline(baselineFile, line))
+            {
+                const auto key = getField(line, "benchmark") + "|" + getField(line, "input") + "|"
+                               + getField(line, "resolution") + "|" + getField(line, "people");
+                const auto meanMsIterator = mMeanMs.find(key);
+                const auto baselineMsString = getField(line, "mean_ms");
+                if (meanMsIterator == mMeanMs.end() || baselineMsString.empty())
+                    continue;
+                const auto baselineMs = std::stod(baselineMsString);
+                if (meanMsIterator->second > baselineMs * (1. + tolerance))
+                {
+                    op::opLog("Regression in " + key + ": " + std::to_string(meanMsIterator->second) + " ms vs. "
+                              + std::to_string(baselineMs) + " ms (baseline).", op::Priority::High);
+                    numberRegressions++;
+                }
+            }
+            return numberRegressions;
+        }
+        catch (const std::exception& e)
+        {
+            op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return -1;
+        }
+    }
+
+private:
+    const int mIterations;
+    const std::string mFilter;
+    std::ofstream mOutputFile;
+    std::map<std::string, double> mMeanMs;
+};
+
+// NMS and body part connection over (already upsampled) heat maps
+void benchmarkPeaksAndConnection(
+    BenchmarkRunner& benchmarkRunner, const op::Array<float>& heatMaps, const std::string& input,
+    const std::string& people)
+{
+    try
+    {
+        const auto numberBodyParts = (int)op::getPoseNumberBodyParts(POSE_MODEL);
+        const auto maxPeaks = (int)op::getPoseMaxPeaks();
+        const auto height = heatMaps.getSize(2);
+        const auto width = heatMaps.getSize(3);
+        const auto resolution = std::to_string(width) + "x" + std::to_string(height);
+        const auto nmsThreshold = op::getPoseDefaultNmsThreshold(POSE_MODEL);
+        // nmsCpu
+        const std::array<int, 4> peaksSize{1, numberBodyParts, maxPeaks+1, 3};
+        op::Array<float> peaks{{1, numberBodyParts, maxPeaks+1, 3}};
+        std::vector<int> kernel(numberBodyParts * height * width);
+        const auto runNms = [&]()
+        {
+            op::nmsCpu(peaks.getPtr(), kernel.data(), heatMaps.getConstPtr(), nmsThreshold, peaksSize,
+                       std::array<int, 4>{1, numberBodyParts, height, width}, op::Point<float>{0.5f, 0.5f});
+        };
+        benchmarkRunner.run("nmsCpu", input, resolution, people, runNms);
+        runNms();
+        // connectBodyPartsCpu
+        op::Array<float> poseKeypoints;
+        op::Array<float> poseScores;
+        benchmarkRunner.run("connectBodyPartsCpu", input, resolution, people, [&]()
+        {
+            op::connectBodyPartsCpu(
+                poseKeypoints, poseScores, heatMaps.getConstPtr(), peaks.getConstPtr(), POSE_MODEL,
+                op::Point<int>{width, height}, maxPeaks, op::getPoseDefaultConnectInterMinAboveThreshold(),
+                op::getPoseDefaultConnectInterThreshold(POSE_MODEL), (int)op::getPoseDefaultMinSubsetCnt(),
+                op::getPoseDefaultConnectMinSubsetScore(), nmsThreshold);
+        });
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+    }
+}
+
+void benchmarkSynthetic(BenchmarkRunner& benchmarkRunner, const op::Point<int>& netSize, const int numberPeople)
+{
+    try
+    {
+        const auto syntheticPeople = createSyntheticPeople(netSize, numberPeople);
+        const std::string input{"synthetic"};
+        const auto resolution = std::to_string(netSize.x) + "x" + std::to_string(netSize.y);
+        const auto people = std::to_string(numberPeople);
+
+        // uCharCvMatToFloatPtr
+        cv::Mat frame(netSize.y, netSize.x, CV_8UC3);
+        cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(255));
+        std::vector<float> netInput(3 * netSize.x * netSize.y);
+        benchmarkRunner.run("uCharCvMatToFloatPtr", input, resolution, people, [&]()
+        {
+            op::uCharCvMatToFloatPtr(netInput.data(), OP_CV2OPCONSTMAT(frame), 1);
+        });
+
+        // resizeAndMergeCpu (network output to network input resolution)
+        const auto numberChannels = syntheticPeople.netOutput.getSize(1);
+        op::Array<float> heatMaps{{1, numberChannels, netSize.y, netSize.x}};
+        const std::vector<const float*> sourcePtrs{syntheticPeople.netOutput.getConstPtr()};
+        const std::vector<std::array<int, 4>> sourceSizes{
+            {1, numberChannels, syntheticPeople.heatMapSize.y, syntheticPeople.heatMapSize.x}};
+        const auto runResizeAndMerge = [&]()
+        {
+            op::resizeAndMergeCpu(
+                heatMaps.getPtr(), sourcePtrs, std::array<int, 4>{1, numberChannels, netSize.y, netSize.x},
+                sourceSizes);
+        };
+        benchmarkRunner.run("resizeAndMergeCpu", input, resolution, people, runResizeAndMerge);
+        runResizeAndMerge();
+
+        // nmsCpu & connectBodyPartsCpu
+        benchmarkPeaksAndConnection(benchmarkRunner, heatMaps, input, people);
+
+        // maximumCpu (1 hand crop per person, 368x368 network resolution)
+        const auto handSize = 368;
+        const auto handParts = 21;
+        op::Array<float> handHeatMaps{{1, handParts+1, handSize, handSize}, 0.f};
+        for (auto part = 0 ; part < handParts ; part++)
+            handHeatMaps.getPtr()[(part*handSize + (13*part + 40) % handSize)*handSize + (29*part + 70) % handSize]
+                = 0.8f;
+        op::Array<float> handKeypoints{{1, 1, handParts, 3}};
+        benchmarkRunner.run("maximumCpu", input, std::to_string(handSize) + "x" + std::to_string(handSize), people,
+            [&]()
+            {
+                for (auto person = 0 ; person < numberPeople ; person++)
+                    op::maximumCpu(handKeypoints.getPtr(), handHeatMaps.getConstPtr(),
+                                   std::array<int, 4>{1, 1, handParts, 3},
+                                   std::array<int, 4>{1, handParts+1, handSize, handSize});
+            });
+
+        // renderKeypointsCpu (through renderPoseKeypointsCpu)
+        op::Array<float> frameArray{{netSize.y, netSize.x, 3}, 0.f};
+        benchmarkRunner.run("renderKeypointsCpu", input, resolution, people, [&]()
+        {
+            op::renderPoseKeypointsCpu(frameArray, syntheticPeople.poseKeypoints, POSE_MODEL, 0.05f);
+        });
+
+        // pyramidalLKCpu (all keypoints, smooth textured frame shifted by (2, 1) pixels)
+        cv::Mat imagePrevious(netSize.y, netSize.x, CV_32FC1);
+        cv::randu(imagePrevious, cv::Scalar::all(0), cv::Scalar::all(255));
+        cv::GaussianBlur(imagePrevious, imagePrevious, cv::Size{7, 7}, 0);
+        cv::Mat imageCurrent;
+        const cv::Mat shift = (cv::Mat_<double>(2,3) << 1, 0, 2, 0, 1, 1);
+        cv::warpAffine(imagePrevious, imageCurrent, shift, imagePrevious.size());
+        std::vector<cv::Point2f> pointsPrevious;
+        const auto& poseKeypoints = syntheticPeople.poseKeypoints;
+        for (auto index = 0 ; index < (int)poseKeypoints.getVolume() ; index += 3)
+            pointsPrevious.emplace_back(poseKeypoints[index], poseKeypoints[index+1]);
+        std::vector<cv::Point2f> pointsCurrent;
+        std::vector<cv::Mat> pyramidImagesPrevious;
+        std::vector<cv::Mat> pyramidImagesCurrent;
+        std::vector<char> status(pointsPrevious.size());
+        benchmarkRunner.run("pyramidalLKCpu", input, resolution, people, [&]()
+        {
+            // Pyramids are re-computed on each new frame
+            pyramidImagesPrevious.clear();
+            pyramidImagesCurrent.clear();
+            op::pyramidalLKCpu(pointsPrevious, pointsCurrent, pyramidImagesPrevious, pyramidImagesCurrent, status,
+                               imagePrevious, imageCurrent);
+        });
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+    }
+}
+
+// 3-D triangulation of all the keypoints of numberPeople people seen by 3 synthetic cameras
+void benchmarkTriangulation(BenchmarkRunner& benchmarkRunner, const int numberPeople)
+{
+    try
+    {
+        const auto numberBodyParts = (int)op::getPoseNumberBodyParts(POSE_MODEL);
+        sRandomGenerator.seed(numberPeople);
+        // Cameras (same intrinsics, translated along x and looking to the origin)
+        const cv::Mat intrinsics = (cv::Mat_<double>(3,3) << 1000, 0, 640, 0, 1000, 360, 0, 0, 1);
+        std::vector<cv::Mat> cameraMatrices;
+        for (const auto cameraX : {-1., 0., 1.})
+        {
+            const cv::Mat extrinsics = (cv::Mat_<double>(3,4) << 1, 0, 0, -cameraX, 0, 1, 0, 0, 0, 0, 1, 5);
+            cameraMatrices.emplace_back(intrinsics * extrinsics);
+        }
+        // Projected keypoints
+        std::vector<std::vector<cv::Point2d>> pointsOnEachCamera(numberPeople * numberBodyParts);
+        for (auto& pointOnEachCamera : pointsOnEachCamera)
+        {
+            const cv::Mat point3D = (cv::Mat_<double>(4,1)
+                << getRandom(-2.f, 2.f), getRandom(-1.f, 1.f), getRandom(-1.f, 1.f), 1);
+            for (const auto& cameraMatrix : cameraMatrices)
+            {
+                const cv::Mat projection = cameraMatrix * point3D;
+                pointOnEachCamera.emplace_back(
+                    projection.at<double>(0) / projection.at<double>(2) + getRandom(-0.5f, 0.5f),
+                    projection.at<double>(1) / projection.at<double>(2) + getRandom(-0.5f, 0.5f));
+            }
+        }
+        cv::Mat reconstructedPoint;
+        benchmarkRunner.run("triangulate", "synthetic", "1280x720", std::to_string(numberPeople), [&]()
+        {
+            for (const auto& pointOnEachCamera : pointsOnEachCamera)
+                op::triangulate(reconstructedPoint, cameraMatrices, pointOnEachCamera);
+        });
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+    }
+}
+
+// Heat maps saved with saveFloatArray(): #dimensions, dimensions, and data, all as floats
+op::Array<float> loadRecordedHeatMaps(const std::string& filePath)
+{
+    try
+    {
+        std::ifstream file{filePath, std::ios::binary};
+        if (!file.is_open())
+            op::error("Recorded heat maps could not be opened: " + filePath + ".", __LINE__, __FUNCTION__, __FILE__);
+        float numberDimensions;
+        file.read((char*)&numberDimensions, sizeof(float));
+        std::vector<int> sizes(op::positiveIntRound(numberDimensions));
+        for (auto& size : sizes)
+        {
+            float sizeFloat;
+            file.read((char*)&sizeFloat, sizeof(float));
+            size = op::positiveIntRound(sizeFloat);
+        }
+        // 1 x #channels x height x width
+        if (sizes.size() == 3)
+            sizes.insert(sizes.begin(), 1);
+        const auto numberBodyParts = (int)op::getPoseNumberBodyParts(POSE_MODEL);
+        const auto numberChannels = numberBodyParts + 1 + (int)op::getPosePartPairs(POSE_MODEL).size();
+        if (sizes.size() != 4 || sizes[0] != 1 || sizes[1] != numberChannels)
+            op::error("Recorded heat maps must be BODY_25 body parts, background and PAFs (" + std::to_string(
+                      numberChannels) + " channels).", __LINE__, __FUNCTION__, __FILE__);
+        op::Array<float> heatMaps{sizes};
+        file.read((char*)heatMaps.getPtr(), heatMaps.getVolume() * sizeof(float));
+        if (!file)
+            op::error("Recorded heat maps file is truncated: " + filePath + ".", __LINE__, __FUNCTION__, __FILE__);
+        return heatMaps;
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        return op::Array<float>{};
+    }
+}
+
+int openPoseBenchmarks()
+{
+    try
+    {
+        // logging_level
+        op::checkBool(
+            0 <= FLAGS_logging_level && FLAGS_logging_level <= 255, "Wrong logging_level value.",
+            __LINE__, __FUNCTION__, __FILE__);
+        op::ConfigureLog::setPriorityThreshold((op::Priority)FLAGS_logging_level);
+        op::checkBool(FLAGS_benchmark_iterations > 0, "Wrong benchmark_iterations value.",
+                      __LINE__, __FUNCTION__, __FILE__);
+        // Deterministic OpenCV random numbers
+        cv::theRNG().state = 0x12345678;
+
+        BenchmarkRunner benchmarkRunner{FLAGS_benchmark_iterations, FLAGS_benchmark_filter, FLAGS_benchmark_output};
+        // Synthetic heat maps
+        for (const auto& resolution : op::splitString(FLAGS_benchmark_resolutions, ","))
+        {
+            const auto netSize = op::flagsToPoint(op::String(resolution), "656x368");
+            for (const auto numberPeople : splitIntegers(FLAGS_benchmark_people))
+                benchmarkSynthetic(benchmarkRunner, netSize, numberPeople);
+        }
+        for (const auto numberPeople : splitIntegers(FLAGS_benchmark_people))
+            benchmarkTriangulation(benchmarkRunner, numberPeople);
+        // Recorded heat maps
+        if (!FLAGS_recorded_heat_maps.empty())
+            benchmarkPeaksAndConnection(
+                benchmarkRunner, loadRecordedHeatMaps(FLAGS_recorded_heat_maps), "recorded", "-");
+
+        // Regressions
+        if (!FLAGS_benchmark_baseline.empty())
+        {
+            const auto numberRegressions = benchmarkRunner.compareToBaseline(
+                FLAGS_benchmark_baseline, FLAGS_benchmark_tolerance);
+            if (numberRegressions != 0)
+            {
+                op::opLog(std::to_string(numberRegressions) + " benchmark(s) slower than the baseline.",
+                          op::Priority::High);
+                return 1;
+            }
+        }
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        return -1;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // Parsing command line flags
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    // Running openPoseBenchmarks
+    return openPoseBenchmarks();
+}
@@ -24,6 +24,9 @@ void configureWrapper(op::Wrapper& opWrapper)
             0 <= FLAGS_logging_level && FLAGS_logging_level <= 255, "Wrong logging_level value.",
             __LINE__, __FUNCTION__, __FILE__);
         op::ConfigureLog::setPriorityThreshold((op::Priority)FLAGS_logging_level);
+        // logging_async
+        op::ConfigureLog::setBinaryRecordsPath(FLAGS_logging_records);
+        op::ConfigureLog::setAsynchronous(FLAGS_logging_async);
         op::Profiler::setDefaultX(FLAGS_profile_speed);
 
         // Applying user defined configuration - GFlags to program variables
@@ -32,7 +35,7 @@ void configureWrapper(op::Wrapper& opWrapper)
         op::String producerString;
         std::tie(producerType, producerString) = op::flagsToProducer(
             op::String(FLAGS_image_dir), op::String(FLAGS_video), op::String(FLAGS_ip_camera), FLAGS_camera,
-            FLAGS_flir_camera, FLAGS_flir_camera_index);
+            FLAGS_flir_camera, FLAGS_flir_camera_index, op::String(FLAGS_net_output), op::String(FLAGS_multi_stream));
         // cameraSize
         const auto cameraSize = op::flagsToPoint(op::String(FLAGS_camera_resolution), "-1x-1");
         // outputSize
@@ -59,7 +62,7 @@ void configureWrapper(op::Wrapper& opWrapper)
                                                       FLAGS_heatmaps_add_PAFs);
         const auto heatMapScaleMode = op::flagsToHeatMapScaleMode(FLAGS_heatmaps_scale);
         // >1 camera view?
-        const auto multipleView = (FLAGS_3d || FLAGS_3d_views > 1 || FLAGS_flir_camera);
+        const auto multipleView = (FLAGS_3d || FLAGS_3d_views > 1 || FLAGS_flir_camera || !FLAGS_multi_stream.empty());
         // Face and hand detectors
         const auto faceDetector = op::flagsToDetector(FLAGS_face_detector);
         const auto handDetector = op::flagsToDetector(FLAGS_hand_detector);
@@ -74,29 +77,38 @@ void configureWrapper(op::Wrapper& opWrapper)
             (float)FLAGS_alpha_pose, (float)FLAGS_alpha_heatmap, FLAGS_part_to_show, op::String(FLAGS_model_folder),
             heatMapTypes, heatMapScaleMode, FLAGS_part_candidates, (float)FLAGS_render_threshold,
             FLAGS_number_people_max, FLAGS_maximize_positives, FLAGS_fps_max, op::String(FLAGS_prototxt_path),
-            op::String(FLAGS_caffemodel_path), (float)FLAGS_upsampling_ratio, enableGoogleLogging};
+            op::String(FLAGS_caffemodel_path), (float)FLAGS_upsampling_ratio, enableGoogleLogging,
+            (float)FLAGS_net_resolution_adaptive, FLAGS_temporal_connection,
+            op::flagsToNetResolutionBuckets(op::String(FLAGS_net_resolution_buckets)), FLAGS_opencv_dnn,
+            (op::OpenCvDnnBackend)FLAGS_opencv_dnn_backend, (op::OpenCvDnnTarget)FLAGS_opencv_dnn_target,
+            (op::OpenCvDnnPrecision)FLAGS_opencv_dnn_precision, FLAGS_opencv_dnn_threads,
+            op::String(FLAGS_model_cache_folder), FLAGS_latency_target, (op::LatencyPolicy)FLAGS_latency_policy,
+            FLAGS_stage_fusion};
         opWrapper.configure(wrapperStructPose);
         // Face configuration (use op::WrapperStructFace{} to disable it)
         const op::WrapperStructFace wrapperStructFace{
             FLAGS_face, faceDetector, faceNetInputSize,
             op::flagsToRenderMode(FLAGS_face_render, multipleView, FLAGS_render_pose),
-            (float)FLAGS_face_alpha_pose, (float)FLAGS_face_alpha_heatmap, (float)FLAGS_face_render_threshold};
+            (float)FLAGS_face_alpha_pose, (float)FLAGS_face_alpha_heatmap, (float)FLAGS_face_render_threshold,
+            FLAGS_face_reuse_frames, FLAGS_face_detector_period};
         opWrapper.configure(wrapperStructFace);
         // Hand configuration (use op::WrapperStructHand{} to disable it)
         const op::WrapperStructHand wrapperStructHand{
             FLAGS_hand, handDetector, handNetInputSize, FLAGS_hand_scale_number, (float)FLAGS_hand_scale_range,
             op::flagsToRenderMode(FLAGS_hand_render, multipleView, FLAGS_render_pose), (float)FLAGS_hand_alpha_pose,
-            (float)FLAGS_hand_alpha_heatmap, (float)FLAGS_hand_render_threshold};
+            (float)FLAGS_hand_alpha_heatmap, (float)FLAGS_hand_render_threshold, FLAGS_hand_reuse_frames};
         opWrapper.configure(wrapperStructHand);
         // Extra functionality configuration (use op::WrapperStructExtra{} to disable it)
         const op::WrapperStructExtra wrapperStructExtra{
-            FLAGS_3d, FLAGS_3d_min_views, FLAGS_identification, FLAGS_tracking, FLAGS_ik_threads};
+            FLAGS_3d, FLAGS_3d_min_views, FLAGS_identification, FLAGS_tracking, FLAGS_ik_threads,
+            FLAGS_roi_mosaic};
         opWrapper.configure(wrapperStructExtra);
         // Producer (use default to disable any input)
         const op::WrapperStructInput wrapperStructInput{
             producerType, producerString, FLAGS_frame_first, FLAGS_frame_step, FLAGS_frame_last,
             FLAGS_process_real_time, FLAGS_frame_flip, FLAGS_frame_rotate, FLAGS_frames_repeat,
-            cameraSize, op::String(FLAGS_camera_parameter_path), FLAGS_frame_undistort, FLAGS_3d_views};
+            cameraSize, op::String(FLAGS_camera_parameter_path), FLAGS_frame_undistort, FLAGS_3d_views,
+            FLAGS_multi_stream_batch};
         opWrapper.configure(wrapperStructInput);
         // Output (comment or use default argument to disable any output)
         const op::WrapperStructOutput wrapperStructOutput{
@@ -106,7 +118,9 @@ void configureWrapper(op::Wrapper& opWrapper)
             op::String(FLAGS_write_video), FLAGS_write_video_fps, FLAGS_write_video_with_audio,
             op::String(FLAGS_write_heatmaps), op::String(FLAGS_write_heatmaps_format), op::String(FLAGS_write_video_3d),
             op::String(FLAGS_write_video_adam), op::String(FLAGS_write_bvh), op::String(FLAGS_udp_host),
-            op::String(FLAGS_udp_port)};
+            op::String(FLAGS_udp_port), op::String(FLAGS_write_shared_memory), FLAGS_write_shared_memory_image,
+            op::String(FLAGS_write_net_output), FLAGS_write_video_async_queue, FLAGS_write_video_async_drop,
+            FLAGS_write_images_threads, FLAGS_write_images_memory, FLAGS_write_png_compression, FLAGS_write_jpg_quality};
         opWrapper.configure(wrapperStructOutput);
         // GUI (comment or use default argument to disable any visual output)
         const op::WrapperStructGui wrapperStructGui{
@@ -0,0 +1,663 @@
+// ------------------------- OpenPose Local Inference Server -------------------------
+// It keeps a single warm copy of OpenPose (i.e., of its networks) and serves the frames sent by any number of local
+// processes over a Unix domain socket, with the binary protocol of include/openpose/filestream/serverProtocol.h (see
+// include/openpose/filestream/serverClient.hpp for a small C++ client library). Clients can pipeline many requests,
+// so OpenPose (running in its asynchronous mode) keeps all its threads and GPUs busy.
+// Each connection is read by its own thread, which decodes the frames and pushes them into OpenPose, while a single
+// output thread pops the processed frames and sends back their keypoints (body keypoints, IDs, and scores). Clients
+// that stop reading their responses are disconnected after `--server_send_timeout`, so they cannot stall the others.
+// Usage example:
+//     ./build/examples/server/openpose_server.bin --server_socket /tmp/openpose.sock
+//     ./build/examples/server/openpose_server_load.bin --server_socket /tmp/openpose.sock
+
+// Third-party dependencies
+#include <opencv2/opencv.hpp>
+// Command-line user interface
+#define OPENPOSE_FLAGS_DISABLE_PRODUCER
+#define OPENPOSE_FLAGS_DISABLE_DISPLAY
+#include <openpose/flags.hpp>
+// OpenPose dependencies
+#include <openpose/headers.hpp>
+#include <openpose/filestream/serverProtocol.h>
+// Unix domain sockets
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h> // timeval
+#include <sys/un.h>
+#include <unistd.h>
+
+// Custom OpenPose flags
+// Server
+DEFINE_string(server_socket,            "/tmp/openpose.sock", "Path of the Unix domain socket where the server listens. If a previous server did not"
+                                                        " remove it (e.g., it crashed), it is replaced.");
+DEFINE_int32(server_max_in_flight,      16,             "Maximum number of requests of each connection being processed at the same time. Further"
+                                                        " requests of that connection are not read until one of them is answered (backpressure),"
+                                                        " so a single client cannot fill the memory of the server.");
+DEFINE_int32(server_max_request_mb,     64,             "Maximum payload size (in megabytes) of each request. Connections sending bigger requests"
+                                                        " are closed.");
+DEFINE_double(server_send_timeout,      2.,             "Maximum time (in seconds) that sending a response can be blocked by a client that does not"
+                                                        " read them. After it, that client is disconnected, so it does not delay the responses of"
+                                                        " the other clients (all of them are sent by the same thread).");
+
+// Server state shared with the signal handler
+std::atomic<bool> sShutdown{false};
+
+void signalHandler(int)
+{
+    sShutdown = true;
+}
+
+// Server statistics
+std::atomic<unsigned long long> sRequests{0ull};
+std::atomic<unsigned long long> sErrors{0ull};
+std::atomic<unsigned long long> sInFlight{0ull};
+std::atomic<unsigned long long> sServerNanoseconds{0ull};
+std::atomic<unsigned long long> sServerNanosecondsMax{0ull};
+
+// Each client connection. It is kept alive (and so its socket open) until the last one of its requests has been
+// answered, even if its reader thread already finished.
+struct ServerConnection
+{
+    const int socketFd;
+    std::mutex writeMutex;
+    std::atomic<bool> writeFailed;
+    std::mutex inFlightMutex;
+    std::condition_variable inFlightCondition;
+    unsigned long long inFlight;
+    std::atomic<bool> readerFinished;
+
+    explicit ServerConnection(const int socketFd_) :
+        socketFd{socketFd_},
+        writeFailed{false},
+        inFlight{0ull},
+        readerFinished{false}
+    {}
+
+    ~ServerConnection()
+    {
+        ::close(socketFd);
+    }
+};
+
+// Each request travels through OpenPose inside a ServerDatum, so the output thread knows where to answer it. The
+// receive time is kept in op::Datum::captureNanoseconds (so `--latency_target` also applies to the requests).
+struct ServerDatum : public op::Datum
+{
+    std::shared_ptr<ServerConnection> spConnection;
+    unsigned long long requestId;
+
+    ServerDatum() :
+        requestId{0ull}
+    {}
+};
+
+typedef std::vector<std::shared_ptr<ServerDatum>> ServerDatums;
+
+bool sendAll(const int socketFd, const unsigned char* data, unsigned long long size)
+{
+    while (size > 0)
+    {
+        const auto sent = ::send(socketFd, data, size, 0);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += sent;
+        size -= (unsigned long long)sent;
+    }
+    return true;
+}
+
+bool receiveAll(const int socketFd, unsigned char* data, unsigned long long size)
+{
+    while (size > 0)
+    {
+        const auto received = ::recv(socketFd, data, size, 0);
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received <= 0)
+            return false;
+        data += received;
+        size -= (unsigned long long)received;
+    }
+    return true;
+}
+
+bool discardAll(const int socketFd, unsigned long long size)
+{
+    std::vector<unsigned char> buffer(std::min(size, 65536ull));
+    while (size > 0)
+    {
+        const auto chunkSize = std::min(size, (unsigned long long)buffer.size());
+        if (!receiveAll(socketFd, buffer.data(), chunkSize))
+            return false;
+        size -= chunkSize;
+    }
+    return true;
+}
+
+void sendResponse(
+    ServerConnection& connection, const unsigned long long requestId, const int status,
+    const unsigned long long receiveNanoseconds, const ServerDatum* const serverDatum = nullptr)
+{
+    try
+    {
+        OpServerResponseHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = OP_SERVER_RESPONSE_MAGIC;
+        header.version = OP_SERVER_VERSION;
+        header.requestId = requestId;
+        header.status = status;
+        // Payload: keypoints, IDs, and scores packed consecutively
+        std::vector<unsigned char> payload;
+        if (status == OP_SERVER_OK && serverDatum != nullptr && !serverDatum->poseKeypoints.empty())
+        {
+            const auto& poseKeypoints = serverDatum->poseKeypoints;
+            const auto& poseIds = serverDatum->poseIds;
+            const auto& poseScores = serverDatum->poseScores;
+            const auto numberPeople = poseKeypoints.getSize(0);
+            header.numberPeople = (uint32_t)numberPeople;
+            header.numberBodyParts = (uint32_t)poseKeypoints.getSize(1);
+            const auto hasIds = (poseIds.getVolume() == (size_t)numberPeople);
+            const auto hasScores = (poseScores.getVolume() == (size_t)numberPeople);
+            header.flags = (hasIds ? OP_SERVER_FLAG_POSE_IDS : 0u) | (hasScores ? OP_SERVER_FLAG_POSE_SCORES : 0u);
+            const auto keypointsSize = poseKeypoints.getVolume() * sizeof(float);
+            payload.resize(keypointsSize + (hasIds ? numberPeople * sizeof(int64_t) : 0u)
+                           + (hasScores ? numberPeople * sizeof(float) : 0u));
+            auto* payloadPtr = payload.data();
+            std::memcpy(payloadPtr, poseKeypoints.getConstPtr(), keypointsSize);
+            payloadPtr += keypointsSize;
+            if (hasIds)
+            {
+                for (auto person = 0 ; person < numberPeople ; person++)
+                {
+                    const auto id = (int64_t)poseIds[person];
+                    std::memcpy(payloadPtr, &id, sizeof(int64_t));
+                    payloadPtr += sizeof(int64_t);
+                }
+            }
+            if (hasScores)
+                std::memcpy(payloadPtr, poseScores.getConstPtr(), numberPeople * sizeof(float));
+        }
+        header.payloadSize = payload.size();
+        // Statistics
+        const auto now = op::getSteadyTimeNanoseconds();
+        header.serverNanoseconds = (now > receiveNanoseconds ? now - receiveNanoseconds : 0ull);
+        sRequests++;
+        if (status != OP_SERVER_OK)
+            sErrors++;
+        else
+        {
+            sServerNanoseconds += header.serverNanoseconds;
+            auto maxNanoseconds = sServerNanosecondsMax.load();
+            while (header.serverNanoseconds > maxNanoseconds
+                   && !sServerNanosecondsMax.compare_exchange_weak(maxNanoseconds, header.serverNanoseconds))
+            {}
+        }
+        // Send (header + payload must not be interleaved with other responses of the same connection). If the client
+        // is gone (or it did not read within `server_send_timeout`), it is disconnected and its remaining responses
+        // are silently discarded.
+        const std::lock_guard<std::mutex> lock{connection.writeMutex};
+        if (!connection.writeFailed
+            && (!sendAll(connection.socketFd, (const unsigned char*)&header, sizeof(header))
+                || !sendAll(connection.socketFd, payload.data(), payload.size())))
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                op::opLog("Server: Closing connection that did not read its responses within `server_send_timeout`.",
+                          op::Priority::High);
+            connection.writeFailed = true;
+            // It also unblocks its reader thread
+            ::shutdown(connection.socketFd, SHUT_RDWR);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // No op::error() on the server threads (it would terminate the server): only this connection is closed
+        op::opLog("Server: Closing connection after failing to answer a request: " + std::string{e.what()},
+                  op::Priority::High);
+        connection.writeFailed = true;
+        ::shutdown(connection.socketFd, SHUT_RDWR);
+    }
+}
+
+void releaseInFlight(ServerConnection& connection)
+{
+    {
+        const std::lock_guard<std::mutex> lock{connection.inFlightMutex};
+        connection.inFlight--;
+    }
+    sInFlight--;
+    connection.inFlightCondition.notify_one();
+}
+
+// Reader thread of each connection: it decodes each request and pushes it into OpenPose. Invalid requests are
+// answered right away, while the valid ones are answered by the output thread once processed.
+void connectionReader(
+    op::WrapperT<ServerDatum>& opWrapperT, const std::shared_ptr<ServerConnection>& spConnection)
+{
+    try
+    {
+        auto& connection = *spConnection;
+        const auto maxInFlight = (unsigned long long)std::max(1, FLAGS_server_max_in_flight);
+        const auto maxPayloadSize = (unsigned long long)std::max(1, FLAGS_server_max_request_mb) * 1024ull * 1024ull;
+        std::vector<unsigned char> encodedBuffer;
+        OpServerRequestHeader header;
+        while (!sShutdown && receiveAll(connection.socketFd, (unsigned char*)&header, sizeof(header)))
+        {
+            const auto receiveNanoseconds = op::getSteadyTimeNanoseconds();
+            // Corrupted stream (the next request cannot be located) --> Close connection
+            if (header.magic != OP_SERVER_REQUEST_MAGIC || header.version != OP_SERVER_VERSION
+                || header.payloadSize > maxPayloadSize)
+            {
+                op::opLog("Server: Closing connection due to an invalid request header (wrong magic number, version,"
+                          " or payload bigger than `server_max_request_mb`).", op::Priority::High);
+                sendResponse(connection, header.requestId, OP_SERVER_ERROR_REQUEST, receiveNanoseconds);
+                break;
+            }
+            // Read image
+            cv::Mat cvMat;
+            auto status = OP_SERVER_OK;
+            if (header.format == OP_SERVER_FORMAT_BGR
+                && header.payloadSize == (unsigned long long)header.rows * header.cols * 3ull
+                && header.payloadSize > 0)
+            {
+                // Received directly into the image (no extra copy)
+                cvMat = cv::Mat((int)header.rows, (int)header.cols, CV_8UC3);
+                if (!receiveAll(connection.socketFd, cvMat.data, header.payloadSize))
+                    break;
+            }
+            else if (header.format == OP_SERVER_FORMAT_ENCODED && header.payloadSize > 0)
+            {
+                encodedBuffer.resize(header.payloadSize);
+                if (!receiveAll(connection.socketFd, encodedBuffer.data(), header.payloadSize))
+                    break;
+                cvMat = cv::imdecode(encodedBuffer, cv::IMREAD_COLOR);
+                if (cvMat.empty())
+                    status = OP_SERVER_ERROR_DECODE;
+            }
+            else
+            {
+                if (!discardAll(connection.socketFd, header.payloadSize))
+                    break;
+                status = OP_SERVER_ERROR_REQUEST;
+            }
+            if (status != OP_SERVER_OK)
+            {
+                sendResponse(connection, header.requestId, status, receiveNanoseconds);
+                continue;
+            }
+            // Backpressure: Wait until this connection has a free in-flight slot
+            {
+                std::unique_lock<std::mutex> lock{connection.inFlightMutex};
+                connection.inFlightCondition.wait(
+                    lock, [&]{ return connection.inFlight < maxInFlight || sShutdown; });
+                connection.inFlight++;
+            }
+            sInFlight++;
+            // Push into OpenPose
+            auto datumsPtr = std::make_shared<ServerDatums>();
+            datumsPtr->emplace_back(std::make_shared<ServerDatum>());
+            auto& serverDatum = *datumsPtr->at(0);
+            serverDatum.cvInputData = OP_CV2OPCONSTMAT(cvMat);
+            serverDatum.captureNanoseconds = receiveNanoseconds;
+            serverDatum.spConnection = spConnection;
+            serverDatum.requestId = header.requestId;
+            if (sShutdown || !opWrapperT.waitAndEmplace(datumsPtr))
+            {
+                releaseInFlight(connection);
+                sendResponse(connection, header.requestId, OP_SERVER_ERROR_SHUTDOWN, receiveNanoseconds);
+                break;
+            }
+        }
+        connection.readerFinished = true;
+    }
+    catch (const std::exception& e)
+    {
+        // No op::error() on the server threads (it would terminate the server): only this connection is closed
+        op::opLog("Server: Closing connection after an error while reading it: " + std::string{e.what()},
+                  op::Priority::High);
+        ::shutdown(spConnection->socketFd, SHUT_RDWR);
+        spConnection->readerFinished = true;
+    }
+}
+
+// Output thread: it pops the processed frames (of all connections) and answers them
+void outputWriter(op::WrapperT<ServerDatum>& opWrapperT)
+{
+    try
+    {
+        std::shared_ptr<ServerDatums> datumsPtr;
+        while (opWrapperT.waitAndPop(datumsPtr))
+        {
+            if (datumsPtr != nullptr)
+            {
+                for (auto& serverDatumPtr : *datumsPtr)
+                {
+                    if (serverDatumPtr != nullptr && serverDatumPtr->spConnection != nullptr)
+                    {
+                        sendResponse(
+                            *serverDatumPtr->spConnection, serverDatumPtr->requestId, OP_SERVER_OK,
+                            serverDatumPtr->captureNanoseconds, serverDatumPtr.get());
+                        releaseInFlight(*serverDatumPtr->spConnection);
+                        // Socket closed as soon as its last request is answered (if the client disconnected)
+                        serverDatumPtr->spConnection.reset();
+                    }
+                }
+            }
+            datumsPtr.reset();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // No op::error() on the server threads (it would terminate the server): the server is stopped instead, as no
+        // more requests could be answered
+        op::opLog("Server: Stopping after an error in the output thread: " + std::string{e.what()},
+                  op::Priority::High);
+        sShutdown = true;
+    }
+}
+
+int createServerSocket(const std::string& socketPath)
+{
+    try
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+            op::error("Invalid `server_socket` path (empty or too long): `" + socketPath + "`.",
+                      __LINE__, __FUNCTION__, __FILE__);
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        // Socket left by a previous server: replaced unless another server is still listening in it
+        struct stat fileStat;
+        if (::stat(socketPath.c_str(), &fileStat) == 0)
+        {
+            if (!S_ISSOCK(fileStat.st_mode))
+                op::error("`server_socket` path already exists and it is not a socket: `" + socketPath + "`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+            const auto testFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            const auto isInUse = (::connect(testFd, (const sockaddr*)&address, sizeof(address)) == 0);
+            ::close(testFd);
+            if (isInUse)
+                op::error("Another server is already listening in `" + socketPath + "`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+            ::unlink(socketPath.c_str());
+        }
+        // Listen
+        const auto socketFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketFd < 0
+            || ::bind(socketFd, (const sockaddr*)&address, sizeof(address)) != 0
+            || ::listen(socketFd, SOMAXCONN) != 0)
+        {
+            const std::string errorMessage = std::strerror(errno);
+            if (socketFd >= 0)
+                ::close(socketFd);
+            op::error("Could not listen in `" + socketPath + "`: " + errorMessage + ".",
+                      __LINE__, __FUNCTION__, __FILE__);
+        }
+        return socketFd;
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        return -1;
+    }
+}
+
+void configureWrapper(op::WrapperT<ServerDatum>& opWrapperT)
+{
+    try
+    {
+        // Configuring OpenPose
+
+        // logging_level
+        op::checkBool(
+            0 <= FLAGS_logging_level && FLAGS_logging_level <= 255, "Wrong logging_level value.",
+            __LINE__, __FUNCTION__, __FILE__);
+        op::ConfigureLog::setPriorityThreshold((op::Priority)FLAGS_logging_level);
+        // logging_async
+        op::ConfigureLog::setBinaryRecordsPath(FLAGS_logging_records);
+        op::ConfigureLog::setAsynchronous(FLAGS_logging_async);
+        op::Profiler::setDefaultX(FLAGS_profile_speed);
+        // Every request must be answered, so requests cannot be dropped
+        if (FLAGS_latency_target > 0. && (op::LatencyPolicy)FLAGS_latency_policy == op::LatencyPolicy::DropFrames)
+            op::error("`latency_policy` 0 (drop frames) cannot be used with the server, as every request must be"
+                      " answered. Use `--latency_policy 1` instead.", __LINE__, __FUNCTION__, __FILE__);
+        // Consecutive requests are independent images (of any client), so nothing can be kept across frames
+        if (FLAGS_tracking > -1 || FLAGS_identification || FLAGS_roi_mosaic > 0 || FLAGS_temporal_connection
+            || FLAGS_net_resolution_adaptive > 0. || FLAGS_face_reuse_frames > 0 || FLAGS_hand_reuse_frames > 0
+            || FLAGS_face_detector_period > 0
+            || op::flagsToDetector(FLAGS_hand_detector) == op::Detector::BodyWithTracking)
+            op::error("Options that keep state across consecutive frames (`--tracking`, `--identification`,"
+                      " `--roi_mosaic`, `--temporal_connection`, `--net_resolution_adaptive`, `--face_reuse_frames`,"
+                      " `--hand_reuse_frames`, `--face_detector_period`, and `--hand_detector 3`) cannot be used with"
+                      " the server, as consecutive requests might belong to different clients.",
+                      __LINE__, __FUNCTION__, __FILE__);
+
+        // Applying user defined configuration - GFlags to program variables
+        // outputSize
+        const auto outputSize = op::flagsToPoint(op::String(FLAGS_output_resolution), "-1x-1");
+        // netInputSize
+        const auto netInputSize = op::flagsToPoint(op::String(FLAGS_net_resolution), "-1x368");
+        // faceNetInputSize
+        const auto faceNetInputSize = op::flagsToPoint(op::String(FLAGS_face_net_resolution), "368x368 (multiples of 16)");
+        // handNetInputSize
+        const auto handNetInputSize = op::flagsToPoint(op::String(FLAGS_hand_net_resolution), "368x368 (multiples of 16)");
+        // poseMode
+        const auto poseMode = op::flagsToPoseMode(FLAGS_body);
+        // poseModel
+        const auto poseModel = op::flagsToPoseModel(op::String(FLAGS_model_pose));
+        // JSON saving
+        if (!FLAGS_write_keypoint.empty())
+            op::opLog(
+                "Flag `write_keypoint` is deprecated and will eventually be removed. Please, use `write_json`"
+                " instead.", op::Priority::Max);
+        // keypointScaleMode
+        const auto keypointScaleMode = op::flagsToScaleMode(FLAGS_keypoint_scale);
+        // heatmaps to add
+        const auto heatMapTypes = op::flagsToHeatMaps(FLAGS_heatmaps_add_parts, FLAGS_heatmaps_add_bkg,
+                                                      FLAGS_heatmaps_add_PAFs);
+        const auto heatMapScaleMode = op::flagsToHeatMapScaleMode(FLAGS_heatmaps_scale);
+        // >1 camera view?
+        const auto multipleView = (FLAGS_3d || FLAGS_3d_views > 1);
+        // Rendering only if a rendered output is saved (clients only receive the keypoints)
+        const auto renderOutput = (!FLAGS_write_images.empty() || !FLAGS_write_video.empty());
+        const auto renderPose = (renderOutput ? FLAGS_render_pose : 0);
+        // Face and hand detectors
+        const auto faceDetector = op::flagsToDetector(FLAGS_face_detector);
+        const auto handDetector = op::flagsToDetector(FLAGS_hand_detector);
+        // Enabling Google Logging
+        const bool enableGoogleLogging = true;
+
+        // Pose configuration (use WrapperStructPose{} for default and recommended configuration)
+        const op::WrapperStructPose wrapperStructPose{
+            poseMode, netInputSize, FLAGS_net_resolution_dynamic, outputSize, keypointScaleMode, FLAGS_num_gpu,
+            FLAGS_num_gpu_start, FLAGS_scale_number, (float)FLAGS_scale_gap,
+            op::flagsToRenderMode(renderPose, multipleView), poseModel, !FLAGS_disable_blending,
+            (float)FLAGS_alpha_pose, (float)FLAGS_alpha_heatmap, FLAGS_part_to_show, op::String(FLAGS_model_folder),
+            heatMapTypes, heatMapScaleMode, FLAGS_part_candidates, (float)FLAGS_render_threshold,
+            FLAGS_number_people_max, FLAGS_maximize_positives, FLAGS_fps_max, op::String(FLAGS_prototxt_path),
+            op::String(FLAGS_caffemodel_path), (float)FLAGS_upsampling_ratio, enableGoogleLogging,
+            (float)FLAGS_net_resolution_adaptive, FLAGS_temporal_connection,
+            op::flagsToNetResolutionBuckets(op::String(FLAGS_net_resolution_buckets)), FLAGS_opencv_dnn,
+            (op::OpenCvDnnBackend)FLAGS_opencv_dnn_backend, (op::OpenCvDnnTarget)FLAGS_opencv_dnn_target,
+            (op::OpenCvDnnPrecision)FLAGS_opencv_dnn_precision, FLAGS_opencv_dnn_threads,
+            op::String(FLAGS_model_cache_folder), FLAGS_latency_target, (op::LatencyPolicy)FLAGS_latency_policy,
+            FLAGS_stage_fusion};
+        opWrapperT.configure(wrapperStructPose);
+        // Face configuration (use op::WrapperStructFace{} to disable it)
+        const op::WrapperStructFace wrapperStructFace{
+            FLAGS_face, faceDetector, faceNetInputSize,
+            op::flagsToRenderMode((renderOutput ? FLAGS_face_render : 0), multipleView, renderPose),
+            (float)FLAGS_face_alpha_pose, (float)FLAGS_face_alpha_heatmap, (float)FLAGS_face_render_threshold,
+            FLAGS_face_reuse_frames, FLAGS_face_detector_period};
+        opWrapperT.configure(wrapperStructFace);
+        // Hand configuration (use op::WrapperStructHand{} to disable it)
+        const op::WrapperStructHand wrapperStructHand{
+            FLAGS_hand, handDetector, handNetInputSize, FLAGS_hand_scale_number, (float)FLAGS_hand_scale_range,
+            op::flagsToRenderMode((renderOutput ? FLAGS_hand_render : 0), multipleView, renderPose),
+            (float)FLAGS_hand_alpha_pose, (float)FLAGS_hand_alpha_heatmap, (float)FLAGS_hand_render_threshold,
+            FLAGS_hand_reuse_frames};
+        opWrapperT.configure(wrapperStructHand);
+        // Extra functionality configuration (use op::WrapperStructExtra{} to disable it)
+        const op::WrapperStructExtra wrapperStructExtra{
+            FLAGS_3d, FLAGS_3d_min_views, FLAGS_identification, FLAGS_tracking, FLAGS_ik_threads,
+            FLAGS_roi_mosaic};
+        opWrapperT.configure(wrapperStructExtra);
+        // Output (comment or use default argument to disable any output)
+        const op::WrapperStructOutput wrapperStructOutput{
+            FLAGS_cli_verbose, op::String(FLAGS_write_keypoint), op::stringToDataFormat(FLAGS_write_keypoint_format),
+            op::String(FLAGS_write_json), op::String(FLAGS_write_coco_json), FLAGS_write_coco_json_variants,
+            FLAGS_write_coco_json_variant, op::String(FLAGS_write_images), op::String(FLAGS_write_images_format),
+            op::String(FLAGS_write_video), FLAGS_write_video_fps, FLAGS_write_video_with_audio,
+            op::String(FLAGS_write_heatmaps), op::String(FLAGS_write_heatmaps_format), op::String(FLAGS_write_video_3d),
+            op::String(FLAGS_write_video_adam), op::String(FLAGS_write_bvh), op::String(FLAGS_udp_host),
+            op::String(FLAGS_udp_port), op::String(FLAGS_write_shared_memory), FLAGS_write_shared_memory_image,
+            op::String(FLAGS_write_net_output), FLAGS_write_video_async_queue, FLAGS_write_video_async_drop,
+            FLAGS_write_images_threads, FLAGS_write_images_memory, FLAGS_write_png_compression, FLAGS_write_jpg_quality};
+        opWrapperT.configure(wrapperStructOutput);
+        // No GUI. Equivalent to: opWrapper.configure(op::WrapperStructGui{});
+        // Set to single-thread (for sequential processing and/or debugging and/or reducing latency)
+        if (FLAGS_disable_multi_thread)
+            opWrapperT.disableMultiThreading();
+    }
+    catch (const std::exception& e)
+    {
+        op::error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+    }
+}
+
+int openPoseServer()
+{
+    try
+    {
+        op::opLog("Starting OpenPose server...", op::Priority::High);
+        const auto opTimer = op::getTimerInit();
+
+        // Configure OpenPose
+        op::opLog("Configuring OpenPose...", op::Priority::High);
+        op::WrapperT<ServerDatum> opWrapperT{op::ThreadManagerMode::Asynchronous};
+        configureWrapper(opWrapperT);
+
+        // Listen (before loading the networks, so a wrong or busy socket path fails right away). Clients connecting
+        // meanwhile are accepted once OpenPose has started
+        const auto serverFd = createServerSocket(FLAGS_server_socket);
+
+        // Signals: Ctrl+C (or kill) stops the server, and writing into a closed client does not kill it
+        std::signal(SIGINT, signalHandler);
+        std::signal(SIGTERM, signalHandler);
+        std::signal(SIGPIPE, SIG_IGN);
+
+        // Start OpenPose
+        op::opLog("Starting thread(s)...", op::Priority::High);
+        opWrapperT.start();
+        std::thread outputThread{outputWriter, std::ref(opWrapperT)};
+
+        // Accept clients until stopped
+        op::opLog("OpenPose server listening in `" + FLAGS_server_socket + "`. Press Ctrl+C to stop it.",
+                  op::Priority::High);
+        std::list<std::pair<std::shared_ptr<ServerConnection>, std::thread>> connections;
+        unsigned long long numberConnections = 0ull;
+        while (!sShutdown && opWrapperT.isRunning())
+        {
+            pollfd pollFd{serverFd, POLLIN, 0};
+            if (::poll(&pollFd, 1, 200) > 0 && (pollFd.revents & POLLIN))
+            {
+                const auto clientFd = ::accept(serverFd, nullptr, nullptr);
+                if (clientFd >= 0)
+                {
+                    // Bounded blocking time of the output thread on clients that do not read their responses
+                    const auto sendTimeoutMicroseconds = (long long)(std::max(0.001, FLAGS_server_send_timeout) * 1e6);
+                    timeval sendTimeout;
+                    sendTimeout.tv_sec = (time_t)(sendTimeoutMicroseconds / 1000000ll);
+                    sendTimeout.tv_usec = (suseconds_t)(sendTimeoutMicroseconds % 1000000ll);
+                    ::setsockopt(clientFd, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+                    auto spConnection = std::make_shared<ServerConnection>(clientFd);
+                    connections.emplace_back(
+                        spConnection, std::thread{connectionReader, std::ref(opWrapperT), spConnection});
+                    numberConnections++;
+                    op::opLog("Server: New connection (" + std::to_string(connections.size()) + " open).",
+                              op::Priority::Low);
+                }
+            }
+            // Release finished connections
+            for (auto connection = connections.begin() ; connection != connections.end() ; )
+            {
+                if (connection->first->readerFinished)
+                {
+                    connection->second.join();
+                    connection = connections.erase(connection);
+                }
+                else
+                    ++connection;
+            }
+        }
+
+        // Stop accepting and reading requests
+        op::opLog("Stopping server...", op::Priority::High);
+        sShutdown = true;
+        ::close(serverFd);
+        ::unlink(FLAGS_server_socket.c_str());
+        for (auto& connection : connections)
+        {
+            ::shutdown(connection.first->socketFd, SHUT_RD);
+            {
+                const std::lock_guard<std::mutex> lock{connection.first->inFlightMutex};
+                connection.first->inFlightCondition.notify_all();
+            }
+            connection.second.join();
+        }
+        // Answer the requests already inside OpenPose (up to a few seconds)
+        const auto drainInit = op::getTimerInit();
+        while (sInFlight > 0 && opWrapperT.isRunning() && op::getTimeSeconds(drainInit) < 5.)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        if (sInFlight > 0)
+            op::opLog("Server: " + std::to_string(sInFlight.load()) + " requests were not answered.",
+                      op::Priority::High);
+        // Stop OpenPose
+        op::opLog("Stopping thread(s)", op::Priority::High);
+        opWrapperT.stop();
+        outputThread.join();
+        connections.clear();
+
+        // Statistics
+        const auto successfulRequests = sRequests - sErrors;
+        op::opLog("Server statistics: " + std::to_string(numberConnections) + " connections, "
+                  + std::to_string(sRequests.load()) + " requests (" + std::to_string(sErrors.load()) + " errors), "
+                  + "mean server time "
+                  + std::to_string(successfulRequests > 0 ? sServerNanoseconds / 1e6 / successfulRequests : 0.)
+                  + " ms, max server time " + std::to_string(sServerNanosecondsMax / 1e6) + " ms.",
+                  op::Priority::High);
+
+        // Measuring total time
+        op::printTime(opTimer, "OpenPose server successfully finished. Total time: ", " seconds.",
+                      op::Priority::High);
+
+        // Return
+        return 0;
+    }
+    catch (const std::exception&)
+    {
+        return -1;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // Parsing command line flags
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    // Running openPoseServer
+    return openPoseServer();
+}
@@ -0,0 +1,263 @@
+// ------------------------- OpenPose Local Inference Server - Load Generator -------------------------
+// It sends the same image (raw BGR or JPEG) to `openpose_server` over several connections, each one keeping several
+// requests in flight (closed loop) or sending them at a fixed rate (open loop, `--load_rate`), and prints 1 JSON line
+// with the throughput and the request latency (mean and percentiles) measured by the client, as well as the mean
+// time spent inside the server. Only the client library (`openpose_server_client`) is used to talk to the server.
+
+// Third-party dependencies
+#include <algorithm>
+#include <chrono>
+#include <cmath> // std::ceil
+#include <condition_variable>
+#include <fstream>
+#include <iostream> // std::cout
+#include <mutex>
+#include <numeric> // std::accumulate
+#include <sstream>
+#include <thread>
+#include <opencv2/opencv.hpp>
+// Command-line user interface
+#define OPENPOSE_FLAGS_DISABLE_POSE
+#include <openpose/flags.hpp>
+// OpenPose server client
+#include <openpose/filestream/serverClient.hpp>
+
+DEFINE_string(server_socket,            "/tmp/openpose.sock", "Path of the Unix domain socket of `openpose_server`.");
+DEFINE_string(load_image,               "examples/media/COCO_val2014_000000000192.jpg", "Image sent in every request.");
+DEFINE_string(load_format,              "jpg",          "Request format: `jpg` (the image is JPEG-encoded once and decoded by the server) or"
+                                                        " `raw` (BGR pixels, no decoding in the server).");
+DEFINE_int32(load_requests,             1000,           "Total number of timed requests (split among all the connections).");
+DEFINE_int32(load_warmup,               10,             "Number of non-timed requests sent (1 at a time) before the timed ones.");
+DEFINE_int32(load_connections,          1,              "Number of concurrent connections (i.e., clients).");
+DEFINE_int32(load_in_flight,            8,              "Maximum number of requests in flight (sent but not answered yet) of each connection.");
+DEFINE_double(load_rate,                0.,             "If > 0, total requests per second (open loop, the latency is measured from the scheduled"
+                                                        " send time, so it includes any time waiting for a free in-flight slot). By default (0),"
+                                                        " each connection sends a new request as soon as it has a free in-flight slot (closed"
+                                                        " loop).");
+DEFINE_string(load_output,              "",             "Also append the JSON line into this file.");
+
+typedef std::chrono::steady_clock Clock;
+
+struct ConnectionResults
+{
+    std::vector<double> latenciesMs;
+    double serverMsSum = 0.;
+    unsigned long long people = 0ull;
+    unsigned long long errors = 0ull;
+    std::string exceptionMessage;
+};
+
+// Each connection: this thread receives the results while a second one sends the requests
+void runConnection(
+    const std::vector<unsigned char>& payload, const cv::Mat& image, const bool isRaw,
+    const unsigned long long numberRequests, const double intervalSeconds, ConnectionResults& results)
+{
+    try
+    {
+        op::ServerClient client{FLAGS_server_socket};
+        std::vector<Clock::time_point> sendTimes(numberRequests);
+        std::mutex inFlightMutex;
+        std::condition_variable inFlightCondition;
+        unsigned long long inFlight = 0ull;
+        bool stopSending = false;
+        const auto maxInFlight = (unsigned long long)std::max(1, FLAGS_load_in_flight);
+        // Sender
+        std::string senderException;
+        std::thread sender{[&]
+        {
+            try
+            {
+                const auto beginTime = Clock::now();
+                for (auto request = 0ull ; request < numberRequests ; request++)
+                {
+                    // Open loop: latency measured from the scheduled time
+                    if (intervalSeconds > 0.)
+                    {
+                        sendTimes[request] = beginTime + std::chrono::duration_cast<Clock::duration>(
+                            std::chrono::duration<double>(request * intervalSeconds));
+                        std::this_thread::sleep_until(sendTimes[request]);
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock{inFlightMutex};
+                        inFlightCondition.wait(lock, [&]{ return inFlight < maxInFlight || stopSending; });
+                        if (stopSending)
+                            break;
+                        inFlight++;
+                        // Closed loop: latency measured from the actual send time
+                        if (intervalSeconds <= 0.)
+                            sendTimes[request] = Clock::now();
+                    }
+                    if (isRaw)
+                        client.sendRaw(image.data, image.rows, image.cols, image.step);
+                    else
+                        client.sendEncoded(payload.data(), payload.size());
+                }
+            }
+            catch (const std::exception& e)
+            {
+                senderException = e.what();
+                client.shutdownSend();
+            }
+        }};
+        // Receiver
+        try
+        {
+            op::ServerResult result;
+            for (auto request = 0ull ; request < numberRequests && client.receive(result) ; request++)
+            {
+                double latency;
+                {
+                    const std::lock_guard<std::mutex> lock{inFlightMutex};
+                    latency = std::chrono::duration<double, std::milli>(
+                        Clock::now() - sendTimes.at(result.requestId)).count();
+                    inFlight--;
+                }
+                inFlightCondition.notify_one();
+                if (result.status != OP_SERVER_OK)
+                    results.errors++;
+                else
+                {
+                    results.latenciesMs.emplace_back(latency);
+                    results.serverMsSum += result.serverNanoseconds / 1e6;
+                    results.people += result.numberPeople;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            results.exceptionMessage = e.what();
+        }
+        // Unblock the sender if the receiver finished early (e.g., connection closed)
+        {
+            const std::lock_guard<std::mutex> lock{inFlightMutex};
+            stopSending = true;
+        }
+        inFlightCondition.notify_one();
+        sender.join();
+        if (!senderException.empty())
+            results.exceptionMessage = senderException;
+        else if (results.exceptionMessage.empty() && results.latenciesMs.size() + results.errors < numberRequests)
+            results.exceptionMessage = "The server closed the connection before answering all the requests.";
+    }
+    catch (const std::exception& e)
+    {
+        results.exceptionMessage = e.what();
+    }
+}
+
+double percentile(const std::vector<double>& sortedValues, const double percentage)
+{
+    if (sortedValues.empty())
+        return 0.;
+    // Nearest-rank percentile
+    const auto rank = (long long)std::ceil(percentage / 100. * sortedValues.size()) - 1ll;
+    return sortedValues[(size_t)std::max(0ll, std::min((long long)sortedValues.size() - 1ll, rank))];
+}
+
+int openPoseServerLoad()
+{
+    try
+    {
+        // Image and request payload
+        cv::Mat image = cv::imread(FLAGS_load_image);
+        if (image.empty())
+        {
+            std::cerr << "Image could not be read: " << FLAGS_load_image << std::endl;
+            return -1;
+        }
+        const auto isRaw = (FLAGS_load_format == "raw");
+        if (!isRaw && FLAGS_load_format != "jpg")
+        {
+            std::cerr << "Unknown `load_format` (use `jpg` or `raw`): " << FLAGS_load_format << std::endl;
+            return -1;
+        }
+        std::vector<unsigned char> payload;
+        if (!isRaw)
+            cv::imencode(".jpg", image, payload);
+
+        // Warm-up (e.g., the first frames of CUDA are much slower)
+        {
+            op::ServerClient client{FLAGS_server_socket};
+            op::ServerResult result;
+            for (auto request = 0 ; request < FLAGS_load_warmup ; request++)
+            {
+                if (isRaw)
+                    client.sendRaw(image.data, image.rows, image.cols, image.step);
+                else
+                    client.sendEncoded(payload.data(), payload.size());
+                if (!client.receive(result))
+                    throw std::runtime_error{"The server closed the connection during the warm-up."};
+            }
+        }
+
+        // Timed requests
+        const auto numberConnections = (unsigned long long)std::max(1, FLAGS_load_connections);
+        const auto numberRequests = (unsigned long long)std::max(1, FLAGS_load_requests);
+        const auto intervalSeconds = (FLAGS_load_rate > 0. ? numberConnections / FLAGS_load_rate : 0.);
+        std::vector<ConnectionResults> connectionResults(numberConnections);
+        std::vector<std::thread> connectionThreads;
+        const auto beginTime = Clock::now();
+        for (auto connection = 0ull ; connection < numberConnections ; connection++)
+            connectionThreads.emplace_back(
+                runConnection, std::cref(payload), std::cref(image), isRaw,
+                numberRequests / numberConnections + (connection < numberRequests % numberConnections ? 1 : 0),
+                intervalSeconds, std::ref(connectionResults[connection]));
+        for (auto& connectionThread : connectionThreads)
+            connectionThread.join();
+        const auto totalSeconds = std::chrono::duration<double>(Clock::now() - beginTime).count();
+
+        // Statistics
+        std::vector<double> latenciesMs;
+        auto serverMsSum = 0.;
+        auto people = 0ull;
+        auto errors = 0ull;
+        auto returnValue = 0;
+        for (const auto& results : connectionResults)
+        {
+            latenciesMs.insert(latenciesMs.end(), results.latenciesMs.begin(), results.latenciesMs.end());
+            serverMsSum += results.serverMsSum;
+            people += results.people;
+            errors += results.errors;
+            if (!results.exceptionMessage.empty())
+            {
+                std::cerr << "Connection error: " << results.exceptionMessage << std::endl;
+                returnValue = 1;
+            }
+        }
+        std::sort(latenciesMs.begin(), latenciesMs.end());
+        const auto answered = latenciesMs.size();
+        const auto meanMs = (answered > 0 ? std::accumulate(latenciesMs.begin(), latenciesMs.end(), 0.) / answered
+                                          : 0.);
+        std::ostringstream jsonLine;
+        jsonLine << "{\"format\": \"" << FLAGS_load_format << "\", \"width\": " << image.cols << ", \"height\": "
+                 << image.rows << ", \"connections\": " << numberConnections << ", \"in_flight\": "
+                 << FLAGS_load_in_flight << ", \"rate_hz\": " << FLAGS_load_rate << ", \"requests\": "
+                 << numberRequests << ", \"errors\": " << errors << ", \"seconds\": " << totalSeconds
+                 << ", \"throughput_hz\": " << answered / totalSeconds << ", \"latency_mean_ms\": " << meanMs
+                 << ", \"latency_p50_ms\": " << percentile(latenciesMs, 50.) << ", \"latency_p90_ms\": "
+                 << percentile(latenciesMs, 90.) << ", \"latency_p99_ms\": " << percentile(latenciesMs, 99.)
+                 << ", \"latency_max_ms\": " << (answered > 0 ? latenciesMs.back() : 0.)
+                 << ", \"server_mean_ms\": " << (answered > 0 ? serverMsSum / answered : 0.)
+                 << ", \"people_mean\": " << (answered > 0 ? double(people) / answered : 0.) << "}";
+        std::cout << jsonLine.str() << std::endl;
+        if (!FLAGS_load_output.empty())
+            std::ofstream{FLAGS_load_output, std::ios::app} << jsonLine.str() << std::endl;
+
+        // Return
+        return returnValue;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // Parsing command line flags
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    // Running openPoseServerLoad
+    return openPoseServerLoad();
+}
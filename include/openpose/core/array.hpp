@@ -150,9 +150,19 @@ namespace op
          */
         Array<T> clone() const;
 
+        /**
+         * Similar to clone(), but it copies the data into `array`, re-using its memory when possible (see reset()).
+         * Useful to avoid allocating new memory for each new frame.
+         * @param array Array where the data will be copied.
+         */
+        void copyTo(Array<T>& array) const;
+
         /**
          * Data allocation function.
          * It allocates the required space for the memory (it does not initialize that memory).
+         * If this Array is the only owner of its current memory and that memory is big enough, it is re-used (no new
+         * allocation). The same applies to any other reset() function without dataPtr. Resetting it to an empty Array
+         * frees that memory (see emptyKeepingCapacity() to keep it).
          * @param size Integer with the number of T element to be allocated. E.g., size = 5 is internally similar to
          * `new T[5]`.
          */
@@ -167,6 +177,13 @@ namespace op
          */
         void reset(const std::vector<int>& sizes = {});
 
+        /**
+         * Similar to reset() (i.e., it empties the Array), but it keeps its current memory (if this Array is its only
+         * owner), so the next reset() can re-use it rather than allocating new memory. Used by DatumPool to recycle
+         * the Datum buffers across frames.
+         */
+        void emptyKeepingCapacity();
+
         /**
          * Data allocation function.
          * Similar to reset(const int size), but initializing the data to the value specified by the second argument.
@@ -479,6 +496,7 @@ namespace op
         size_t mVolume;
         std::shared_ptr<T> spData;
         T* pData; // pData is a wrapper of spData. Used for Pybind11 binding.
+        size_t mCapacity; // Number of T elements allocated in spData (it might be bigger than mVolume)
         std::pair<bool, Matrix> mCvMatData;
 
         /**
@@ -506,7 +524,8 @@ namespace op
          */
         T& commonAt(const int index) const;
 
-        void resetAuxiliary(const std::vector<int>& sizes, T* const dataPtr = nullptr);
+        void resetAuxiliary(
+            const std::vector<int>& sizes, T* const dataPtr = nullptr, const bool keepCapacity = false);
     };
 
     // Static methods
@@ -0,0 +1,81 @@
+#ifndef OPENPOSE_CORE_ARRAY_ALLOCATOR_HPP
+#define OPENPOSE_CORE_ARRAY_ALLOCATOR_HPP
+
+#include <cstddef> // std::size_t
+#include <openpose/core/macros.hpp>
+
+namespace op
+{
+    /**
+     * Memory statistics of the Array allocator (accumulated over all threads).
+     */
+    struct OP_API ArrayAllocatorStatistics
+    {
+        unsigned long long hits;        // Allocations served from a pool
+        unsigned long long misses;      // Allocations that required a new memory block
+        unsigned long long usedBytes;   // Bytes currently owned by Arrays
+        unsigned long long peakBytes;   // Maximum value of usedBytes
+        unsigned long long pooledBytes; // Bytes currently idle in the pools
+    };
+
+    /**
+     * Allocator of the Array data memory.
+     * By default, memory blocks are 64-byte aligned (so SIMD kernels can assume aligned data) and recycled through
+     * thread-local size-class pools: Blocks are rounded up to the next power of two and, when released, kept by the
+     * releasing thread for the next allocation of the same size class. Thus, the temporary Arrays created on each
+     * frame (e.g., KeepTopNPeople, getKeypointsPerson, keypoint scaling) do not call malloc in steady state. Blocks
+     * bigger than the biggest size class (e.g., full heat maps) are directly allocated and freed.
+     * Blocks released by a thread different than the allocating one are kept by the releasing thread, so
+     * producer-consumer pipelines are bounded by the maximum bytes per thread pool rather than recycled.
+     */
+    namespace ArrayAllocator
+    {
+        // Alignment (in bytes) of any memory block returned by allocate()
+        const std::size_t Alignment = 64;
+
+        typedef void* (*AllocateFunction)(const std::size_t bytes);
+        typedef void (*DeallocateFunction)(void* const ptr, const std::size_t bytes);
+
+        /**
+         * Default (pooled) allocator. It returns a memory block of at least `bytes` bytes, aligned to Alignment.
+         * It never returns nullptr (an exception is thrown instead).
+         */
+        OP_API void* allocate(const std::size_t bytes);
+
+        /**
+         * Default (pooled) deallocator. `ptr` must have been returned by allocate(bytes).
+         */
+        OP_API void deallocate(void* const ptr, const std::size_t bytes);
+
+        /**
+         * Pluggable allocator: It replaces the default pooled allocator for any new Array memory. Passing nullptr for
+         * both functions restores the default one. Each memory block keeps the deallocation function of the
+         * allocator that created it, so blocks allocated before the change are still correctly released.
+         * This function is not thread-safe. It must be run at the beginning (and custom functions must be
+         * thread-safe).
+         */
+        OP_API void setAllocator(const AllocateFunction allocateFunction, const DeallocateFunction deallocateFunction);
+
+        // Current allocation function (allocate() unless a custom one was set)
+        OP_API AllocateFunction getAllocateFunction();
+
+        // Current deallocation function (deallocate() unless a custom one was set)
+        OP_API DeallocateFunction getDeallocateFunction();
+
+        /**
+         * It enables or disables the recycling of the default allocator (enabled by default). If disabled, blocks are
+         * still 64-byte aligned, but they are always allocated and freed.
+         */
+        OP_API void setPoolEnabled(const bool poolEnabled);
+
+        // Statistics of the default allocator (custom allocators are not tracked)
+        OP_API ArrayAllocatorStatistics getStatistics();
+
+        /**
+         * It resets hits and misses, and sets peakBytes to the current usedBytes.
+         */
+        OP_API void resetStatistics();
+    }
+}
+
+#endif // OPENPOSE_CORE_ARRAY_ALLOCATOR_HPP
@@ -17,9 +17,27 @@ namespace op
             const Matrix& inputData, const std::vector<double>& scaleInputToNetInputs,
             const std::vector<Point<int>>& netInputSizes);
 
+        /**
+         * Same than createArray(), but filling inputNetData in-place, re-using its memory when possible.
+         */
+        void createArray(
+            std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+            const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes);
+
+        /**
+         * Same than createArray(), but resizing and normalizing the frame directly into the memory of inputNetData,
+         * which must be already allocated with the sizes {1, 3, height, width} given by netInputSizes (e.g., the
+         * network input memory given by PoseExtractor::getInputNetDataArrays()). Thus, no intermediate float buffer
+         * is allocated nor copied. It always runs on CPU.
+         */
+        void fillArray(
+            std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+            const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes);
+
     private:
         const PoseModel mPoseModel;
         const bool mGpuResize;
+        Matrix mFrameWithNetSize;
         unsigned char* pInputImageCuda;
         float* pInputImageReorderedCuda;
         float* pOutputImageCuda;
@@ -18,8 +18,16 @@ namespace op
         Array<float> createArray(
             const Matrix& inputData, const double scaleInputToOutput, const Point<int>& outputResolution);
 
+        /**
+         * Same than createArray(), but filling outputData in-place, re-using its memory when possible.
+         */
+        void createArray(
+            Array<float>& outputData, const Matrix& inputData, const double scaleInputToOutput,
+            const Point<int>& outputResolution);
+
     private:
         const bool mGpuResize;
+        Matrix mFrameWithOutputSize;
         unsigned char* pInputImageCuda;
         std::shared_ptr<float*> spOutputImageCuda;
         unsigned long long pInputMaxSize;
@@ -37,6 +37,13 @@ namespace op
          */
         unsigned long long frameNumber;
 
+        /**
+         * Capture time of the frame (in nanoseconds, see getSteadyTimeNanoseconds()), used to know its age (i.e.,
+         * its latency so far) at any point of the pipeline (e.g., WLatencyGuard).
+         * It is filled by the OpenPose producers or, if 0 (e.g., custom input), by WIdGenerator.
+         */
+        unsigned long long captureNanoseconds;
+
         // ------------------------------ Input image and rendered version parameters ------------------------------ //
         /**
          * Original image to be processed in cv::Mat uchar format.
@@ -52,6 +59,8 @@ namespace op
          * scales are sorted from bigger to smaller.
          * Vector size: #scales
          * Each array size: 3 x input_net_height x input_net_width
+         * In CPU-only builds, the input is preprocessed directly into the network input memory, so this element is
+         * left empty (see WPoseExtractor).
          */
         std::vector<Array<float>> inputNetData;
 
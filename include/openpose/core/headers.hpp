@@ -3,6 +3,7 @@
 
 // core module
 #include <openpose/core/array.hpp>
+#include <openpose/core/arrayAllocator.hpp>
 #include <openpose/core/arrayCpuGpu.hpp>
 #include <openpose/core/common.hpp>
 #include <openpose/core/cvMatToOpInput.hpp>
@@ -12,6 +13,7 @@
 #include <openpose/core/gpuRenderer.hpp>
 #include <openpose/core/keepTopNPeople.hpp>
 #include <openpose/core/keypointScaler.hpp>
+#include <openpose/core/keypointStabilityCache.hpp>
 #include <openpose/core/macros.hpp>
 #include <openpose/core/matrix.hpp>
 #include <openpose/core/opOutputToCvMat.hpp>
@@ -27,6 +29,7 @@
 #include <openpose/core/wKeypointScaler.hpp>
 #include <openpose/core/wOpOutputToCvMat.hpp>
 #include <openpose/core/wScaleAndSizeExtractor.hpp>
+#include <openpose/core/wScaleAndSizeUpdater.hpp>
 #include <openpose/core/wVerbosePrinter.hpp>
 
 #endif // OPENPOSE_CORE_HEADERS_HPP
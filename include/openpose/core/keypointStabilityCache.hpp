@@ -0,0 +1,70 @@
+#ifndef OPENPOSE_CORE_KEYPOINT_STABILITY_CACHE_HPP
+#define OPENPOSE_CORE_KEYPOINT_STABILITY_CACHE_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Cache of the keypoints estimated on crops (e.g., face or hand networks), so they can be re-used while the
+     * person is still. Each crop of the current frame is matched to the closest crop of the previous frame. If the
+     * crop rectangle (which is driven by the body keypoints) barely moved and the crop appearance barely changed
+     * since the last network run, the cached keypoints are motion-compensated to the new rectangle and re-used.
+     * Each person re-uses them for a limited number of consecutive frames (refresh budget), after which the network
+     * must be run again.
+     * Not thread-safe (each extractor must have its own instance).
+     */
+    class OP_API KeypointStabilityCache
+    {
+    public:
+        /**
+         * @param maximumReusedFrames Maximum number of consecutive frames that a person can re-use its cached
+         * keypoints before the network is run again.
+         * @param maximumMotion Maximum displacement of the rectangle center and maximum change of its size, both
+         * relative to the rectangle size.
+         * @param maximumAppearanceChange Maximum mean absolute difference between the low-resolution thumbnails of
+         * the network input crops (in network input units, i.e., 1/256 per intensity level).
+         */
+        explicit KeypointStabilityCache(
+            const int maximumReusedFrames, const float maximumMotion = 0.05f,
+            const float maximumAppearanceChange = 0.02f);
+
+        virtual ~KeypointStabilityCache();
+
+        /**
+         * It must be called once at the beginning of each frame. Previous-frame people not found in the last frame
+         * are removed.
+         */
+        void newFrame();
+
+        /**
+         * If the person was cached and is still, it fills keypointsPtr with its cached keypoints (motion-compensated
+         * to rectangle) and returns true. Otherwise, it returns false, and the network must be run (followed by
+         * update()).
+         * @param keypointsPtr Pointer to the (#keypoints x 3) keypoints of the person.
+         * @param netInputCrop Network input (1 x channels x height x width) for this person crop.
+         */
+        bool reuse(
+            float* keypointsPtr, const int numberKeypoints, const Rectangle<float>& rectangle,
+            const Array<float>& netInputCrop);
+
+        /**
+         * It caches the keypoints just estimated by the network for this person.
+         */
+        void update(
+            const float* const keypointsPtr, const int numberKeypoints, const Rectangle<float>& rectangle,
+            const Array<float>& netInputCrop);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplKeypointStabilityCache;
+        std::unique_ptr<ImplKeypointStabilityCache> upImpl;
+
+        // PIMP requires DELETE_COPY & destructor, or extra code
+        // http://oliora.github.io/2015/12/29/pimpl-and-rule-of-zero.html
+        DELETE_COPY(KeypointStabilityCache);
+    };
+}
+
+#endif // OPENPOSE_CORE_KEYPOINT_STABILITY_CACHE_HPP
@@ -1,6 +1,7 @@
 #ifndef OPENPOSE_CORE_SCALE_AND_SIZE_EXTRACTOR_HPP
 #define OPENPOSE_CORE_SCALE_AND_SIZE_EXTRACTOR_HPP
 
+#include <atomic>
 #include <tuple>
 #include <openpose/core/common.hpp>
 
@@ -9,20 +10,56 @@ namespace op
     class OP_API ScaleAndSizeExtractor
     {
     public:
+        /**
+         * @param adaptiveMinPersonHeight If > 0, it enables the adaptive net input resolution: the net input size
+         * is reduced (among a few fixed levels, e.g., 100%, 75% and 50% of netInputResolution) while the smallest
+         * person detected in the last frames is at least this height (in net input pixels). It requires calling
+         * update() with the resulting keypoints of each frame (e.g., with WScaleAndSizeUpdater).
+         * @param netInputSizeBuckets Shape bucketing: If not empty, the free (i.e., -1) dimension of
+         * netInputResolution is rounded up to the closest of these sizes (in pixels, multiples of 16), and the
+         * remaining area is padded. Thus, inputs of different resolutions (e.g., an image directory) lead to only a
+         * few network input sizes, rather than a network reshape for almost each frame. Sizes bigger than the
+         * biggest bucket are not modified.
+         */
         ScaleAndSizeExtractor(const Point<int>& netInputResolution, const float netInputResolutionDynamicBehavior,
-            const Point<int>& outputResolution, const int scaleNumber = 1, const double scaleGap = 0.25);
+            const Point<int>& outputResolution, const int scaleNumber = 1, const double scaleGap = 0.25,
+            const float adaptiveMinPersonHeight = 0.f, const std::vector<int>& netInputSizeBuckets = {});
 
         virtual ~ScaleAndSizeExtractor();
 
         std::tuple<std::vector<double>, std::vector<Point<int>>, double, Point<int>> extract(
             const Point<int>& inputResolution) const;
 
+        /**
+         * Adaptive net input resolution feedback. It might be called from a different thread than extract(), but
+         * always from the same one.
+         * @param poseKeypoints Keypoints of the last processed frame, in input resolution pixels (i.e., before
+         * KeypointScaler).
+         * @param inputResolution Resolution of the frame of those keypoints.
+         */
+        void update(const Array<float>& poseKeypoints, const Point<int>& inputResolution);
+
     private:
         const Point<int> mNetInputResolution;
         const float mNetInputResolutionDynamicBehavior;
         const Point<int> mOutputSize;
         const int mScaleNumber;
         const double mScaleGap;
+        const float mAdaptiveMinPersonHeight;
+        // Shape bucketing - Sorted in ascending order
+        const std::vector<int> mNetInputSizeBuckets;
+        // Adaptive resolution - Read by extract(), only written by update()
+        std::atomic<int> mAdaptiveLevel;
+        // Adaptive resolution - Only used by update()
+        int mAdaptiveCandidateLevel;
+        int mAdaptiveCandidateCounter;
+        int mAdaptiveLastNumberPeople;
+
+        Point<int> getPoseNetInputSize(const Point<int>& inputResolution) const;
+
+        Point<int> getBucketedNetInputSize(const Point<int>& poseNetInputSize) const;
+
+        DELETE_COPY(ScaleAndSizeExtractor);
     };
 }
 
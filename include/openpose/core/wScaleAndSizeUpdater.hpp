@@ -0,0 +1,93 @@
+#ifndef OPENPOSE_CORE_W_SCALE_AND_SIZE_UPDATER_HPP
+#define OPENPOSE_CORE_W_SCALE_AND_SIZE_UPDATER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/core/scaleAndSizeExtractor.hpp>
+#include <openpose/thread/worker.hpp>
+
+namespace op
+{
+    /**
+     * Feeds the resulting pose keypoints back to the ScaleAndSizeExtractor (adaptive net input resolution). It must
+     * be placed after pose estimation (and after any WQueueOrderer) but before the KeypointScaler.
+     */
+    template<typename TDatums>
+    class WScaleAndSizeUpdater : public Worker<TDatums>
+    {
+    public:
+        explicit WScaleAndSizeUpdater(const std::shared_ptr<ScaleAndSizeExtractor>& scaleAndSizeExtractor);
+
+        virtual ~WScaleAndSizeUpdater();
+
+        void initializationOnThread();
+
+        void work(TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<ScaleAndSizeExtractor> spScaleAndSizeExtractor;
+
+        DELETE_COPY(WScaleAndSizeUpdater);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WScaleAndSizeUpdater<TDatums>::WScaleAndSizeUpdater(
+        const std::shared_ptr<ScaleAndSizeExtractor>& scaleAndSizeExtractor) :
+        spScaleAndSizeExtractor{scaleAndSizeExtractor}
+    {
+    }
+
+    template<typename TDatums>
+    WScaleAndSizeUpdater<TDatums>::~WScaleAndSizeUpdater()
+    {
+    }
+
+    template<typename TDatums>
+    void WScaleAndSizeUpdater<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WScaleAndSizeUpdater<TDatums>::work(TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // Keypoints -> adaptive net input resolution
+                for (auto& tDatumPtr : *tDatums)
+                {
+                    const Point<int> inputSize{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()};
+                    spScaleAndSizeExtractor->update(tDatumPtr->poseKeypoints, inputSize);
+                }
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            tDatums = nullptr;
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WScaleAndSizeUpdater);
+}
+
+#endif // OPENPOSE_CORE_W_SCALE_AND_SIZE_UPDATER_HPP
@@ -8,7 +8,14 @@ namespace op
     class OP_API FaceDetectorOpenCV
     {
     public:
-        explicit FaceDetectorOpenCV(const std::string& modelFolder);
+        /**
+         * @param fullFramePeriod If 0 (default), the whole frame is processed on each detectFaces() call. Otherwise
+         * (for consecutive video frames), the whole frame is only processed (split into parallel stripes) every
+         * fullFramePeriod frames, and only the regions around the faces detected in the previous frame (and at
+         * their scale) are processed in the remaining frames. The grayscale image pyramid is computed once per
+         * frame and its memory is re-used across frames.
+         */
+        explicit FaceDetectorOpenCV(const std::string& modelFolder, const int fullFramePeriod = 0);
 
         virtual ~FaceDetectorOpenCV();
 
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <openpose/core/common.hpp>
 #include <openpose/core/enumClasses.hpp>
+#include <openpose/core/keypointStabilityCache.hpp>
 
 namespace op
 {
@@ -17,10 +18,13 @@ namespace op
          * Constructor of the FaceExtractorNet class.
          * @param netInputSize Size at which the cropped image (where the face is located) is resized.
          * @param netOutputSize Size of the final results. At the moment, it must be equal than netOutputSize.
+         * @param reuseFrames If > 0, the keypoints of still faces are re-used (motion-compensated) for up to this
+         * number of consecutive frames rather than running the network again (see KeypointStabilityCache).
          */
         explicit FaceExtractorNet(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                   const std::vector<HeatMapType>& heatMapTypes = {},
-                                  const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect);
+                                  const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect,
+                                  const int reuseFrames = 0);
 
         /**
          * Virtual destructor of the HandExtractor class.
@@ -69,6 +73,8 @@ namespace op
         const std::vector<HeatMapType> mHeatMapTypes;
         // Temporarily disable it
         std::atomic<bool> mEnabled;
+        // Keypoint re-use for still faces (nullptr if disabled)
+        std::shared_ptr<KeypointStabilityCache> spKeypointStabilityCache;
 
         virtual void netInitializationOnThread() = 0;
 
@@ -66,8 +66,8 @@ namespace op
                 for (auto& tDatumPtr : *tDatums)
                 {
                     spFaceExtractorNet->forwardPass(tDatumPtr->faceRectangles, tDatumPtr->cvInputData);
-                    tDatumPtr->faceHeatMaps = spFaceExtractorNet->getHeatMaps().clone();
-                    tDatumPtr->faceKeypoints = spFaceExtractorNet->getFaceKeypoints().clone();
+                    spFaceExtractorNet->getHeatMaps().copyTo(tDatumPtr->faceHeatMaps);
+                    spFaceExtractorNet->getFaceKeypoints().copyTo(tDatumPtr->faceKeypoints);
                 }
                 // Profiling speed
                 Profiler::timerEnd(profilerKey);
@@ -9,9 +9,12 @@
 #include <openpose/filestream/fileStream.hpp>
 #include <openpose/filestream/heatMapSaver.hpp>
 #include <openpose/filestream/imageSaver.hpp>
+#include <openpose/filestream/imageWriterPool.hpp>
 #include <openpose/filestream/jsonOfstream.hpp>
 #include <openpose/filestream/keypointSaver.hpp>
+#include <openpose/filestream/netOutputSaver.hpp>
 #include <openpose/filestream/peopleJsonSaver.hpp>
+#include <openpose/filestream/sharedMemorySender.hpp>
 #include <openpose/filestream/udpSender.hpp>
 #include <openpose/filestream/videoSaver.hpp>
 #include <openpose/filestream/wBvhSaver.hpp>
@@ -20,8 +23,10 @@
 #include <openpose/filestream/wHandSaver.hpp>
 #include <openpose/filestream/wImageSaver.hpp>
 #include <openpose/filestream/wHeatMapSaver.hpp>
+#include <openpose/filestream/wNetOutputSaver.hpp>
 #include <openpose/filestream/wPeopleJsonSaver.hpp>
 #include <openpose/filestream/wPoseSaver.hpp>
+#include <openpose/filestream/wSharedMemorySender.hpp>
 #include <openpose/filestream/wUdpSender.hpp>
 #include <openpose/filestream/wVideoSaver.hpp>
 #include <openpose/filestream/wVideoSaver3D.hpp>
@@ -3,13 +3,20 @@
 
 #include <openpose/core/common.hpp>
 #include <openpose/filestream/fileSaver.hpp>
+#include <openpose/filestream/imageWriterPool.hpp>
 
 namespace op
 {
     class OP_API HeatMapSaver : public FileSaver
     {
     public:
-        HeatMapSaver(const std::string& directoryPath, const std::string& imageFormat);
+        /**
+         * @param imageWriterPool If not nullptr, images are saved in parallel by its encoder threads (it can be
+         * shared among several savers). Otherwise, they are synchronously saved in saveHeatMaps().
+         */
+        HeatMapSaver(
+            const std::string& directoryPath, const std::string& imageFormat,
+            const std::shared_ptr<ImageWriterPool>& imageWriterPool = nullptr);
 
         virtual ~HeatMapSaver();
 
@@ -17,6 +24,7 @@ namespace op
 
     private:
         const std::string mImageFormat;
+        const std::shared_ptr<ImageWriterPool> spImageWriterPool;
     };
 }
 
@@ -0,0 +1,62 @@
+#ifndef OPENPOSE_FILESTREAM_IMAGE_WRITER_POOL_HPP
+#define OPENPOSE_FILESTREAM_IMAGE_WRITER_POOL_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Thread pool that encodes and saves images (i.e., cv::imwrite) in parallel, so ImageSaver and HeatMapSaver
+     * (which can share the same pool) do not block their worker while PNG/JPG compressing each image.
+     * Images might finish out of order, but getWrittenCount() keeps track of how many of them are completely written
+     * in order. The destructor waits until all the queued images are saved, and it logs the encoding speed of each
+     * image format.
+     */
+    class OP_API ImageWriterPool
+    {
+    public:
+        /**
+         * @param numberThreads Number of encoder threads. If 0, each image is synchronously saved inside write().
+         * If < 0, the number of hardware threads of the machine.
+         * @param maxMemoryMB Maximum memory (in MB) of the images queued or being encoded. write() blocks while it
+         * is exceeded (an image bigger than it is still accepted if no other image is in flight).
+         * @param pngCompression PNG compression level, in the range [0, 9]. 9 (default) generates the smallest files
+         * but it is also the slowest one (e.g., 1 is several times faster at the cost of bigger files).
+         * @param jpgQuality JPG quality, in the range [0, 100].
+         */
+        ImageWriterPool(
+            const int numberThreads = 0, const int maxMemoryMB = 512, const int pngCompression = 9,
+            const int jpgQuality = 100);
+
+        virtual ~ImageWriterPool();
+
+        /**
+         * Queues an image to be saved as fullFilePath (its extension determines the image format). Any previous
+         * encoding error is thrown here.
+         * @param copyMatrix If false, the caller must not modify the matrix memory after this call (e.g., a matrix
+         * that was created only to be saved).
+         * @return Index of the image (0 for the 1st image written with this pool, 1 for the 2nd one, etc.).
+         */
+        unsigned long long write(const Matrix& matrix, const std::string& fullFilePath, const bool copyMatrix = true);
+
+        /**
+         * All the images with index lower than the returned value are already saved on disk.
+         */
+        unsigned long long getWrittenCount() const;
+
+        /**
+         * It blocks until all the queued images are saved on disk.
+         */
+        void flush();
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplImageWriterPool;
+        std::unique_ptr<ImplImageWriterPool> upImpl;
+
+        DELETE_COPY(ImageWriterPool);
+    };
+}
+
+#endif // OPENPOSE_FILESTREAM_IMAGE_WRITER_POOL_HPP
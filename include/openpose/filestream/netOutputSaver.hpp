@@ -0,0 +1,51 @@
+#ifndef OPENPOSE_FILESTREAM_NET_OUTPUT_SAVER_HPP
+#define OPENPOSE_FILESTREAM_NET_OUTPUT_SAVER_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Net output files (`--write_net_output`, read back by NetOutputReader) are binary files with the native
+     * endianness of the recording machine:
+     *   - Header: NET_OUTPUT_FILE_MAGIC (8 chars) + NET_OUTPUT_FILE_VERSION (uint32).
+     *   - 1 record per frame: frameNumber (uint64), name size (uint32) + name chars, input resolution (2x int32,
+     *     width and height), net input size (uint32 number of dimensions + int32 dimensions), scaleInputToNetInput
+     *     (float64), and net output (uint32 number of dimensions + int32 dimensions + float32 data).
+     */
+    const char NET_OUTPUT_FILE_MAGIC[] = "OPNETOUT";
+    const auto NET_OUTPUT_FILE_VERSION = 1u;
+
+    /**
+     * Raw network output of 1 frame plus the input frame metadata required to replay it.
+     */
+    struct OP_API NetOutputRecord
+    {
+        unsigned long long frameNumber;
+        std::string name;
+        Point<int> inputResolution;
+        std::vector<int> netInputSize;
+        double scaleInputToNetInput;
+        Array<float> netOutput;
+    };
+
+    class OP_API NetOutputSaver
+    {
+    public:
+        explicit NetOutputSaver(const std::string& filePath);
+
+        virtual ~NetOutputSaver();
+
+        void write(const NetOutputRecord& netOutputRecord);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplNetOutputSaver;
+        std::unique_ptr<ImplNetOutputSaver> upImpl;
+
+        DELETE_COPY(NetOutputSaver);
+    };
+}
+
+#endif // OPENPOSE_FILESTREAM_NET_OUTPUT_SAVER_HPP
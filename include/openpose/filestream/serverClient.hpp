@@ -0,0 +1,95 @@
+#ifndef OPENPOSE_FILESTREAM_SERVER_CLIENT_HPP
+#define OPENPOSE_FILESTREAM_SERVER_CLIENT_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <openpose/filestream/serverProtocol.h>
+
+namespace op
+{
+    /**
+     * Result of a single request of ServerClient. poseIds and poseScores are empty if the server did not send them.
+     */
+    struct ServerResult
+    {
+        unsigned long long requestId;
+        int status;                         /* OP_SERVER_OK or OP_SERVER_ERROR_X */
+        unsigned int numberPeople;
+        unsigned int numberBodyParts;
+        std::vector<float> poseKeypoints;   /* [numberPeople][numberBodyParts][3] */
+        std::vector<long long> poseIds;     /* [numberPeople] */
+        std::vector<float> poseScores;      /* [numberPeople] */
+        unsigned long long serverNanoseconds;
+    };
+
+    /**
+     * Minimal C++ client of the OpenPose inference server (`openpose_server`, see serverProtocol.h). It does not
+     * depend on OpenPose, only on this header, serverProtocol.h, and the `openpose_server_client` library (or
+     * serverClient.cpp copied into the consumer project).
+     * Requests are pipelined: any number of sendX() calls can be done before receiving their results, so the server
+     * can process several frames of the same client at the same time (e.g., in different GPUs).
+     * sendX() and receive() can be called from 2 different threads (1 sender and 1 receiver), but each one of them
+     * must only be called from 1 thread at a time. All functions throw std::runtime_error on socket errors.
+     *
+     * Usage:
+     *     op::ServerClient client{"/tmp/openpose.sock"};
+     *     client.sendEncoded(jpegBytes.data(), jpegBytes.size());
+     *     op::ServerResult result;
+     *     if (client.receive(result) && result.status == OP_SERVER_OK)
+     *         process(result.poseKeypoints, result.numberPeople, result.numberBodyParts);
+     */
+    class ServerClient
+    {
+    public:
+        /**
+         * It connects to the server listening in socketPath (e.g., `--server_socket` of `openpose_server`).
+         */
+        explicit ServerClient(const std::string& socketPath);
+
+        virtual ~ServerClient();
+
+        /**
+         * It sends a raw BGR image (8-bit, 3 channels).
+         * @param step Bytes between consecutive rows (0 means cols * 3, i.e., no padding).
+         * @return Request id, it matches the requestId of its ServerResult.
+         */
+        unsigned long long sendRaw(
+            const unsigned char* const bgr, const unsigned int rows, const unsigned int cols,
+            const unsigned long long step = 0ull);
+
+        /**
+         * It sends an encoded image (e.g., the bytes of a JPEG file).
+         * @return Request id, it matches the requestId of its ServerResult.
+         */
+        unsigned long long sendEncoded(const unsigned char* const data, const unsigned long long size);
+
+        /**
+         * It blocks until the next response arrives.
+         * @return False if the server closed the connection (i.e., no more results will arrive).
+         */
+        bool receive(ServerResult& result);
+
+        /**
+         * It stops sending requests (the server still answers the ones already sent, which can be received).
+         */
+        void shutdownSend();
+
+        bool isConnected() const;
+
+    private:
+        int mSocket;
+        unsigned long long mNextRequestId;
+        std::mutex mSendMutex;
+
+        void sendHeaderAndPayload(
+            OpServerRequestHeader& header, const unsigned char* const payload, const unsigned long long payloadSize,
+            const unsigned int rows, const unsigned long long step);
+
+        ServerClient(const ServerClient&) = delete;
+        ServerClient& operator=(const ServerClient&) = delete;
+    };
+}
+
+#endif // OPENPOSE_FILESTREAM_SERVER_CLIENT_HPP
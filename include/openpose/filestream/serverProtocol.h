@@ -0,0 +1,84 @@
+#ifndef OPENPOSE_FILESTREAM_SERVER_PROTOCOL_H
+#define OPENPOSE_FILESTREAM_SERVER_PROTOCOL_H
+
+/*
+ * Binary protocol of the OpenPose inference server (`openpose_server`, see examples/server/) over a Unix domain
+ * stream socket. This header is plain C so that clients do not need to link OpenPose (see serverClient.hpp for the
+ * reference C++ client).
+ *
+ * Messages (native endianness, the client and the server run in the same machine):
+ *     - Request:  OpServerRequestHeader + payloadSize bytes (the image).
+ *     - Response: OpServerResponseHeader + payloadSize bytes (the keypoints).
+ *
+ * Pipelining: a client can send many requests without waiting for their responses. Each request gets exactly 1
+ * response with its same requestId (chosen by the client). Successful responses of a connection are sent in the same
+ * order as their requests, but error responses are sent right away, so clients should rely on requestId rather than
+ * on the order.
+ *
+ * Request payload:
+ *     - OP_SERVER_FORMAT_BGR:     uint8 [rows][cols][3] (BGR, row-major, no padding between rows)
+ *     - OP_SERVER_FORMAT_ENCODED: encoded image (JPEG, PNG, or any other format readable by cv::imdecode). rows and
+ *                                 cols are ignored.
+ *
+ * Response payload (only if status == OP_SERVER_OK, arrays packed consecutively with no padding):
+ *     - poseKeypoints: float  [numberPeople][numberBodyParts][3] (x, y, score)
+ *     - poseIds:       int64  [numberPeople] (only if flags & OP_SERVER_FLAG_POSE_IDS)
+ *     - poseScores:    float  [numberPeople] (only if flags & OP_SERVER_FLAG_POSE_SCORES)
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* "OPRQ" and "OPRS" */
+#define OP_SERVER_REQUEST_MAGIC     0x5152504Fu
+#define OP_SERVER_RESPONSE_MAGIC    0x5352504Fu
+/* Increased whenever the layout of OpServerRequestHeader or OpServerResponseHeader changes */
+#define OP_SERVER_VERSION           1u
+
+/* OpServerRequestHeader.format */
+#define OP_SERVER_FORMAT_BGR        0u
+#define OP_SERVER_FORMAT_ENCODED    1u
+
+/* OpServerResponseHeader.status */
+#define OP_SERVER_OK                0
+#define OP_SERVER_ERROR_REQUEST    -1   /* Unknown format or payload size not matching rows x cols x 3 */
+#define OP_SERVER_ERROR_DECODE     -2   /* The encoded image could not be decoded */
+#define OP_SERVER_ERROR_SHUTDOWN   -3   /* The server is stopping, the request was not processed */
+
+/* OpServerResponseHeader.flags */
+#define OP_SERVER_FLAG_POSE_IDS     0x1u
+#define OP_SERVER_FLAG_POSE_SCORES  0x2u
+
+typedef struct OpServerRequestHeader
+{
+    uint32_t magic;             /* OP_SERVER_REQUEST_MAGIC */
+    uint32_t version;           /* OP_SERVER_VERSION */
+    uint64_t requestId;         /* Chosen by the client, returned in its response */
+    uint32_t format;            /* OP_SERVER_FORMAT_X */
+    uint32_t rows;              /* Only for OP_SERVER_FORMAT_BGR */
+    uint32_t cols;              /* Only for OP_SERVER_FORMAT_BGR */
+    uint32_t reserved;
+    uint64_t payloadSize;       /* Bytes after this header */
+} OpServerRequestHeader;
+
+typedef struct OpServerResponseHeader
+{
+    uint32_t magic;             /* OP_SERVER_RESPONSE_MAGIC */
+    uint32_t version;           /* OP_SERVER_VERSION */
+    uint64_t requestId;
+    int32_t status;             /* OP_SERVER_OK or OP_SERVER_ERROR_X */
+    uint32_t flags;             /* OP_SERVER_FLAG_X */
+    uint32_t numberPeople;
+    uint32_t numberBodyParts;
+    uint64_t serverNanoseconds; /* Time in the server, from the request being received until its response is sent */
+    uint64_t payloadSize;       /* Bytes after this header */
+} OpServerResponseHeader;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPENPOSE_FILESTREAM_SERVER_PROTOCOL_H */
@@ -0,0 +1,100 @@
+#ifndef OPENPOSE_FILESTREAM_SHARED_MEMORY_PROTOCOL_H
+#define OPENPOSE_FILESTREAM_SHARED_MEMORY_PROTOCOL_H
+
+/*
+ * Memory layout of the POSIX shared-memory segment written by op::SharedMemorySender (`--write_shared_memory`).
+ * This header is plain C so that external processes can read the segment without linking OpenPose (see
+ * sharedMemoryReader.h for the reference reader).
+ *
+ * Segment = OpShmHeader + numberSlots x slot, where each slot (slotSize bytes) is an OpShmSlotHeader followed by
+ * its payload. All offsets inside a slot are relative to the beginning of that slot. Frames are written in a ring:
+ * frame k (0-based publish counter) goes to slot k % numberSlots. Thus, while frame writeCounter is being written,
+ * only the last numberSlots - 1 published frames are readable, so numberSlots is always at least 2.
+ *
+ * Synchronization (single writer, any number of readers, lock-free):
+ *     - OpShmSlotHeader.sequence is a sequence lock: it is odd while the writer is filling the slot and even once
+ *       the slot is stable. A reader copies the slot and accepts the copy only if `sequence` was even and did not
+ *       change during the copy.
+ *     - OpShmHeader.writeCounter is the number of frames published so far (i.e., frame writeCounter-1 is the
+ *       latest one), updated after the slot sequence is made even again.
+ * Both counters must be accessed atomically (acquire loads and release stores).
+ *
+ * Payload arrays (each one 8-byte aligned, row-major, native endianness):
+ *     - poseKeypoints:  float  [numberPeople][numberBodyParts][3] (x, y, score)
+ *     - poseIds:        int64  [numberPeople] (only if flags & OP_SHM_FLAG_POSE_IDS)
+ *     - poseScores:     float  [numberPeople] (only if flags & OP_SHM_FLAG_POSE_SCORES)
+ *     - faceKeypoints:  float  [numberPeople][numberFaceParts][3]
+ *     - handKeypoints:  float  [2][numberPeople][numberHandParts][3] (left hand first, then right hand)
+ *     - image:          uint8  [imageRows][imageCols][imageChannels] (BGR, only if flags & OP_SHM_FLAG_IMAGE)
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* "OPSM" */
+#define OP_SHM_MAGIC 0x4D53504Fu
+/* Increased whenever the layout of OpShmHeader or OpShmSlotHeader changes */
+#define OP_SHM_VERSION 1u
+
+/* OpShmSlotHeader.flags */
+#define OP_SHM_FLAG_POSE_IDS      0x1u
+#define OP_SHM_FLAG_POSE_SCORES   0x2u
+#define OP_SHM_FLAG_IMAGE         0x4u
+/* The frame did not fit into the slot: the image was skipped and/or numberPeople was clamped */
+#define OP_SHM_FLAG_TRUNCATED     0x8u
+
+/* OpShmHeader.state */
+#define OP_SHM_STATE_INITIALIZING 0u
+#define OP_SHM_STATE_RUNNING      1u
+#define OP_SHM_STATE_CLOSED       2u
+
+typedef struct OpShmHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;        /* sizeof(OpShmHeader) of the writer */
+    uint32_t slotHeaderSize;    /* sizeof(OpShmSlotHeader) of the writer */
+    uint32_t numberSlots;
+    uint32_t state;             /* OP_SHM_STATE_X, atomic */
+    uint64_t slotSize;          /* Bytes per slot, including its OpShmSlotHeader */
+    uint64_t slotsOffset;       /* Offset of the first slot from the beginning of the segment */
+    uint64_t writeCounter;      /* Number of published frames, atomic */
+    int64_t writerPid;
+    uint64_t reserved[8];
+} OpShmHeader;
+
+typedef struct OpShmSlotHeader
+{
+    uint64_t sequence;          /* Sequence lock (odd = being written), atomic */
+    uint64_t frameCounter;      /* Publish counter of the frame stored in this slot */
+    uint64_t id;                /* op::Datum::id */
+    uint64_t subId;             /* op::Datum::subId (camera index in multi-view mode) */
+    uint64_t subIdMax;          /* op::Datum::subIdMax */
+    uint64_t frameNumber;       /* op::Datum::frameNumber */
+    int64_t timestampNs;        /* Publish time (CLOCK_REALTIME) in nanoseconds */
+    uint32_t flags;             /* OP_SHM_FLAG_X */
+    uint32_t numberPeople;
+    uint32_t numberBodyParts;
+    uint32_t numberFaceParts;
+    uint32_t numberHandParts;
+    uint32_t imageRows;
+    uint32_t imageCols;
+    uint32_t imageChannels;
+    uint64_t payloadSize;       /* Bytes used after the OpShmSlotHeader */
+    uint64_t poseKeypointsOffset;
+    uint64_t poseIdsOffset;
+    uint64_t poseScoresOffset;
+    uint64_t faceKeypointsOffset;
+    uint64_t handKeypointsOffset;
+    uint64_t imageOffset;
+    uint64_t reserved[4];
+} OpShmSlotHeader;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPENPOSE_FILESTREAM_SHARED_MEMORY_PROTOCOL_H */
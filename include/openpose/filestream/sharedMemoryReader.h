@@ -0,0 +1,88 @@
+#ifndef OPENPOSE_FILESTREAM_SHARED_MEMORY_READER_H
+#define OPENPOSE_FILESTREAM_SHARED_MEMORY_READER_H
+
+/*
+ * Minimal C reader for the shared-memory output of OpenPose (`--write_shared_memory`). It does not depend on
+ * OpenPose, only on this header, sharedMemoryProtocol.h, and the `openpose_shared_memory_reader` library (or
+ * sharedMemoryReader.c copied into the consumer project).
+ *
+ * Usage:
+ *     int status;
+ *     OpShmReader* reader = op_shm_reader_open("/openpose", &status);
+ *     OpShmFrame frame;
+ *     while (reader != NULL && (status = op_shm_reader_read_next(reader, &frame)) != OP_SHM_CLOSED)
+ *         if (status == OP_SHM_OK)
+ *             process(frame.poseKeypoints, frame.numberPeople, frame.numberBodyParts);
+ *     op_shm_reader_close(reader);
+ *
+ * A reader must only be used from 1 thread at a time. Different processes/threads can open their own readers.
+ */
+
+#include <stdint.h>
+#include <openpose/filestream/sharedMemoryProtocol.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return codes */
+#define OP_SHM_OK                  0
+#define OP_SHM_NO_FRAME            1    /* No new frame published yet, try again later */
+#define OP_SHM_CLOSED              2    /* The writer finished, no more frames will come */
+#define OP_SHM_ERROR              -1    /* Invalid arguments or system error (see errno) */
+#define OP_SHM_ERROR_NOT_FOUND    -2    /* The segment does not exist (yet), OpenPose might not have started */
+#define OP_SHM_ERROR_VERSION      -3    /* Magic number, version or layout do not match this reader */
+#define OP_SHM_ERROR_BUSY         -4    /* The writer kept overwriting the slot while reading it */
+
+typedef struct OpShmReader OpShmReader;
+
+/*
+ * Frame copied from the ring buffer. All pointers point into memory owned by the reader, and are valid until the
+ * next op_shm_reader_read_X or op_shm_reader_close call. Pointers of the missing elements are NULL.
+ */
+typedef struct OpShmFrame
+{
+    uint64_t frameCounter;          /* Publish counter (consecutive for consecutive frames of the writer) */
+    uint64_t droppedFrames;         /* Frames skipped since the previous successful read */
+    uint64_t id;
+    uint64_t subId;
+    uint64_t subIdMax;
+    uint64_t frameNumber;
+    int64_t timestampNs;
+    uint32_t flags;                 /* OP_SHM_FLAG_X */
+    uint32_t numberPeople;
+    uint32_t numberBodyParts;
+    uint32_t numberFaceParts;
+    uint32_t numberHandParts;
+    uint32_t imageRows;
+    uint32_t imageCols;
+    uint32_t imageChannels;
+    const float* poseKeypoints;     /* [numberPeople][numberBodyParts][3] */
+    const int64_t* poseIds;         /* [numberPeople] */
+    const float* poseScores;        /* [numberPeople] */
+    const float* faceKeypoints;     /* [numberPeople][numberFaceParts][3] */
+    const float* leftHandKeypoints; /* [numberPeople][numberHandParts][3] */
+    const float* rightHandKeypoints;/* [numberPeople][numberHandParts][3] */
+    const uint8_t* image;           /* [imageRows][imageCols][imageChannels], BGR */
+} OpShmFrame;
+
+/* Returns NULL on failure, and sets *status (if not NULL) to the OP_SHM_X code */
+OpShmReader* op_shm_reader_open(const char* name, int* status);
+
+void op_shm_reader_close(OpShmReader* reader);
+
+/* Oldest frame not read yet (skipping the ones already overwritten by the writer). Only the last numberSlots - 1
+   frames are guaranteed to be readable, so readers that fall further behind will skip frames */
+int op_shm_reader_read_next(OpShmReader* reader, OpShmFrame* frame);
+
+/* Newest frame, skipping any older unread one */
+int op_shm_reader_read_latest(OpShmReader* reader, OpShmFrame* frame);
+
+/* Header of the mapped segment (e.g., to check numberSlots or writerPid) */
+const OpShmHeader* op_shm_reader_header(const OpShmReader* reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPENPOSE_FILESTREAM_SHARED_MEMORY_READER_H */
@@ -0,0 +1,51 @@
+#ifndef OPENPOSE_FILESTREAM_SHARED_MEMORY_SENDER_HPP
+#define OPENPOSE_FILESTREAM_SHARED_MEMORY_SENDER_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Publishes the keypoints, person IDs & scores (and optionally the rendered image) of each frame into a POSIX
+     * shared-memory ring buffer, so other processes in the same machine can consume them without any serialization
+     * or socket overhead. The memory layout is defined in openpose/filestream/sharedMemoryProtocol.h, and a small C
+     * reader is provided in openpose/filestream/sharedMemoryReader.h.
+     * Not available on Windows.
+     */
+    class OP_API SharedMemorySender
+    {
+    public:
+        /**
+         * @param sharedMemoryName POSIX shared-memory object name (e.g., `/openpose`). If it does not start with
+         * `/`, it will be added.
+         * @param sendImage Whether to also publish cvOutputData.
+         * @param numberSlots Number of frames kept in the ring buffer (at least 2, as the oldest one is the next to be
+         * overwritten). Readers more than numberSlots - 1 frames behind will skip frames.
+         * @param maximumPeople Maximum number of people per frame stored in each slot (the rest are discarded and the
+         * frame marked as truncated).
+         */
+        SharedMemorySender(
+            const std::string& sharedMemoryName, const bool sendImage = false, const int numberSlots = 8,
+            const int maximumPeople = 64);
+
+        virtual ~SharedMemorySender();
+
+        /**
+         * The segment is lazily created on the first call, so the slot size can account for the output image
+         * resolution.
+         */
+        void send(const Datum& datum);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplSharedMemorySender;
+        std::shared_ptr<ImplSharedMemorySender> spImpl;
+
+        // PIMP requires DELETE_COPY & destructor, or extra code
+        // http://oliora.github.io/2015/12/29/pimpl-and-rule-of-zero.html
+        DELETE_COPY(SharedMemorySender);
+    };
+}
+
+#endif // OPENPOSE_FILESTREAM_SHARED_MEMORY_SENDER_HPP
@@ -8,9 +8,17 @@ namespace op
     class OP_API VideoSaver
     {
     public:
+        /**
+         * @param asyncQueueSize If > 0, frames are encoded asynchronously by a dedicated encoder thread, so write()
+         * only copies the frame into a bounded queue of up to asyncQueueSize frames. If 0 (default), write() encodes
+         * the frame synchronously (i.e., on the calling thread).
+         * @param asyncDropFrames Only for asyncQueueSize > 0. If the queue is full, whether write() drops the new
+         * frame (true) or blocks until the encoder thread releases a slot (false, default, no frame is lost).
+         */
         VideoSaver(
             const std::string& videoSaverPath, const int cvFourcc, const double fps,
-            const std::string& addAudioFromThisVideo = "");
+            const std::string& addAudioFromThisVideo = "", const int asyncQueueSize = 0,
+            const bool asyncDropFrames = false);
 
         virtual ~VideoSaver();
 
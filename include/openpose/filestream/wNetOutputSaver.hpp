@@ -0,0 +1,101 @@
+#ifndef OPENPOSE_FILESTREAM_W_NET_OUTPUT_SAVER_HPP
+#define OPENPOSE_FILESTREAM_W_NET_OUTPUT_SAVER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/filestream/netOutputSaver.hpp>
+#include <openpose/thread/workerConsumer.hpp>
+
+namespace op
+{
+    template<typename TDatums>
+    class WNetOutputSaver : public WorkerConsumer<TDatums>
+    {
+    public:
+        explicit WNetOutputSaver(const std::shared_ptr<NetOutputSaver>& netOutputSaver);
+
+        virtual ~WNetOutputSaver();
+
+        void initializationOnThread();
+
+        void workConsumer(const TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<NetOutputSaver> spNetOutputSaver;
+
+        DELETE_COPY(WNetOutputSaver);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WNetOutputSaver<TDatums>::WNetOutputSaver(const std::shared_ptr<NetOutputSaver>& netOutputSaver) :
+        spNetOutputSaver{netOutputSaver}
+    {
+    }
+
+    template<typename TDatums>
+    WNetOutputSaver<TDatums>::~WNetOutputSaver()
+    {
+    }
+
+    template<typename TDatums>
+    void WNetOutputSaver<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WNetOutputSaver<TDatums>::workConsumer(const TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // Record raw net output + input metadata on disk
+                for (const auto& tDatumPtr : *tDatums)
+                {
+                    NetOutputRecord netOutputRecord;
+                    netOutputRecord.frameNumber = tDatumPtr->frameNumber;
+                    netOutputRecord.name = (!tDatumPtr->name.empty()
+                        ? tDatumPtr->name : std::to_string(tDatumPtr->id));
+                    netOutputRecord.inputResolution = Point<int>{
+                        tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()};
+                    // inputNetData is empty if preprocessed directly into the network (see WPoseExtractor)
+                    if (!tDatumPtr->inputNetData.empty())
+                        netOutputRecord.netInputSize = tDatumPtr->inputNetData[0].getSize();
+                    else if (!tDatumPtr->netInputSizes.empty())
+                        netOutputRecord.netInputSize = std::vector<int>{
+                            1, 3, tDatumPtr->netInputSizes[0].y, tDatumPtr->netInputSizes[0].x};
+                    netOutputRecord.scaleInputToNetInput = (!tDatumPtr->scaleInputToNetInputs.empty()
+                        ? tDatumPtr->scaleInputToNetInputs[0] : 1.);
+                    netOutputRecord.netOutput = tDatumPtr->poseNetOutput;
+                    spNetOutputSaver->write(netOutputRecord);
+                }
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WNetOutputSaver);
+}
+
+#endif // OPENPOSE_FILESTREAM_W_NET_OUTPUT_SAVER_HPP
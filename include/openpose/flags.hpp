@@ -19,6 +19,12 @@
 DEFINE_int32(logging_level,             3,              "The logging level. Integer in the range [0, 255]. 0 will output any opLog() message,"
                                                         " while 255 will not output any. Current OpenPose library messages are in the range 0-4:"
                                                         " 1 for low priority messages and 4 for important ones.");
+DEFINE_bool(logging_async,               false,          "If enabled, opLog() messages are written by a background thread (rather than blocking the"
+                                                        " calling thread), and identical messages repeated by the same thread within 1 second are"
+                                                        " only counted. Useful to keep a low `--logging_level` in production without slowing down"
+                                                        " the pipeline.");
+DEFINE_string(logging_records,          "",             "If `--logging_async` is enabled, it also writes all the logged messages into this file as"
+                                                        " binary structured records (see `ConfigureLog::setBinaryRecordsPath`). Empty to disable it.");
 DEFINE_bool(disable_multi_thread,       false,          "It would slightly reduce the frame rate in order to highly reduce the lag. Mainly useful"
                                                         " for 1) Cases where it is needed a low latency (e.g., webcam in real-time scenarios with"
                                                         " low-range GPU devices); and 2) Debugging OpenPose when it is crashing to locate the"
@@ -42,6 +48,18 @@ DEFINE_int32(flir_camera_index,         -1,             "Select -1 (default) to
                                                         " camera index to run, where 0 corresponds to the detected flir camera with the lowest"
                                                         " serial number, and `n` to the `n`-th lowest serial number camera.");
 DEFINE_string(ip_camera,                "",             "String with the IP camera URL. It supports protocols like RTSP and HTTP.");
+DEFINE_string(net_output,               "",             "Replay the raw body network outputs recorded with `--write_net_output` (instead of reading"
+                                                        " frames), so the post-processing (NMS, body part connection, tracking, rendering, etc.)"
+                                                        " runs without the network. It requires `--body 2`, the recording `--net_resolution`, and"
+                                                        " `--scale_number 1`. Frames are rendered over a black background.");
+DEFINE_string(multi_stream,             "",             "Comma-separated list of independent sources (IP camera URLs, videos, image directories,"
+                                                        " and/or webcam indexes) served by a single OpenPose instance, i.e., sharing the same"
+                                                        " networks. Each stream is read on its own thread, live streams only keep their latest"
+                                                        " frame, and each output (JSON, images, etc.) keeps 1 file per stream. Per-stream"
+                                                        " statistics are logged when closing.");
+DEFINE_int32(multi_stream_batch,        1,              "Number of streams of `--multi_stream` processed together by the same GPU thread. 1"
+                                                        " (default) distributes each stream independently over the GPUs (lowest latency), higher"
+                                                        " values reduce the number of queue hops per frame when serving many streams.");
 DEFINE_uint64(frame_first,              0,              "Start on desired frame number. Indexes are 0-based, i.e., the first frame has index 0.");
 DEFINE_uint64(frame_step,               1,              "Step or gap between processed frames. E.g., `--frame_step 5` would read and process frames"
                                                         " 0, 5, 10, etc..");
@@ -60,6 +78,12 @@ DEFINE_bool(frame_undistort,            false,          "If false (default), it
 #endif // OPENPOSE_FLAGS_DISABLE_PRODUCER
 // OpenPose
 DEFINE_string(model_folder,             "models/",      "Folder path (absolute or relative) where the models (pose, face, ...) are located.");
+DEFINE_string(model_cache_folder,       "",             "Folder path (absolute or relative) of the weight cache. If not empty, the first run writes"
+                                                        " the parsed trained weights of each Caffe model (pose, face, and hand) into a flat file in"
+                                                        " this folder, and the following runs memory-map it (sharing its memory among the networks"
+                                                        " of all the running OpenPose processes) rather than parsing the caffemodel files, which"
+                                                        " speeds up the OpenPose start-up. Each cache file is named after the model path, and it is"
+                                                        " re-written automatically if the content of the model changes.");
 DEFINE_string(prototxt_path,            "",             "The combination `--model_folder` + `--prototxt_path` represents the whole path to the"
                                                         " prototxt file. If empty, it will use the default OpenPose ProtoTxt file.");
 DEFINE_string(caffemodel_path,          "",             "The combination `--model_folder` + `--caffemodel_path` represents the whole path to the"
@@ -85,9 +109,25 @@ DEFINE_int32(number_people_max,         -1,             "This parameter will lim
                                                         " highly occluded people. -1 will keep them all.");
 DEFINE_bool(maximize_positives,         false,          "It reduces the thresholds to accept a person candidate. It highly increases both false and"
                                                         " true positives. I.e., it maximizes average recall but could harm average precision.");
+DEFINE_bool(temporal_connection,        false,          "Video and webcam only (CPU version). It uses the body keypoints of the previous frame to"
+                                                        " skip the PAF scores of the candidate pairs inconsistent with them, falling back to the"
+                                                        " full scoring when a previous limb is not confirmed. It speeds up crowded scenes.");
 DEFINE_double(fps_max,                  -1.,            "Maximum processing frame rate. By default (-1), OpenPose will process frames as fast as"
                                                         " possible. Example usage: If OpenPose is displaying images too quickly, this can reduce"
                                                         " the speed so the user can analyze better each frame from the GUI.");
+DEFINE_double(latency_target,           -1.,            "Live inputs (e.g., webcam). Maximum desired end-to-end latency (in milliseconds, from the"
+                                                        " frame capture). By default (-1), disabled. If OpenPose falls behind (e.g., load spikes),"
+                                                        " the frames older than it are handled with `latency_policy`, so the output stays"
+                                                        " real-time rather than accumulating latency. The number of affected frames is reported"
+                                                        " when OpenPose closes.");
+DEFINE_int32(latency_policy,            0,              "Only if `latency_target` > 0. Select 0 to drop the stale frames before the body network"
+                                                        " (they are never output), or 1 to keep them but skip the face and hand keypoint detection"
+                                                        " for the frames that are already stale after the body network.");
+DEFINE_double(stage_fusion,             -1.,            "Multi-threading only. If > 0, cheap pipeline stages (e.g., the output workers or the frame"
+                                                        " sorting after multi-GPU) run directly in the thread feeding them (e.g., the pose"
+                                                        " estimation one) while their total cost (measured at run time) is lower than this value"
+                                                        " (in milliseconds per frame), removing a queue hop and a context switch per frame. By"
+                                                        " default (-1), each stage runs in its own thread.");
 // OpenPose Body Pose
 DEFINE_int32(body,                      1,              "Select 0 to disable body keypoint detection (e.g., for faster but less accurate face"
                                                         " keypoint detection, custom hand detector, etc.), 1 (default) for body keypoint"
@@ -109,10 +149,34 @@ DEFINE_double(net_resolution_dynamic,   1.,             "This flag only applies
                                                         " is 656 width for a 368 height). E.g., `net_resolution_dynamic 10 net_resolution -1x368`"
                                                         " will clip to 6560x368 (10 x 656). Recommended 1 for small GPUs (to avoid out of memory"
                                                         " errors but maximize speed) and 0 for big GPUs (for maximum accuracy and speed).");
+DEFINE_double(net_resolution_adaptive,  0.,             "Adaptive net resolution. If it is zero or a negative value, it is disabled. Otherwise,"
+                                                        " the net input resolution is reduced (to 75% or 50% of `net_resolution`) while the"
+                                                        " smallest person detected in the last frames is at least this height in net input pixels"
+                                                        " (e.g., 160), and immediately restored if a person gets smaller or is lost. It speeds up"
+                                                        " videos and webcams where people are big, at a small accuracy cost.");
+DEFINE_string(net_resolution_buckets,   "",             "Net input shape bucketing. Comma-separated list of sizes (multiples of 16, e.g., `368,496,"
+                                                        "656,880`) for the `-1` dimension of `net_resolution`. That dimension is rounded up to the"
+                                                        " closest of them (and the remaining area padded), and the network keeps a pre-reshaped"
+                                                        " workspace per size. It avoids reshaping the network for almost every image when the"
+                                                        " input images have different resolutions (e.g., `--image_dir` on COCO-like folders), at"
+                                                        " the cost of more memory. Empty (default) to disable it.");
 DEFINE_int32(scale_number,              1,              "Number of scales to average.");
 DEFINE_double(scale_gap,                0.25,           "Scale gap between scales. No effect unless scale_number > 1. Initial scale is always 1."
                                                         " If you want to change the initial scale, you actually want to multiply the"
                                                         " `net_resolution` by your desired initial scale.");
+DEFINE_bool(opencv_dnn,                 false,          "If true, it will run the body network with the OpenCV DNN module (OpenCV 4.0 or higher)"
+                                                        " rather than Caffe, and the body post-processing on CPU. It requires neither Caffe nor"
+                                                        " CUDA (it is enabled by default if OpenPose was compiled with `DL_FRAMEWORK` set to"
+                                                        " `OPEN_CV_DNN`), so it is the recommended option for CPU-only machines.");
+DEFINE_int32(opencv_dnn_backend,        0,              "Only if `opencv_dnn`. Select 0 for the default OpenCV backend, or 1 for the Intel"
+                                                        " Inference Engine (OpenVINO, it requires OpenCV to be built with it).");
+DEFINE_int32(opencv_dnn_target,         0,              "Only if `opencv_dnn`. Select 0 for CPU, or 1 for OpenCL (e.g., Intel integrated GPUs).");
+DEFINE_int32(opencv_dnn_precision,      0,              "Only if `opencv_dnn`. Select 0 for FP32, 1 for FP16 (OpenCL target, or CPU target with"
+                                                        " OpenCV 4.9 or higher), or 2 for INT8 (CPU target and OpenCV 4.6 or higher). INT8"
+                                                        " quantizes the network with the first frame as calibration data, so it is faster but"
+                                                        " its accuracy depends on that frame being representative.");
+DEFINE_int32(opencv_dnn_threads,        -1,             "Only if `opencv_dnn`. Number of OpenCV threads. Select -1 (default) to keep the OpenCV"
+                                                        " default value. Note that it applies to the whole OpenCV library.");
 // OpenPose Body Pose Heatmaps and Part Candidates
 DEFINE_bool(heatmaps_add_parts,         false,          "If true, it will fill op::Datum::poseHeatMaps array with the body part heatmaps, and"
                                                         " analogously face & hand heatmaps to op::Datum::faceHeatMaps & op::Datum::handHeatMaps."
@@ -150,6 +214,15 @@ DEFINE_int32(face_detector,             0,              "Kind of face rectangle
 DEFINE_string(face_net_resolution,      "368x368",      "Multiples of 16 and squared. Analogous to `net_resolution` but applied to the face keypoint"
                                                         " detector. 320x320 usually works fine while giving a substantial speed up when multiple"
                                                         " faces on the image.");
+DEFINE_int32(face_reuse_frames,         0,              "Video and webcam only. If greater than 0, the face keypoints of a person whose face"
+                                                        " rectangle and appearance barely changed are re-used (motion-compensated) for up to this"
+                                                        " number of consecutive frames rather than running the face network again. It speeds up"
+                                                        " multi-person videos with `--face`. E.g., 3 runs the face network at least every 4 frames"
+                                                        " per person.");
+DEFINE_int32(face_detector_period,      0,              "Only for `--face_detector 1` on video and webcam. If greater than 0, the OpenCV face"
+                                                        " detector only processes the whole frame every this number of frames, and only the"
+                                                        " regions around the previous frame faces in between. New faces might take up to this"
+                                                        " number of frames to be detected.");
 // OpenPose Hand
 DEFINE_bool(hand,                       false,          "Enables hand keypoint detection. It will share some parameters from the body pose, e.g."
                                                         " `model_folder`. Analogously to `--face`, it will also slow down the performance, increase"
@@ -162,6 +235,8 @@ DEFINE_int32(hand_scale_number,         1,              "Analogous to `scale_num
 DEFINE_double(hand_scale_range,         0.4,            "Analogous purpose than `scale_gap` but applied to the hand keypoint detector. Total range"
                                                         " between smallest and biggest scale. The scales will be centered in ratio 1. E.g., if"
                                                         " scaleRange = 0.4 and scalesNumber = 2, then there will be 2 scales, 0.8 and 1.2.");
+DEFINE_int32(hand_reuse_frames,         0,              "Analogous to `face_reuse_frames` but applied to the hand keypoint detector. Only applied"
+                                                        " if `hand_scale_number` is 1.");
 // OpenPose 3-D Reconstruction
 DEFINE_bool(3d,                         false,          "Running OpenPose 3-D reconstruction demo: 1) Reading from a stereo camera system."
                                                         " 2) Performing 3-D reconstruction from the multiple views. 3) Displaying 3-D reconstruction"
@@ -183,6 +258,11 @@ DEFINE_int32(tracking,                  -1,             "Experimental, not avail
 DEFINE_int32(ik_threads,                0,              "Experimental, not available yet. Whether to enable inverse kinematics (IK) from 3-D"
                                                         " keypoints to obtain 3-D joint angles. By default (0 threads), it is disabled. Increasing"
                                                         " the number of threads will increase the speed but also the global system latency.");
+DEFINE_int32(roi_mosaic,                0,              "Experimental. ROI-cropped inference for static cameras. The value indicates the period"
+                                                        " (in frames) of the full-frame passes, which detect new people. Between them, only the"
+                                                        " regions around the people found in the previous frame are processed, packed into a single"
+                                                        " (smaller) mosaic net input. If no people were found, the network is skipped until the next"
+                                                        " full-frame pass. Select 0 (default) to disable it.");
 // OpenPose Rendering
 DEFINE_int32(part_to_show,              0,              "Prediction channel to visualize: 0 (default) for all the body parts, 1 for the background"
                                                         " heat map, 2 for the superposition of heatmaps, 3 for the superposition of PAFs,"
@@ -235,6 +315,17 @@ DEFINE_double(cli_verbose,              -1.f,           "If -1, it will be disab
 DEFINE_string(write_images,             "",             "Directory to write rendered frames in `write_images_format` image format.");
 DEFINE_string(write_images_format,      "png",          "File extension and format for `write_images`, e.g., png, jpg or bmp. Check the OpenCV"
                                                         " function cv::imwrite for all compatible extensions.");
+DEFINE_int32(write_images_threads,      0,              "Number of threads to encode and save the `write_images` and `write_heatmaps` images in"
+                                                        " parallel (PNG/JPG encoding is usually much slower than the network for high resolution"
+                                                        " images or many heat maps). If 0, they are saved synchronously by the output thread. If"
+                                                        " -1, the number of hardware threads.");
+DEFINE_int32(write_images_memory,       512,            "Only for `write_images_threads` != 0. Maximum memory (in MB) of the images waiting to be"
+                                                        " saved by the encoder threads. Once reached, the output thread waits for them.");
+DEFINE_int32(write_png_compression,     9,              "PNG compression level (0-9) of `write_images` and `write_heatmaps`. 9 generates the"
+                                                        " smallest files but it is also the slowest one. For much faster saving at the cost of"
+                                                        " bigger files, use 1.");
+DEFINE_int32(write_jpg_quality,         100,            "JPG quality (0-100) of `write_images` and `write_heatmaps`. Lower values generate smaller"
+                                                        " files, at the cost of lossy compression artifacts.");
 DEFINE_string(write_video,              "",             "Full file path to write rendered frames in motion JPEG video format. It might fail if the"
                                                         " final path does not finish in `.avi`. It internally uses cv::VideoWriter. Flag"
                                                         " `write_video_fps` controls FPS. Alternatively, the video extension can be `.mp4`,"
@@ -250,6 +341,13 @@ DEFINE_double(write_video_fps,          -1.,            "Frame rate for the reco
 DEFINE_bool(write_video_with_audio,     false,          "If the input is video and the output is so too, it will save the video with audio. It"
                                                         " requires the output video file path finishing in `.mp4` format (see `write_video` for"
                                                         " details).");
+DEFINE_int32(write_video_async_queue,   0,              "If > 0, the `write_video` and `write_video_3d` frames are encoded asynchronously by a"
+                                                        " dedicated encoder thread per output video, so the video encoding overlaps with the rest"
+                                                        " of the pipeline. This value is the maximum number of frames waiting to be encoded (each one"
+                                                        " is a copy of the rendered frame). If 0, frames are encoded synchronously.");
+DEFINE_bool(write_video_async_drop,     false,          "Only for `write_video_async_queue` > 0. If the encoding queue is full, new frames are"
+                                                        " dropped from the output video rather than blocking the output thread until the encoder"
+                                                        " catches up.");
 DEFINE_string(write_video_3d,           "",             "Analogous to `--write_video`, but applied to the 3D output.");
 DEFINE_string(write_video_adam,         "",             "Experimental, not available yet. Analogous to `--write_video`, but applied to Adam model.");
 DEFINE_string(write_json,               "",             "Directory to write OpenPose output in JSON format. It includes body, hand, and face pose"
@@ -266,6 +364,9 @@ DEFINE_string(write_heatmaps,           "",             "Directory to write body
 DEFINE_string(write_heatmaps_format,    "png",          "File extension and format for `write_heatmaps`, analogous to `write_images_format`."
                                                         " For lossless compression, recommended `png` for integer `heatmaps_scale` and `float` for"
                                                         " floating values. See `doc/02_output.md` for more details.");
+DEFINE_string(write_net_output,         "",             "Full file path to record the raw body network output of each frame (plus its input"
+                                                        " resolution and net input size), e.g., `output/net_output.bin`. It can be replayed later"
+                                                        " with `--net_output`. Only for `--scale_number 1`.");
 DEFINE_string(write_keypoint,           "",             "(Deprecated, use `write_json`) Directory to write the people pose keypoint data. Set format"
                                                         " with `write_keypoint_format`.");
 DEFINE_string(write_keypoint_format,    "yml",          "(Deprecated, use `write_json`) File extension and format for `write_keypoint`: json, xml,"
@@ -275,6 +376,12 @@ DEFINE_string(write_bvh,                "",             "Experimental, not avail
 // UDP Communication
 DEFINE_string(udp_host,                 "",             "Experimental, not available yet. IP for UDP communication. E.g., `192.168.0.1`.");
 DEFINE_string(udp_port,                 "8051",         "Experimental, not available yet. Port number for UDP communication.");
+// Shared Memory Communication
+DEFINE_string(write_shared_memory,      "",             "POSIX shared memory name (e.g., `/openpose`) to publish the body/face/hand keypoints, IDs"
+                                                        " and scores of each frame into a ring buffer, readable at full frame rate by other"
+                                                        " processes in the same machine with `openpose/filestream/sharedMemoryReader.h`. Not"
+                                                        " available on Windows.");
+DEFINE_bool(write_shared_memory_image,  false,          "If `write_shared_memory` is enabled, it will also publish the rendered image.");
 #endif // OPENPOSE_FLAGS_DISABLE_POSE
 
 #endif // OPENPOSE_FLAGS_HPP
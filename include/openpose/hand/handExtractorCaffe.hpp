@@ -28,7 +28,8 @@ namespace op
                            const int numberScales = 1, const float rangeScales = 0.4f,
                            const std::vector<HeatMapType>& heatMapTypes = {},
                            const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect,
-                           const bool enableGoogleLogging = true);
+                           const bool enableGoogleLogging = true, const int reuseFrames = 0,
+                           const std::string& weightCacheFolder = "");
 
         /**
          * Virtual destructor of the HandExtractor class.
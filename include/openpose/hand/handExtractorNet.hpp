@@ -4,6 +4,7 @@
 #include <atomic>
 #include <openpose/core/common.hpp>
 #include <openpose/core/enumClasses.hpp>
+#include <openpose/core/keypointStabilityCache.hpp>
 
 namespace op
 {
@@ -20,11 +21,15 @@ namespace op
          * @param numberScales Number of scales to run. The more scales, the slower it will be but possibly also more
          * accurate.
          * @param rangeScales The range between the smaller and bigger scale.
+         * @param reuseFrames If > 0, the keypoints of still hands are re-used (motion-compensated) for up to this
+         * number of consecutive frames rather than running the network again (see KeypointStabilityCache). Only
+         * applied with a single scale.
          */
         explicit HandExtractorNet(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                   const int numberScales = 1, const float rangeScales = 0.4f,
                                   const std::vector<HeatMapType>& heatMapTypes = {},
-                                  const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect);
+                                  const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect,
+                                  const int reuseFrames = 0);
 
         /**
          * Virtual destructor of the HandExtractorNet class.
@@ -76,6 +81,8 @@ namespace op
         std::array<Array<float>, 2> mHeatMaps;
         // Temporarily disable it
         std::atomic<bool> mEnabled;
+        // Keypoint re-use for still hands, one per hand (nullptr if disabled)
+        std::array<std::shared_ptr<KeypointStabilityCache>, 2> spKeypointStabilityCaches;
 
         virtual void netInitializationOnThread() = 0;
 
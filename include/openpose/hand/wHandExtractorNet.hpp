@@ -68,8 +68,8 @@ namespace op
                     spHandExtractorNet->forwardPass(tDatumPtr->handRectangles, tDatumPtr->cvInputData);
                     for (auto hand = 0 ; hand < 2 ; hand++)
                     {
-                        tDatumPtr->handHeatMaps[hand] = spHandExtractorNet->getHeatMaps()[hand].clone();
-                        tDatumPtr->handKeypoints[hand] = spHandExtractorNet->getHandKeypoints()[hand].clone();
+                        spHandExtractorNet->getHeatMaps()[hand].copyTo(tDatumPtr->handHeatMaps[hand]);
+                        spHandExtractorNet->getHandKeypoints()[hand].copyTo(tDatumPtr->handKeypoints[hand]);
                     }
                 }
                 // Profiling speed
@@ -6,12 +6,19 @@
 
 namespace op
 {
+    /**
+     * @param previousPoseKeypoints Optional temporal prior for videos: unscaled (i.e., heat map coordinates)
+     * poseKeypoints of the previous frame. If not empty, only the candidate pairs consistent with the previous limbs
+     * are scored (plus the ones involving new or fast-moving peaks), falling back to full scoring for the body part
+     * pairs where a previous pairing is not confirmed by the current PAFs.
+     */
     template <typename T>
     void connectBodyPartsCpu(
         Array<T>& poseKeypoints, Array<T>& poseScores, const T* const heatMapPtr, const T* const peaksPtr,
         const PoseModel poseModel, const Point<int>& heatMapSize, const int maxPeaks, const T interMinAboveThreshold,
         const T interThreshold, const int minSubsetCnt, const T minSubsetScore, const T defaultNmsThreshold,
-        const T scaleFactor = 1.f, const bool maximizePositives = false);
+        const T scaleFactor = 1.f, const bool maximizePositives = false,
+        const Array<T>& previousPoseKeypoints = Array<T>());
 
     // Windows: Cuda functions do not include OP_API
     template <typename T>
@@ -40,7 +47,7 @@ namespace op
         const int maxPeaks, const T interThreshold, const T interMinAboveThreshold,
         const std::vector<unsigned int>& bodyPartPairs, const unsigned int numberBodyParts,
         const unsigned int numberBodyPartPairs, const T defaultNmsThreshold,
-        const Array<T>& precomputedPAFs = Array<T>());
+        const Array<T>& precomputedPAFs = Array<T>(), const Array<T>& previousPoseKeypoints = Array<T>());
 
     template <typename T>
     void removePeopleBelowThresholdsAndFillFaces(
@@ -37,6 +37,13 @@ namespace op
 
         void setScaleNetToOutput(const T scaleNetToOutput);
 
+        /**
+         * Temporal warm-start (CPU version only, i.e., Forward_cpu()). If enabled, the keypoints of the previous
+         * Forward() call are used to skip the PAF scores of the candidate pairs inconsistent with the previous frame
+         * (see connectBodyPartsCpu()). Only meaningful if consecutive Forward() calls receive consecutive frames.
+         */
+        void setTemporalWarmStart(const bool temporalWarmStart);
+
         virtual void Forward(const std::vector<ArrayCpuGpu<T>*>& bottom, Array<T>& poseKeypoints,
                              Array<T>& poseScores);
 
@@ -64,6 +71,8 @@ namespace op
         int mMinSubsetCnt;
         T mMinSubsetScore;
         T mScaleNetToOutput;
+        bool mTemporalWarmStart;
+        Array<T> mPreviousPoseKeypoints;
         std::array<int, 4> mHeatMapsSize;
         std::array<int, 4> mPeaksSize;
         std::array<int, 4> mTopSize;
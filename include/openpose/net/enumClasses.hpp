@@ -0,0 +1,38 @@
+#ifndef OPENPOSE_NET_ENUM_CLASSES_HPP
+#define OPENPOSE_NET_ENUM_CLASSES_HPP
+
+namespace op
+{
+    /**
+     * Computation backend of the OpenCV DNN module (see NetOpenCv).
+     */
+    enum class OpenCvDnnBackend : unsigned char
+    {
+        OpenCv = 0,         /**< OpenCV default implementation. */
+        InferenceEngine,    /**< Intel Inference Engine (OpenVINO). It requires OpenCV built with it. */
+        Size,
+    };
+
+    /**
+     * Device of the OpenCV DNN module (see NetOpenCv).
+     */
+    enum class OpenCvDnnTarget : unsigned char
+    {
+        Cpu = 0,
+        OpenCL,             /**< E.g., Intel integrated GPUs. */
+        Size,
+    };
+
+    /**
+     * Numerical precision of the OpenCV DNN module (see NetOpenCv).
+     */
+    enum class OpenCvDnnPrecision : unsigned char
+    {
+        Fp32 = 0,
+        Fp16,               /**< OpenCL target, or CPU target with OpenCV 4.9 or higher. */
+        Int8,               /**< Quantized weights and activations. OpenCV backend and CPU target, OpenCV 4.6 or higher. */
+        Size,
+    };
+}
+
+#endif // OPENPOSE_NET_ENUM_CLASSES_HPP
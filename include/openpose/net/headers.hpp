@@ -4,6 +4,7 @@
 // net module
 #include <openpose/net/bodyPartConnectorBase.hpp>
 #include <openpose/net/bodyPartConnectorCaffe.hpp>
+#include <openpose/net/enumClasses.hpp>
 #include <openpose/net/maximumBase.hpp>
 #include <openpose/net/maximumCaffe.hpp>
 #include <openpose/net/net.hpp>
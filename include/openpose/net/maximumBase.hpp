@@ -9,6 +9,16 @@ namespace op
     void maximumCpu(T* targetPtr, const T* const sourcePtr, const std::array<int, 4>& targetSize,
                     const std::array<int, 4>& sourceSize);
 
+    /**
+     * Equivalent to bicubically upsampling sourcePtr by netFactor (as ResizeAndMergeCaffe) and then calling
+     * maximumCpu(), but much faster: The maximum of each channel is found at the source (network output)
+     * resolution, and only a small window around it is bicubically upsampled. The resulting peak is refined with a
+     * quadratic fit, so the returned locations (in upsampled coordinates) have subpixel precision.
+     */
+    template <typename T>
+    void maximumSubpixelCpu(T* targetPtr, const T* const sourcePtr, const std::array<int, 4>& targetSize,
+                            const std::array<int, 4>& sourceSize, const T netFactor);
+
     // Windows: Cuda functions do not include OP_API
     template <typename T>
     void maximumGpu(T* targetPtr, const T* const sourcePtr, const std::array<int, 4>& targetSize,
@@ -18,7 +18,14 @@ namespace op
 
         virtual void LayerSetUp(const std::vector<ArrayCpuGpu<T>*>& bottom, const std::vector<ArrayCpuGpu<T>*>& top);
 
-        virtual void Reshape(const std::vector<ArrayCpuGpu<T>*>& bottom, const std::vector<ArrayCpuGpu<T>*>& top);
+        /**
+         * @param netFactor If 1, bottom are the already resized heat maps. Otherwise, bottom is the network output
+         * and the peaks are computed as if it had been resized by netFactor (i.e., as with ResizeAndMergeCaffe), but
+         * without resizing it (see maximumSubpixelCpu()). The latter is always computed on CPU.
+         */
+        virtual void Reshape(
+            const std::vector<ArrayCpuGpu<T>*>& bottom, const std::vector<ArrayCpuGpu<T>*>& top,
+            const T netFactor = T(1));
 
         virtual inline const char* type() const { return "Maximum"; }
 
@@ -35,6 +42,7 @@ namespace op
                                   const std::vector<ArrayCpuGpu<T>*>& bottom);
 
     private:
+        T mNetFactor;
         std::array<int, 4> mBottomSize;
         std::array<int, 4> mTopSize;
     };
@@ -14,6 +14,20 @@ namespace op
 
         virtual void forwardPass(const Array<float>& inputData) const = 0;
 
+        /**
+         * Writable input memory of the network, reshaped to `inputSize` (i.e., {batch size, 3 (RGB), height,
+         * width}). Filling it and calling forwardPass() with the returned Array avoids 1 full-size copy of the input.
+         * It returns an empty Array if the network input is not directly accessible from CPU (e.g., GPU versions),
+         * so the input must be given to forwardPass() as usual.
+         * The returned Array does not own its memory, so it is only valid until the next call to this function or
+         * to forwardPass() with a different input size.
+         */
+        virtual Array<float> getInputDataArray(const std::vector<int>& inputSize)
+        {
+            UNUSED(inputSize);
+            return Array<float>{};
+        }
+
         virtual std::shared_ptr<ArrayCpuGpu<float>> getOutputBlobArray() const = 0;
     };
 }
@@ -9,8 +9,18 @@ namespace op
     class OP_API NetCaffe : public Net
     {
     public:
+        /**
+         * @param maxWorkspaces Shape bucketing: Maximum number of Caffe nets (sharing the same trained weights) kept,
+         * each one reshaped for a different input size. Switching among them avoids reshaping (and re-allocating)
+         * the network whenever the input size changes among a few values. If a new input size is found and all of
+         * them are in use, the least recently used one is reshaped.
+         * @param weightCacheFolder If not empty, folder of the weight cache: The trained weights are memory-mapped
+         * from a flat cache file (shared among nets and processes) rather than deserialized from the caffemodel.
+         * The cache file is (re-)written from the caffemodel if it does not exist or the model has changed.
+         */
         NetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId = 0,
-                 const bool enableGoogleLogging = true, const std::string& lastBlobName = "net_output");
+                 const bool enableGoogleLogging = true, const std::string& lastBlobName = "net_output",
+                 const unsigned int maxWorkspaces = 1u, const std::string& weightCacheFolder = "");
 
         virtual ~NetCaffe();
 
@@ -18,6 +28,8 @@ namespace op
 
         void forwardPass(const Array<float>& inputNetData) const;
 
+        Array<float> getInputDataArray(const std::vector<int>& inputSize);
+
         std::shared_ptr<ArrayCpuGpu<float>> getOutputBlobArray() const;
 
     private:
@@ -2,14 +2,30 @@
 #define OPENPOSE_NET_NET_OPEN_CV_HPP
 
 #include <openpose/core/common.hpp>
+#include <openpose/net/enumClasses.hpp>
 #include <openpose/net/net.hpp>
 
 namespace op
 {
+    /**
+     * Network based on the OpenCV DNN module (OpenCV 4.0 or higher). Unlike NetCaffe, it requires neither Caffe
+     * nor CUDA (i.e., it works in CPU-only builds without Caffe), and its output is a plain CPU Array<float> (see
+     * getOutputArray()). It requires OpenPose to be compiled with the `USE_OPEN_CV_DNN` macro definition.
+     */
     class OP_API NetOpenCv : public Net
     {
     public:
-        NetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId = 0);
+        /**
+         * @param gpuId Unused (the OpenCL target runs on the default OpenCV OpenCL device).
+         * @param precision Int8 quantizes the network in the first forwardPass(), using its input as calibration
+         * data.
+         * @param numberThreads If > 0, number of threads of OpenCV. Note that it applies to the whole OpenCV library
+         * (e.g., also to cv::resize), not only to this network. If <= 0, OpenCV default value.
+         */
+        NetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId = 0,
+                  const OpenCvDnnBackend backend = OpenCvDnnBackend::OpenCv,
+                  const OpenCvDnnTarget target = OpenCvDnnTarget::Cpu,
+                  const OpenCvDnnPrecision precision = OpenCvDnnPrecision::Fp32, const int numberThreads = -1);
 
         virtual ~NetOpenCv();
 
@@ -17,6 +33,16 @@ namespace op
 
         void forwardPass(const Array<float>& inputNetData) const;
 
+        /**
+         * Output of the last forwardPass(), with size {batch size, channels, height, width}.
+         * The returned Array does not own its memory, so it is only valid until the next call to forwardPass().
+         */
+        Array<float> getOutputArray() const;
+
+        /**
+         * Only for Caffe builds (it copies the output into a new Caffe blob), nullptr otherwise. Use
+         * getOutputArray() instead.
+         */
         std::shared_ptr<ArrayCpuGpu<float>> getOutputBlobArray() const;
 
     private:
@@ -7,6 +7,7 @@
 #include <openpose/pose/poseExtractor.hpp>
 #include <openpose/pose/poseExtractorCaffe.hpp>
 #include <openpose/pose/poseExtractorNet.hpp>
+#include <openpose/pose/poseExtractorOpenCv.hpp>
 #include <openpose/pose/poseGpuRenderer.hpp>
 #include <openpose/pose/poseParameters.hpp>
 #include <openpose/pose/poseParametersRender.hpp>
@@ -2,6 +2,7 @@
 #define OPENPOSE_POSE_POSE_CPU_RENDERER_HPP
 
 #include <openpose/core/common.hpp>
+#include <openpose/core/enumClasses.hpp>
 #include <openpose/core/renderer.hpp>
 #include <openpose/pose/enumClasses.hpp>
 #include <openpose/pose/poseParametersRender.hpp>
@@ -12,18 +13,27 @@ namespace op
     class OP_API PoseCpuRenderer : public Renderer, public PoseRenderer
     {
     public:
+        /**
+         * Heat maps and PAFs are rendered from Datum::poseHeatMaps, so only the ones enabled in heatMapTypes (and
+         * normalized with heatMapScaleMode) can be rendered.
+         */
         PoseCpuRenderer(
             const PoseModel poseModel, const float renderThreshold, const bool blendOriginalFrame = true,
             const float alphaKeypoint = POSE_DEFAULT_ALPHA_KEYPOINT,
-            const float alphaHeatMap = POSE_DEFAULT_ALPHA_HEAT_MAP, const unsigned int elementToRender = 0u);
+            const float alphaHeatMap = POSE_DEFAULT_ALPHA_HEAT_MAP, const unsigned int elementToRender = 0u,
+            const std::vector<HeatMapType>& heatMapTypes = {},
+            const ScaleMode heatMapScaleMode = ScaleMode::UnsignedChar);
 
         virtual ~PoseCpuRenderer();
 
         std::pair<int, std::string> renderPose(
             Array<float>& outputData, const Array<float>& poseKeypoints, const float scaleInputToOutput,
-            const float scaleNetToOutput = -1.f);
+            const float scaleNetToOutput = -1.f, const Array<float>& poseHeatMaps = Array<float>{});
 
     private:
+        const std::vector<HeatMapType> mHeatMapTypes;
+        const ScaleMode mHeatMapScaleMode;
+
         DELETE_COPY(PoseCpuRenderer);
     };
 }
@@ -7,6 +7,7 @@
 #include <openpose/pose/poseParameters.hpp>
 #include <openpose/pose/poseExtractorNet.hpp>
 #include <openpose/tracking/personIdExtractor.hpp>
+#include <openpose/tracking/personRoiMosaic.hpp>
 #include <openpose/tracking/personTracker.hpp>
 
 namespace op
@@ -18,7 +19,8 @@ namespace op
                       const std::shared_ptr<KeepTopNPeople>& keepTopNPeople = nullptr,
                       const std::shared_ptr<PersonIdExtractor>& personIdExtractor = nullptr,
                       const std::shared_ptr<std::vector<std::shared_ptr<PersonTracker>>>& personTracker = {},
-                      const int numberPeopleMax = -1, const int tracking = -1);
+                      const int numberPeopleMax = -1, const int tracking = -1,
+                      const std::shared_ptr<PersonRoiMosaic>& personRoiMosaic = nullptr);
 
         virtual ~PoseExtractor();
 
@@ -28,11 +30,41 @@ namespace op
                          const Point<int>& inputDataSize,
                          const std::vector<double>& scaleRatios,
                          const Array<float>& poseNetOutput = Array<float>{},
-                         const long long frameId = -1ll);
+                         const long long frameId = -1ll,
+                         const Matrix& cvInputData = Matrix(),
+                         const unsigned long long imageViewIndex = 0ull);
+
+        /**
+         * First half of forwardPass(): It processes the frames that do not need the full-frame network input (the
+         * frames skipped by the tracker and the ROI mosaic frames, see PersonRoiMosaic).
+         * @return Whether the frame was processed. Otherwise, forwardPassNetInput() must be called with its
+         * full-frame network input, so that input only has to be created for those frames.
+         */
+        bool forwardPassWithoutNetInput(const Point<int>& inputDataSize,
+                                        const std::vector<double>& scaleRatios,
+                                        const Array<float>& poseNetOutput = Array<float>{},
+                                        const long long frameId = -1ll,
+                                        const Matrix& cvInputData = Matrix(),
+                                        const unsigned long long imageViewIndex = 0ull);
+
+        /**
+         * Second half of forwardPass(): Full-frame network forward pass. Only if forwardPassWithoutNetInput()
+         * returned false for this frame.
+         */
+        void forwardPassNetInput(const std::vector<Array<float>>& inputNetData,
+                                 const Point<int>& inputDataSize,
+                                 const std::vector<double>& scaleRatios,
+                                 const Array<float>& poseNetOutput = Array<float>{},
+                                 const long long frameId = -1ll,
+                                 const unsigned long long imageViewIndex = 0ull);
 
         // PoseExtractorNet functions
+        std::vector<Array<float>> getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes);
+
         Array<float> getHeatMapsCopy() const;
 
+        Array<float> getNetOutputCopy() const;
+
         std::vector<std::vector<std::array<float, 3>>> getCandidatesCopy() const;
 
         Array<float> getPoseKeypoints() const;
@@ -70,6 +102,11 @@ namespace op
         const std::shared_ptr<KeepTopNPeople> spKeepTopNPeople;
         const std::shared_ptr<PersonIdExtractor> spPersonIdExtractor;
         const std::shared_ptr<std::vector<std::shared_ptr<PersonTracker>>> spPersonTrackers;
+        const std::shared_ptr<PersonRoiMosaic> spPersonRoiMosaic;
+        // ROI mosaic results of the last forwardPass (frame coordinates)
+        bool mRoiMosaicUsed;
+        Array<float> mRoiMosaicPoseKeypoints;
+        Array<float> mRoiMosaicPoseScores;
 
         DELETE_COPY(PoseExtractor);
     };
@@ -16,6 +16,13 @@ namespace op
     class OP_API PoseExtractorCaffe : public PoseExtractorNet
     {
     public:
+        /**
+         * @param maxNetWorkspaces Maximum number of pre-reshaped workspaces of each Caffe net (see NetCaffe). It
+         * should match the number of different net input sizes expected (e.g., the number of net input size buckets
+         * of ScaleAndSizeExtractor plus 1).
+         * @param weightCacheFolder Folder of the memory-mapped weight cache of each Caffe net (see NetCaffe). If
+         * empty, the trained weights are deserialized from the caffemodel.
+         */
         PoseExtractorCaffe(
             const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
             const std::vector<HeatMapType>& heatMapTypes = {},
@@ -23,7 +30,8 @@ namespace op
             const bool addPartCandidates = false, const bool maximizePositives = false,
             const std::string& protoTxtPath = "", const std::string& caffeModelPath = "",
             const float upsamplingRatio = 0.f, const bool enableNet = true,
-            const bool enableGoogleLogging = true);
+            const bool enableGoogleLogging = true, const bool temporalWarmStart = false,
+            const unsigned int maxNetWorkspaces = 1u, const std::string& weightCacheFolder = "");
 
         virtual ~PoseExtractorCaffe();
 
@@ -41,6 +49,8 @@ namespace op
             const std::vector<double>& scaleInputToNetInputs = {1.f},
             const Array<float>& poseNetOutput = Array<float>{});
 
+        std::vector<Array<float>> getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes);
+
         const float* getCandidatesCpuConstPtr() const;
 
         const float* getCandidatesGpuConstPtr() const;
@@ -51,6 +61,8 @@ namespace op
 
         std::vector<int> getHeatMapSize() const;
 
+        Array<float> getNetOutputCopy() const;
+
         const float* getPoseGpuConstPtr() const;
 
     private:
@@ -63,6 +75,8 @@ namespace op
         const float mUpsamplingRatio;
         const bool mEnableNet;
         const bool mEnableGoogleLogging;
+        const unsigned int mMaxNetWorkspaces;
+        const std::string mWeightCacheFolder;
         // General parameters
         std::vector<std::shared_ptr<Net>> spNets;
         std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
@@ -25,6 +25,15 @@ namespace op
             const std::vector<Array<float>>& inputNetData, const Point<int>& inputDataSize,
             const std::vector<double>& scaleRatios = {1.f}, const Array<float>& poseNetOutput = Array<float>{}) = 0;
 
+        /**
+         * Writable network input memory (1 Array per scale, with the sizes {1, 3, height, width} given by
+         * netInputSizes), so the input can be resized and normalized directly into it (see
+         * CvMatToOpInput::fillArray()) and given to forwardPass() without any extra copy. It returns an empty
+         * std::vector if the network input memory is not accessible from CPU (e.g., GPU versions).
+         * It must be called from the same thread than forwardPass().
+         */
+        virtual std::vector<Array<float>> getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes);
+
         virtual const float* getCandidatesCpuConstPtr() const = 0;
 
         virtual const float* getCandidatesGpuConstPtr() const = 0;
@@ -37,6 +46,13 @@ namespace op
 
         Array<float> getHeatMapsCopy() const;
 
+        /**
+         * Copy of the raw network output of the last forwardPass() (i.e., before resize, NMS, and body part
+         * connection), with the same size than the `poseNetOutput` argument of forwardPass() expects. It is the
+         * data recorded by `--write_net_output`.
+         */
+        virtual Array<float> getNetOutputCopy() const;
+
         std::vector<std::vector<std::array<float,3>>> getCandidatesCopy() const;
 
         virtual const float* getPoseGpuConstPtr() const = 0;
@@ -0,0 +1,86 @@
+#ifndef OPENPOSE_POSE_POSE_EXTRACTOR_OPEN_CV_HPP
+#define OPENPOSE_POSE_POSE_EXTRACTOR_OPEN_CV_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/net/enumClasses.hpp>
+#include <openpose/net/netOpenCv.hpp>
+#include <openpose/pose/enumClasses.hpp>
+#include <openpose/pose/poseExtractorNet.hpp>
+
+namespace op
+{
+    /**
+     * Analogous to PoseExtractorCaffe, but running the body network with the OpenCV DNN module (NetOpenCv) and the
+     * CPU post-processing (resize and merge, NMS, and body part connection) directly on plain Array<float> elements
+     * (no Caffe blobs). Thus, it does not require Caffe nor CUDA (e.g., CPU-only builds with `DL_FRAMEWORK` set to
+     * `OPEN_CV_DNN`). All its results are in CPU memory, so the GPU pointer functions are not available.
+     */
+    class OP_API PoseExtractorOpenCv : public PoseExtractorNet
+    {
+    public:
+        PoseExtractorOpenCv(
+            const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
+            const std::vector<HeatMapType>& heatMapTypes = {},
+            const ScaleMode heatMapScaleMode = ScaleMode::ZeroToOneFixedAspect,
+            const bool addPartCandidates = false, const bool maximizePositives = false,
+            const std::string& protoTxtPath = "", const std::string& caffeModelPath = "",
+            const float upsamplingRatio = 0.f, const bool enableNet = true, const bool temporalWarmStart = false,
+            const OpenCvDnnBackend backend = OpenCvDnnBackend::OpenCv,
+            const OpenCvDnnTarget target = OpenCvDnnTarget::Cpu,
+            const OpenCvDnnPrecision precision = OpenCvDnnPrecision::Fp32, const int numberThreads = -1);
+
+        virtual ~PoseExtractorOpenCv();
+
+        virtual void netInitializationOnThread();
+
+        /**
+         * @param poseNetOutput Analogous to PoseExtractorCaffe::forwardPass().
+         */
+        virtual void forwardPass(
+            const std::vector<Array<float>>& inputNetData, const Point<int>& inputDataSize,
+            const std::vector<double>& scaleInputToNetInputs = {1.f},
+            const Array<float>& poseNetOutput = Array<float>{});
+
+        const float* getCandidatesCpuConstPtr() const;
+
+        const float* getCandidatesGpuConstPtr() const;
+
+        const float* getHeatMapCpuConstPtr() const;
+
+        const float* getHeatMapGpuConstPtr() const;
+
+        std::vector<int> getHeatMapSize() const;
+
+        Array<float> getNetOutputCopy() const;
+
+        const float* getPoseGpuConstPtr() const;
+
+    private:
+        // Used when increasing spNets
+        const int mGpuId;
+        const std::string mModelFolder;
+        const std::string mProtoTxtPath;
+        const std::string mCaffeModelPath;
+        const float mUpsamplingRatio;
+        const bool mEnableNet;
+        const bool mMaximizePositives;
+        const bool mTemporalWarmStart;
+        const OpenCvDnnBackend mBackend;
+        const OpenCvDnnTarget mTarget;
+        const OpenCvDnnPrecision mPrecision;
+        const int mNumberThreads;
+        // General parameters
+        std::vector<std::shared_ptr<NetOpenCv>> spNets;
+        // Network output of each scale (it does not own its memory)
+        std::vector<Array<float>> mNetOutputs;
+        Array<float> mHeatMaps;
+        Array<int> mNmsKernel;
+        Array<float> mPeaks;
+        // Temporal prior (heat map coordinates)
+        Array<float> mPreviousPoseKeypoints;
+
+        DELETE_COPY(PoseExtractorOpenCv);
+    };
+}
+
+#endif // OPENPOSE_POSE_POSE_EXTRACTOR_OPEN_CV_HPP
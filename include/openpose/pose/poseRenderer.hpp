@@ -16,9 +16,13 @@ namespace op
 
         virtual void initializationOnThread(){};
 
+        /**
+         * @param poseHeatMaps Datum::poseHeatMaps. Only used by the renderers that cannot access the network output
+         * directly (i.e., PoseCpuRenderer) in order to render heat maps and PAFs.
+         */
         virtual std::pair<int, std::string> renderPose(
             Array<float>& outputData, const Array<float>& poseKeypoints, const float scaleInputToOutput,
-            const float scaleNetToOutput = -1.f) = 0;
+            const float scaleNetToOutput = -1.f, const Array<float>& poseHeatMaps = Array<float>{}) = 0;
 
     protected:
         const PoseModel mPoseModel;
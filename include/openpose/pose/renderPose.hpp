@@ -2,6 +2,7 @@
 #define OPENPOSE_POSE_RENDER_POSE_HPP
 
 #include <openpose/core/common.hpp>
+#include <openpose/core/enumClasses.hpp>
 #include <openpose/pose/enumClasses.hpp>
 #include <openpose/pose/poseParametersRender.hpp>
 
@@ -11,6 +12,32 @@ namespace op
         Array<float>& frameArray, const Array<float>& poseKeypoints, const PoseModel poseModel,
         const float renderThreshold, const bool blendOriginalFrame = true);
 
+    /**
+     * CPU equivalents of the GPU heat map renderers. heatMapPtr points to the first channel to render (for PAFs,
+     * to the x-channel of the first PAF). heatMapScaleMode is the normalization of the heat maps (e.g., the one of
+     * Datum::poseHeatMaps), they are rendered as their original range ([0, 1] for body parts and [-1, 1] for PAFs).
+     * Rows are rendered in parallel, and the inner loops are vectorized if OpenPose was built with AVX.
+     */
+    OP_API void renderPoseHeatMapCpu(
+        Array<float>& frameArray, const float* const heatMapPtr, const Point<int>& heatMapSize,
+        const float scaleToKeepRatio, const float alphaBlending = POSE_DEFAULT_ALPHA_HEAT_MAP,
+        const ScaleMode heatMapScaleMode = ScaleMode::NoScale);
+
+    OP_API void renderPoseHeatMapsCpu(
+        Array<float>& frameArray, const PoseModel poseModel, const float* const heatMapPtr,
+        const Point<int>& heatMapSize, const float scaleToKeepRatio,
+        const float alphaBlending = POSE_DEFAULT_ALPHA_HEAT_MAP, const ScaleMode heatMapScaleMode = ScaleMode::NoScale);
+
+    OP_API void renderPosePAFCpu(
+        Array<float>& frameArray, const float* const heatMapPtr, const Point<int>& heatMapSize,
+        const float scaleToKeepRatio, const float alphaBlending = POSE_DEFAULT_ALPHA_HEAT_MAP,
+        const ScaleMode heatMapScaleMode = ScaleMode::NoScale);
+
+    OP_API void renderPosePAFsCpu(
+        Array<float>& frameArray, const PoseModel poseModel, const float* const heatMapPtr,
+        const Point<int>& heatMapSize, const float scaleToKeepRatio,
+        const float alphaBlending = POSE_DEFAULT_ALPHA_HEAT_MAP, const ScaleMode heatMapScaleMode = ScaleMode::NoScale);
+
     void renderPoseKeypointsGpu(
         float* framePtr, float* maxPtr, float* minPtr, float* scalePtr, const PoseModel poseModel,
         const int numberPeople, const Point<unsigned int>& frameSize, const float* const posePtr,
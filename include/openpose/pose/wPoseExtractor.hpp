@@ -2,6 +2,7 @@
 #define OPENPOSE_POSE_W_POSE_EXTRACTOR_HPP
 
 #include <openpose/core/common.hpp>
+#include <openpose/core/cvMatToOpInput.hpp>
 #include <openpose/pose/poseExtractor.hpp>
 #include <openpose/thread/worker.hpp>
 
@@ -11,7 +12,17 @@ namespace op
     class WPoseExtractor : public Worker<TDatums>
     {
     public:
-        explicit WPoseExtractor(const std::shared_ptr<PoseExtractor>& poseExtractorSharedPtr);
+        /**
+         * @param recordNetOutput If true, the raw network output is also copied into Datum::poseNetOutput (e.g., to
+         * be recorded by WNetOutputSaver). It is ignored for the Datums that already contain a poseNetOutput.
+         * @param cvMatToOpInput If not nullptr, Datum::inputNetData is created in this worker directly into the
+         * network input memory (if accessible from CPU, see PoseExtractor::getInputNetDataArrays()), rather than by
+         * a previous WCvMatToOpInput. In that case, Datum::inputNetData is left empty (that memory is overwritten by
+         * the next frame), and it is only created for the frames that need it (e.g., not for the ROI mosaic ones).
+         */
+        explicit WPoseExtractor(
+            const std::shared_ptr<PoseExtractor>& poseExtractorSharedPtr, const bool recordNetOutput = false,
+            const std::shared_ptr<CvMatToOpInput>& cvMatToOpInput = nullptr);
 
         virtual ~WPoseExtractor();
 
@@ -21,6 +32,8 @@ namespace op
 
     private:
         std::shared_ptr<PoseExtractor> spPoseExtractor;
+        const bool mRecordNetOutput;
+        const std::shared_ptr<CvMatToOpInput> spCvMatToOpInput;
 
         DELETE_COPY(WPoseExtractor);
     };
@@ -35,8 +48,12 @@ namespace op
 namespace op
 {
     template<typename TDatums>
-    WPoseExtractor<TDatums>::WPoseExtractor(const std::shared_ptr<PoseExtractor>& poseExtractorSharedPtr) :
-        spPoseExtractor{poseExtractorSharedPtr}
+    WPoseExtractor<TDatums>::WPoseExtractor(
+        const std::shared_ptr<PoseExtractor>& poseExtractorSharedPtr, const bool recordNetOutput,
+        const std::shared_ptr<CvMatToOpInput>& cvMatToOpInput) :
+        spPoseExtractor{poseExtractorSharedPtr},
+        mRecordNetOutput{recordNetOutput},
+        spCvMatToOpInput{cvMatToOpInput}
     {
     }
 
@@ -74,15 +91,40 @@ namespace op
                 // for (auto& tDatum : *tDatums)
                 {
                     auto& tDatumPtr = (*tDatums)[i];
+                    const Point<int> inputDataSize{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()};
                     // OpenPose net forward pass
-                    spPoseExtractor->forwardPass(
-                        tDatumPtr->inputNetData, Point<int>{tDatumPtr->cvInputData.cols(), tDatumPtr->cvInputData.rows()},
-                        tDatumPtr->scaleInputToNetInputs, tDatumPtr->poseNetOutput, tDatumPtr->id);
+                    if (spCvMatToOpInput == nullptr)
+                        spPoseExtractor->forwardPass(
+                            tDatumPtr->inputNetData, inputDataSize, tDatumPtr->scaleInputToNetInputs,
+                            tDatumPtr->poseNetOutput, tDatumPtr->id, tDatumPtr->cvInputData, i);
+                    // Frames that do not need the full-frame network input (e.g., ROI mosaic frames) skip creating it
+                    else if (!spPoseExtractor->forwardPassWithoutNetInput(
+                        inputDataSize, tDatumPtr->scaleInputToNetInputs, tDatumPtr->poseNetOutput, tDatumPtr->id,
+                        tDatumPtr->cvInputData, i))
+                    {
+                        // cv::Mat -> float* (directly into the network input memory if possible). That memory is
+                        // overwritten by the next frame, so it is not kept in Datum::inputNetData
+                        auto netInputMemory = spPoseExtractor->getInputNetDataArrays(tDatumPtr->netInputSizes);
+                        if (!netInputMemory.empty())
+                            spCvMatToOpInput->fillArray(
+                                netInputMemory, tDatumPtr->cvInputData, tDatumPtr->scaleInputToNetInputs,
+                                tDatumPtr->netInputSizes);
+                        else
+                            spCvMatToOpInput->createArray(
+                                tDatumPtr->inputNetData, tDatumPtr->cvInputData, tDatumPtr->scaleInputToNetInputs,
+                                tDatumPtr->netInputSizes);
+                        spPoseExtractor->forwardPassNetInput(
+                            (netInputMemory.empty() ? tDatumPtr->inputNetData : netInputMemory), inputDataSize,
+                            tDatumPtr->scaleInputToNetInputs, tDatumPtr->poseNetOutput, tDatumPtr->id, i);
+                    }
+                    // Raw network output (e.g., to record it)
+                    if (mRecordNetOutput && tDatumPtr->poseNetOutput.empty())
+                        tDatumPtr->poseNetOutput = spPoseExtractor->getNetOutputCopy();
                     // OpenPose keypoint detector
                     tDatumPtr->poseCandidates = spPoseExtractor->getCandidatesCopy();
                     tDatumPtr->poseHeatMaps = spPoseExtractor->getHeatMapsCopy();
-                    tDatumPtr->poseKeypoints = spPoseExtractor->getPoseKeypoints().clone();
-                    tDatumPtr->poseScores = spPoseExtractor->getPoseScores().clone();
+                    spPoseExtractor->getPoseKeypoints().copyTo(tDatumPtr->poseKeypoints);
+                    spPoseExtractor->getPoseScores().copyTo(tDatumPtr->poseScores);
                     tDatumPtr->scaleNetToOutput = spPoseExtractor->getScaleNetToOutput();
                     // Keep desired top N people
                     spPoseExtractor->keepTopPeople(tDatumPtr->poseKeypoints, tDatumPtr->poseScores);
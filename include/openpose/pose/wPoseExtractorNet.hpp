@@ -77,8 +77,8 @@ namespace op
                         tDatumPtr->scaleInputToNetInputs, tDatumPtr->poseNetOutput);
                     tDatumPtr->poseCandidates = spPoseExtractorNet->getCandidatesCopy();
                     tDatumPtr->poseHeatMaps = spPoseExtractorNet->getHeatMapsCopy();
-                    tDatumPtr->poseKeypoints = spPoseExtractorNet->getPoseKeypoints().clone();
-                    tDatumPtr->poseScores = spPoseExtractorNet->getPoseScores().clone();
+                    spPoseExtractorNet->getPoseKeypoints().copyTo(tDatumPtr->poseKeypoints);
+                    spPoseExtractorNet->getPoseScores().copyTo(tDatumPtr->poseScores);
                     tDatumPtr->scaleNetToOutput = spPoseExtractorNet->getScaleNetToOutput();
                 }
                 // Profiling speed
@@ -73,7 +73,7 @@ namespace op
                 for (auto& tDatumPtr : *tDatums)
                     tDatumPtr->elementRendered = spPoseRenderer->renderPose(
                         tDatumPtr->outputData, tDatumPtr->poseKeypoints, (float)tDatumPtr->scaleInputToOutput,
-                        (float)tDatumPtr->scaleNetToOutput);
+                        (float)tDatumPtr->scaleNetToOutput, tDatumPtr->poseHeatMaps);
                 // Profiling speed
                 Profiler::timerEnd(profilerKey);
                 Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
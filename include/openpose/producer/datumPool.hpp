@@ -0,0 +1,182 @@
+#ifndef OPENPOSE_PRODUCER_DATUM_POOL_HPP
+#define OPENPOSE_PRODUCER_DATUM_POOL_HPP
+
+#include <mutex>
+#include <openpose/core/common.hpp>
+#include <openpose/core/datum.hpp>
+
+namespace op
+{
+    /**
+     * Pool of Datum buffers. The big Array elements of each Datum (net input, output image, keypoints and heat maps)
+     * are re-used across frames rather than re-allocated for each new frame, so a steady-state stream does not
+     * allocate any new big memory block.
+     * The Datums returned by get() go back to the pool automatically when their last std::shared_ptr copy is
+     * released, i.e., by whichever worker (or user) consumes them last. Only their Arrays are recycled: they are
+     * returned empty but with their memory still allocated (see Array::emptyKeepingCapacity()), while all the other Datum elements
+     * are newly constructed. Arrays still shared with any other Array when released (e.g., a user copy) are not
+     * recycled.
+     * Thread-safe.
+     */
+    template<typename TDatum>
+    class DatumPool
+    {
+    public:
+        /**
+         * @param maximumSize Maximum number of idle buffers kept in the pool. Buffers released when the pool is full
+         * are simply freed.
+         */
+        explicit DatumPool(const unsigned long long maximumSize = 32ull);
+
+        virtual ~DatumPool();
+
+        std::shared_ptr<TDatum> get();
+
+    private:
+        struct DatumBuffers
+        {
+            std::vector<Array<float>> inputNetData;
+            Array<float> outputData;
+            Array<float> poseKeypoints;
+            Array<float> poseScores;
+            Array<float> poseHeatMaps;
+            Array<float> faceKeypoints;
+            Array<float> faceHeatMaps;
+            std::array<Array<float>, 2> handKeypoints;
+            std::array<Array<float>, 2> handHeatMaps;
+        };
+
+        // Shared with the Datum deleters, so Datums released after the pool destruction are simply freed
+        struct DatumPoolState
+        {
+            const unsigned long long maximumSize;
+            std::mutex mutex;
+            std::vector<DatumBuffers> buffers;
+
+            explicit DatumPoolState(const unsigned long long maximumSize_) :
+                maximumSize{maximumSize_}
+            {
+            }
+        };
+
+        const std::shared_ptr<DatumPoolState> spState;
+
+        static void swapBuffers(TDatum& datum, DatumBuffers& datumBuffers);
+
+        DELETE_COPY(DatumPool);
+    };
+}
+
+
+
+
+
+// Implementation
+namespace op
+{
+    template<typename TDatum>
+    DatumPool<TDatum>::DatumPool(const unsigned long long maximumSize) :
+        spState{std::make_shared<DatumPoolState>(maximumSize)}
+    {
+        try
+        {
+            spState->buffers.reserve(maximumSize);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatum>
+    DatumPool<TDatum>::~DatumPool()
+    {
+    }
+
+    template<typename TDatum>
+    std::shared_ptr<TDatum> DatumPool<TDatum>::get()
+    {
+        try
+        {
+            // Datum deleter: It gives its buffers back to the pool (if still alive)
+            const std::weak_ptr<DatumPoolState> stateWeakPtr = spState;
+            const auto datumDeleter = [stateWeakPtr](TDatum* datumPtr)
+            {
+                try
+                {
+                    const auto statePtr = stateWeakPtr.lock();
+                    if (statePtr != nullptr)
+                    {
+                        DatumBuffers datumBuffers;
+                        swapBuffers(*datumPtr, datumBuffers);
+                        delete datumPtr;
+                        datumPtr = nullptr;
+                        // Empty but keeping their memory (freed if shared with any other Array)
+                        for (auto& inputNetDataI : datumBuffers.inputNetData)
+                            inputNetDataI.emptyKeepingCapacity();
+                        datumBuffers.outputData.emptyKeepingCapacity();
+                        datumBuffers.poseKeypoints.emptyKeepingCapacity();
+                        datumBuffers.poseScores.emptyKeepingCapacity();
+                        datumBuffers.poseHeatMaps.emptyKeepingCapacity();
+                        datumBuffers.faceKeypoints.emptyKeepingCapacity();
+                        datumBuffers.faceHeatMaps.emptyKeepingCapacity();
+                        for (auto i = 0u ; i < 2u ; i++)
+                        {
+                            datumBuffers.handKeypoints[i].emptyKeepingCapacity();
+                            datumBuffers.handHeatMaps[i].emptyKeepingCapacity();
+                        }
+                        // Give them back
+                        const std::lock_guard<std::mutex> lock{statePtr->mutex};
+                        if (statePtr->buffers.size() < statePtr->maximumSize)
+                            statePtr->buffers.emplace_back(std::move(datumBuffers));
+                    }
+                    else
+                        delete datumPtr;
+                }
+                catch (const std::exception& e)
+                {
+                    errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            };
+            // New Datum, re-using the buffers of a released one (if any)
+            std::shared_ptr<TDatum> datumPtr{new TDatum{}, datumDeleter};
+            const std::lock_guard<std::mutex> lock{spState->mutex};
+            if (!spState->buffers.empty())
+            {
+                swapBuffers(*datumPtr, spState->buffers.back());
+                spState->buffers.pop_back();
+            }
+            return datumPtr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    template<typename TDatum>
+    void DatumPool<TDatum>::swapBuffers(TDatum& datum, DatumBuffers& datumBuffers)
+    {
+        try
+        {
+            std::swap(datum.inputNetData, datumBuffers.inputNetData);
+            std::swap(datum.outputData, datumBuffers.outputData);
+            std::swap(datum.poseKeypoints, datumBuffers.poseKeypoints);
+            std::swap(datum.poseScores, datumBuffers.poseScores);
+            std::swap(datum.poseHeatMaps, datumBuffers.poseHeatMaps);
+            std::swap(datum.faceKeypoints, datumBuffers.faceKeypoints);
+            std::swap(datum.faceHeatMaps, datumBuffers.faceHeatMaps);
+            std::swap(datum.handKeypoints, datumBuffers.handKeypoints);
+            std::swap(datum.handHeatMaps, datumBuffers.handHeatMaps);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    extern template class DatumPool<BASE_DATUM>;
+}
+
+#endif // OPENPOSE_PRODUCER_DATUM_POOL_HPP
@@ -6,6 +6,7 @@
 #include <openpose/core/common.hpp>
 #include <openpose/core/datum.hpp>
 #include <openpose/utilities/fastMath.hpp>
+#include <openpose/producer/datumPool.hpp>
 #include <openpose/producer/producer.hpp>
 
 namespace op
@@ -31,6 +32,8 @@ namespace op
         unsigned long long mFrameStep;
         unsigned int mNumberConsecutiveEmptyFrames;
         std::shared_ptr<std::pair<std::atomic<bool>, std::atomic<int>>> spVideoSeek;
+        // Datums (and their Array memory) are recycled once released by the last consumer
+        DatumPool<TDatum> mDatumPool;
 
         void checkIfTooManyConsecutiveEmptyFrames(
             unsigned int& numberConsecutiveEmptyFrames, const bool emptyFrame) const;
@@ -63,6 +66,8 @@ namespace op
     OP_API unsigned long long datumProducerConstructorRunningAndGetNextFrameNumber(
         const std::shared_ptr<Producer>& producerSharedPtr);
     OP_API void datumProducerConstructorRunningAndGetDatumFrameIntegrity(Matrix& matrix);
+    OP_API Array<float> datumProducerConstructorRunningAndGetDatumNetOutput(
+        const std::shared_ptr<Producer>& producerSharedPtr);
 
     template<typename TDatum>
     DatumProducer<TDatum>::DatumProducer(
@@ -112,6 +117,7 @@ namespace op
                 const unsigned long long nextFrameNumber = datumProducerConstructorRunningAndGetNextFrameNumber(
                     spProducer);
                 const std::vector<Matrix> matrices = spProducer->getFrames();
+                const auto captureNanoseconds = getSteadyTimeNanoseconds();
                 // Check frames are not empty
                 checkIfTooManyConsecutiveEmptyFrames(
                     mNumberConsecutiveEmptyFrames, matrices.empty() || matrices[0].empty());
@@ -125,12 +131,16 @@ namespace op
                     datums->resize(matrices.size());
                     // Datum cannot be assigned before resize()
                     auto& datumPtr = (*datums)[0];
-                    datumPtr = std::make_shared<TDatum>();
+                    datumPtr = mDatumPool.get();
                     // Filling first element
                     std::swap(datumPtr->name, nextFrameName);
                     datumPtr->frameNumber = nextFrameNumber;
+                    datumPtr->captureNanoseconds = captureNanoseconds;
                     datumPtr->cvInputData = matrices[0];
                     datumProducerConstructorRunningAndGetDatumFrameIntegrity(datumPtr->cvInputData);
+                    // Recorded network output (if any)
+                    if (spProducer->getType() == ProducerType::NetOutput)
+                        datumPtr->poseNetOutput = datumProducerConstructorRunningAndGetDatumNetOutput(spProducer);
                     if (!cameraMatrices.empty())
                     {
                         datumPtr->cameraMatrix = cameraMatrices[0];
@@ -146,9 +156,10 @@ namespace op
                         for (auto i = 1u ; i < datums->size() ; i++)
                         {
                             auto& datumIPtr = (*datums)[i];
-                            datumIPtr = std::make_shared<TDatum>();
+                            datumIPtr = mDatumPool.get();
                             datumIPtr->name = datumPtr->name;
                             datumIPtr->frameNumber = datumPtr->frameNumber;
+                            datumIPtr->captureNanoseconds = datumPtr->captureNanoseconds;
                             datumIPtr->cvInputData = matrices[i];
                             datumProducerConstructorRunningAndGetDatumFrameIntegrity(datumPtr->cvInputData);
                             datumIPtr->cvOutputData = datumIPtr->cvInputData;
@@ -36,6 +36,12 @@ namespace op
         ImageDirectory,
         /** An IP camera frames extractor, extending the functionality of cv::VideoCapture. */
         IPCamera,
+        /** Several independent streams (e.g., IP cameras) served by a single OpenPose instance, see
+         * MultiStreamReader.
+         */
+        MultiStream,
+        /** A reader of the raw network outputs recorded with `--write_net_output`, see NetOutputReader. */
+        NetOutput,
         /** A video frames extractor, extending the functionality of cv::VideoCapture. */
         Video,
         /** A webcam frames extractor, extending the functionality of cv::VideoCapture. */
@@ -2,11 +2,14 @@
 #define OPENPOSE_PRODUCER_HEADERS_HPP
 
 // producer module
+#include <openpose/producer/datumPool.hpp>
 #include <openpose/producer/datumProducer.hpp>
 #include <openpose/producer/enumClasses.hpp>
 #include <openpose/producer/flirReader.hpp>
 #include <openpose/producer/imageDirectoryReader.hpp>
 #include <openpose/producer/ipCameraReader.hpp>
+#include <openpose/producer/multiStreamReader.hpp>
+#include <openpose/producer/netOutputReader.hpp>
 #include <openpose/producer/producer.hpp>
 #include <openpose/producer/spinnakerWrapper.hpp>
 #include <openpose/producer/videoCaptureReader.hpp>
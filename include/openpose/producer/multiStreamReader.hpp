@@ -0,0 +1,71 @@
+#ifndef OPENPOSE_PRODUCER_MULTI_STREAM_READER_HPP
+#define OPENPOSE_PRODUCER_MULTI_STREAM_READER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/producer/producer.hpp>
+
+namespace op
+{
+    /**
+     * MultiStreamReader merges several independent producers (e.g., many IP cameras) into a single one, so a single
+     * OpenPose instance (i.e., a single copy of the pose, face, and hand networks) can serve all of them. Each stream
+     * is read in its own capture thread, and each frame returned by getFrames() contains 1 image per stream (in the
+     * same order as the streams were given). Thus, they follow the multi-view path of OpenPose: WDatumProducer splits
+     * them into groups of streams (see `--multi_stream_batch`) that are distributed over the GPU threads, and they
+     * are re-ordered and re-assembled afterwards, so each output (JSON, images, etc.) keeps 1 file per stream.
+     * Live streams (webcams and IP cameras) only keep their latest frame (older ones are dropped), while videos and
+     * image directories are not dropped (their capture thread waits until their last frame is consumed). If a stream
+     * has no new frame within the stream timeout, its last frame is repeated so the other streams are not stalled.
+     * Each stream always keeps the same view index (so each output file always corresponds to the same stream): a
+     * stream that has not delivered any frame yet after the stream timeout, or that already ended (e.g., a video
+     * reaching its end), is filled with black frames of its same size. It is closed once all the streams are closed,
+     * and it logs the statistics of each stream when released.
+     */
+    class OP_API MultiStreamReader : public Producer
+    {
+    public:
+        /**
+         * Constructor of MultiStreamReader. It starts the capture thread of each stream.
+         * @param producers Already opened producers, 1 per stream. Each one must return a single frame.
+         * @param streamTimeoutMs Maximum time (in milliseconds) to wait for a new frame of all the streams before
+         * repeating the last frame of the ones that did not deliver it.
+         */
+        explicit MultiStreamReader(
+            const std::vector<std::shared_ptr<Producer>>& producers, const double streamTimeoutMs = 100.);
+
+        virtual ~MultiStreamReader();
+
+        std::string getNextFrameName();
+
+        bool isOpened() const;
+
+        void release();
+
+        double get(const int capProperty);
+
+        void set(const int capProperty, const double value);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplMultiStreamReader;
+        std::unique_ptr<ImplMultiStreamReader> upImpl;
+        unsigned long long mFrameNameCounter;
+
+        Matrix getRawFrame();
+
+        std::vector<Matrix> getRawFrames();
+
+        DELETE_COPY(MultiStreamReader);
+    };
+
+    /**
+     * It creates the producer of each stream of a MultiStreamReader from a comma-separated list of sources. Each
+     * source is an IP camera if it contains `://`, a webcam index if it is a number, an image directory if it is an
+     * existing folder, or a video otherwise.
+     */
+    OP_API std::vector<std::shared_ptr<Producer>> createMultiStreamProducers(
+        const std::string& multiStreamString, const Point<int>& cameraResolution = Point<int>{-1,-1});
+}
+
+#endif // OPENPOSE_PRODUCER_MULTI_STREAM_READER_HPP
@@ -0,0 +1,63 @@
+#ifndef OPENPOSE_PRODUCER_NET_OUTPUT_READER_HPP
+#define OPENPOSE_PRODUCER_NET_OUTPUT_READER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/producer/producer.hpp>
+
+namespace op
+{
+    /**
+     * NetOutputReader replays the raw network outputs recorded with `--write_net_output` (see NetOutputSaver), so
+     * the post-processing (resize and merge, NMS, body part connection, tracking, rendering, etc.) can be run, tuned,
+     * and profiled at full speed without running the network. The frames it returns are black images with the
+     * resolution of the recorded frames, while the network output of each frame is given by getNetOutput().
+     * DatumProducer moves it into Datum::poseNetOutput, so OpenPose must be run with its internal body network
+     * disabled (`--body 2`) and the same `--net_resolution` used while recording (and `--scale_number 1`).
+     */
+    class OP_API NetOutputReader : public Producer
+    {
+    public:
+        /**
+         * Constructor of NetOutputReader. It reads the file header and indexes all its records (without loading
+         * their network outputs).
+         * @param netOutputPath const std::string parameter with the file recorded with `--write_net_output`.
+         */
+        explicit NetOutputReader(const std::string& netOutputPath);
+
+        virtual ~NetOutputReader();
+
+        std::string getNextFrameName();
+
+        /**
+         * Network output of the last frame returned by getFrame(). It returns it only once (i.e., an empty Array if
+         * called again before the next frame is read).
+         */
+        Array<float> getNetOutput();
+
+        inline bool isOpened() const
+        {
+            return (mFrameNameCounter >= 0);
+        }
+
+        void release();
+
+        double get(const int capProperty);
+
+        void set(const int capProperty, const double value);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplNetOutputReader;
+        std::unique_ptr<ImplNetOutputReader> upImpl;
+        long long mFrameNameCounter;
+
+        Matrix getRawFrame();
+
+        std::vector<Matrix> getRawFrames();
+
+        DELETE_COPY(NetOutputReader);
+    };
+}
+
+#endif // OPENPOSE_PRODUCER_NET_OUTPUT_READER_HPP
@@ -13,7 +13,12 @@ namespace op
     class WDatumProducer : public WorkerProducer<std::shared_ptr<std::vector<std::shared_ptr<TDatum>>>>
     {
     public:
-        explicit WDatumProducer(const std::shared_ptr<DatumProducer<TDatum>>& datumProducer);
+        /**
+         * @param viewBatchSize If the producer returns multiple views (e.g., multiple cameras or streams), they are
+         * split into groups of viewBatchSize views, so each group is processed by the same extractor thread.
+         */
+        explicit WDatumProducer(
+            const std::shared_ptr<DatumProducer<TDatum>>& datumProducer, const int viewBatchSize = 1);
 
         virtual ~WDatumProducer();
 
@@ -23,6 +28,7 @@ namespace op
 
     private:
         std::shared_ptr<DatumProducer<TDatum>> spDatumProducer;
+        const unsigned long long mViewBatchSize;
         std::queue<std::shared_ptr<std::vector<std::shared_ptr<TDatum>>>> mQueuedElements;
 
         DELETE_COPY(WDatumProducer);
@@ -39,8 +45,9 @@ namespace op
 {
     template<typename TDatum>
     WDatumProducer<TDatum>::WDatumProducer(
-        const std::shared_ptr<DatumProducer<TDatum>>& datumProducer) :
-        spDatumProducer{datumProducer}
+        const std::shared_ptr<DatumProducer<TDatum>>& datumProducer, const int viewBatchSize) :
+        spDatumProducer{datumProducer},
+        mViewBatchSize{(unsigned long long)(viewBatchSize > 1 ? viewBatchSize : 1)}
     {
     }
 
@@ -81,7 +88,8 @@ namespace op
                 opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             }
             // Equivalent to WQueueSplitter
-            // Queued elements - Multiple views --> Split views into different shared pointers
+            // Queued elements - Multiple views --> Split views into different shared pointers (of up to
+            // mViewBatchSize consecutive views each)
             if (tDatums != nullptr && tDatums->size() > 1)
             {
                 // Add tDatums to mQueuedElements
@@ -90,9 +98,9 @@ namespace op
                     auto& tDatumPtr = (*tDatums)[i];
                     tDatumPtr->subId = i;
                     tDatumPtr->subIdMax = tDatums->size()-1;
-                    mQueuedElements.emplace(
-                        std::make_shared<std::vector<std::shared_ptr<TDatum>>>(
-                            std::vector<std::shared_ptr<TDatum>>{tDatumPtr}));
+                    if (i % mViewBatchSize == 0)
+                        mQueuedElements.emplace(std::make_shared<std::vector<std::shared_ptr<TDatum>>>());
+                    mQueuedElements.back()->emplace_back(tDatumPtr);
                 }
             }
             // Queued elements - Multiple views --> Return oldest view
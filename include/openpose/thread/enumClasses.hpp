@@ -22,6 +22,27 @@ namespace op
          */
         Synchronous,
     };
+
+    /**
+     * Backpressure policy applied by WLatencyGuard to the frames older than the latency target (see
+     * LatencyController).
+     */
+    enum class LatencyPolicy : unsigned char
+    {
+        DropFrames,     /**< Stale frames are dropped before the body network (they are never output). */
+        SkipFaceHand,   /**< Stale frames are kept, but face and hand keypoint detection is skipped for them. */
+        Size,
+    };
+
+    /**
+     * Action of each WLatencyGuard, given by its location in the pipeline.
+     */
+    enum class LatencyAction : unsigned char
+    {
+        DropFrame,      /**< Placed before the body network. */
+        SkipFace,       /**< Placed between the face detector and the face keypoint extractor. */
+        SkipHand,       /**< Placed between the hand detector and the hand keypoint extractor. */
+    };
 }
 
 #endif // OPENPOSE_THREAD_ENUM_CLASSES_HPP
@@ -3,9 +3,11 @@
 
 // thread module
 #include <openpose/thread/enumClasses.hpp>
+#include <openpose/thread/latencyController.hpp>
 #include <openpose/thread/priorityQueue.hpp>
 #include <openpose/thread/queue.hpp>
 #include <openpose/thread/queueBase.hpp>
+#include <openpose/thread/stagePlanner.hpp>
 #include <openpose/thread/subThread.hpp>
 #include <openpose/thread/subThreadNoQueue.hpp>
 #include <openpose/thread/subThreadQueueIn.hpp>
@@ -18,6 +20,7 @@
 #include <openpose/thread/workerConsumer.hpp>
 #include <openpose/thread/wFpsMax.hpp>
 #include <openpose/thread/wIdGenerator.hpp>
+#include <openpose/thread/wLatencyGuard.hpp>
 #include <openpose/thread/wQueueAssembler.hpp>
 #include <openpose/thread/wQueueOrderer.hpp>
 
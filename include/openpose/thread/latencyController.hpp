@@ -0,0 +1,75 @@
+#ifndef OPENPOSE_THREAD_LATENCY_CONTROLLER_HPP
+#define OPENPOSE_THREAD_LATENCY_CONTROLLER_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/thread/enumClasses.hpp>
+
+namespace op
+{
+    /**
+     * Shared state of the latency (backpressure) policy: the end-to-end latency target, the frames dropped or
+     * degraded by each WLatencyGuard, and the list of dropped IDs, so WQueueOrderer does not wait for them.
+     * Multi-view frames (split into several TDatums by WDatumProducer) are dropped as a whole: the first group of views
+     * of each frame ID that is checked decides for all the other groups of that ID.
+     * It is thread-safe (all the WLatencyGuard and WQueueOrderer instances of the pipeline share the same one).
+     */
+    class OP_API LatencyController
+    {
+    public:
+        /**
+         * @param latencyTargetMs Maximum desired age (in milliseconds, from its capture) of each frame. Frames older
+         * than it are stale.
+         * @param trackDroppedIds Whether to keep the list of dropped IDs for popDrop(). Only required if a
+         * WQueueOrderer is placed after the dropping WLatencyGuard (i.e., multi-GPU), otherwise it would keep growing.
+         */
+        LatencyController(
+            const double latencyTargetMs, const LatencyPolicy latencyPolicy, const bool trackDroppedIds = false);
+
+        virtual ~LatencyController();
+
+        LatencyPolicy getPolicy() const;
+
+        /**
+         * Whether the frame captured at captureNanoseconds (see Datum::captureNanoseconds) is stale. It also
+         * records its age.
+         */
+        bool isStale(const unsigned long long captureNanoseconds);
+
+        /**
+         * Whether the given group of views of the frame with the given ID must be dropped (i.e., whether that frame
+         * is stale, see isStale). For multi-view frames (subIdMax > 0), the decision is taken once per ID and
+         * applied to all its groups of views, and the drop is recorded once per ID.
+         * @param numberViews Number of views of this group (i.e., size of its TDatums).
+         */
+        bool dropIfStale(
+            const unsigned long long id, const unsigned long long subIdMax, const unsigned long long numberViews,
+            const unsigned long long captureNanoseconds);
+
+        /**
+         * Records that a frame was kept but its optional (face or hand) stage was skipped.
+         */
+        void recordSkip(const LatencyAction latencyAction);
+
+        /**
+         * If the frame with the given ID (i.e., all its views) was dropped, it removes it from the list of dropped IDs
+         * and returns true. Otherwise, false.
+         */
+        bool popDrop(const unsigned long long id);
+
+        unsigned long long getDroppedFrames() const;
+
+        unsigned long long getSkippedFaceFrames() const;
+
+        unsigned long long getSkippedHandFrames() const;
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplLatencyController;
+        std::unique_ptr<ImplLatencyController> upImpl;
+
+        DELETE_COPY(LatencyController);
+    };
+}
+
+#endif // OPENPOSE_THREAD_LATENCY_CONTROLLER_HPP
@@ -0,0 +1,67 @@
+#ifndef OPENPOSE_THREAD_STAGE_PLANNER_HPP
+#define OPENPOSE_THREAD_STAGE_PLANNER_HPP
+
+#include <openpose/core/common.hpp>
+
+namespace op
+{
+    /**
+     * Pipeline planner for stage fusion. Each stage is a thread of the ThreadManager that was marked as fusable (see
+     * ThreadManager::setFusable). It measures the cost of each worker of each stage (during the first warmUpFrames
+     * frames and then over windows of warmUpFrames frames), and decides which stage (i.e., thread) runs each one:
+     * consecutive cheap stages are fused into the thread feeding the first one of them, which runs their workers
+     * directly on its frames (saving a queue hop and a context switch per frame), while stages whose cost grows above
+     * the threshold are split back into their own thread.
+     * It is thread-safe, and getHostStage() is lock-free (it is called once per loop iteration of each thread).
+     */
+    class OP_API StagePlanner
+    {
+    public:
+        /**
+         * @param fusionThresholdMs Maximum cost (in milliseconds per frame) of a group of fused stages, not counting
+         * the thread hosting them unless it is also a fusable stage (e.g., the GPU pose estimation thread is not
+         * counted). A fused group is only split back if its cost gets higher than twice this value (hysteresis).
+         * @param warmUpFrames Number of frames measured for each stage before taking (or updating) its decision.
+         */
+        explicit StagePlanner(const double fusionThresholdMs, const unsigned long long warmUpFrames = 30ull);
+
+        virtual ~StagePlanner();
+
+        /**
+         * It registers a new stage (in pipeline order). All the stages must be added before starting the threads.
+         * @param stageName Name used for logging.
+         * @param previousStage Index of the stage that feeds this one (only if it is its only input), or -1 if this
+         * stage cannot be fused into a previous one. Stages that only host others (e.g., the GPU pose estimation
+         * thread) are added with -1 and never record their costs.
+         * @return Index of the new stage.
+         */
+        unsigned long long addStage(const std::string& stageName, const long long previousStage = -1);
+
+        /**
+         * Index of the stage whose thread must currently run the given stage. It returns stageIndex itself if that
+         * stage is not fused, or if its host stage is already closed.
+         */
+        unsigned long long getHostStage(const unsigned long long stageIndex) const;
+
+        /**
+         * It records the cost (in nanoseconds) of each worker of the given stage for a single frame.
+         */
+        void recordCosts(const unsigned long long stageIndex, const std::vector<unsigned long long>& workerCosts);
+
+        void setClosed(const unsigned long long stageIndex);
+
+        bool isClosed(const unsigned long long stageIndex) const;
+
+        unsigned long long getNumberStages() const;
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplStagePlanner;
+        std::unique_ptr<ImplStagePlanner> upImpl;
+
+        DELETE_COPY(StagePlanner);
+    };
+}
+
+#endif // OPENPOSE_THREAD_STAGE_PLANNER_HPP
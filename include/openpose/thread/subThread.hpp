@@ -15,10 +15,24 @@ namespace op
         // Destructor
         virtual ~SubThread();
 
-        void initializationOnThread();
+        virtual void initializationOnThread();
 
         virtual bool work() = 0;
 
+        /**
+         * If enabled, it measures the cost (in nanoseconds) of each TWorker for each processed frame (see
+         * getLastWorkerCosts). Used by StagePlanner, disabled by default.
+         */
+        void setCostMeasurement(const bool measureCost);
+
+        /**
+         * Cost of each TWorker in the last work() call, or empty if no frame was processed on it.
+         */
+        inline const std::vector<unsigned long long>& getLastWorkerCosts() const
+        {
+            return mLastWorkerCosts;
+        }
+
     protected:
         inline size_t getTWorkersSize() const
         {
@@ -29,6 +43,8 @@ namespace op
 
     private:
         std::vector<TWorker> mTWorkers;
+        bool mMeasureCost;
+        std::vector<unsigned long long> mLastWorkerCosts;
 
         DELETE_COPY(SubThread);
     };
@@ -43,7 +59,8 @@ namespace op
 {
     template<typename TDatums, typename TWorker>
     SubThread<TDatums, TWorker>::SubThread(const std::vector<TWorker>& tWorkers) :
-        mTWorkers{tWorkers}
+        mTWorkers{tWorkers},
+        mMeasureCost{false}
     {
     }
 
@@ -57,6 +74,9 @@ namespace op
     {
         try
         {
+            if (mMeasureCost)
+                mLastWorkerCosts.clear();
+
             // If !inputIsRunning -> try to close TWorkers
             if (!inputIsRunning)
             {
@@ -79,6 +99,7 @@ namespace op
                     if (lastOneStopped)
                         worker->tryStop();
 
+                    const auto costInit = (mMeasureCost && tDatums != nullptr ? getSteadyTimeNanoseconds() : 0ull);
                     if (!worker->checkAndWork(tDatums))
                     {
                         allRunning = false;
@@ -86,6 +107,8 @@ namespace op
                     }
                     else
                         lastOneStopped = false;
+                    if (costInit > 0ull)
+                        mLastWorkerCosts.emplace_back(getSteadyTimeNanoseconds() - costInit);
                 }
 
                 if (allRunning)
@@ -151,6 +174,20 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker>
+    void SubThread<TDatums, TWorker>::setCostMeasurement(const bool measureCost)
+    {
+        try
+        {
+            mMeasureCost = {measureCost};
+            mLastWorkerCosts.clear();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     COMPILE_TEMPLATE_DATUM(SubThread);
 }
 
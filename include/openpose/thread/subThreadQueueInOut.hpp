@@ -1,8 +1,10 @@
 #ifndef OPENPOSE_THREAD_THREAD_QUEUE_IN_OUT_HPP
 #define OPENPOSE_THREAD_THREAD_QUEUE_IN_OUT_HPP
 
+#include <mutex>
 #include <openpose/core/common.hpp>
 #include <openpose/thread/queue.hpp>
+#include <openpose/thread/stagePlanner.hpp>
 #include <openpose/thread/thread.hpp>
 #include <openpose/thread/worker.hpp>
 
@@ -19,9 +21,34 @@ namespace op
 
         bool work();
 
+        /**
+         * It makes this SubThread a stage of the given StagePlanner (see ThreadManager::setFusable). If the planner
+         * fuses it into its previous stage, that thread runs its TWorkers directly (see setNextStage), and this
+         * thread only processes the frames left in the input queue.
+         * Its TWorkers must not be bound to its thread (e.g., no GPU or GUI).
+         */
+        void setStage(const std::shared_ptr<StagePlanner>& stagePlanner, const unsigned long long stageIndex);
+
+        /**
+         * Stage fed only by this SubThread. While it is fused into this thread, its TWorkers run right after the ones
+         * of this SubThread on the same TDatums, skipping the queue between both.
+         */
+        void setNextStage(const std::shared_ptr<SubThreadQueueInOut<TDatums, TWorker, TQueue>>& nextStage);
+
     private:
         std::shared_ptr<TQueue> spTQueueIn;
         std::shared_ptr<TQueue> spTQueueOut;
+        // Stage fusion
+        std::shared_ptr<StagePlanner> spStagePlanner;
+        unsigned long long mStageIndex;
+        std::mutex mStageMutex;
+        std::shared_ptr<SubThreadQueueInOut<TDatums, TWorker, TQueue>> spNextStage;
+
+        bool workQueues();
+
+        bool tryWorkFused(TDatums& tDatums);
+
+        void pushOutput(TDatums& tDatums);
 
         DELETE_COPY(SubThreadQueueInOut);
     };
@@ -40,7 +67,8 @@ namespace op
                                                                        const std::shared_ptr<TQueue>& tQueueOut) :
         SubThread<TDatums, TWorker>{tWorkers},
         spTQueueIn{tQueueIn},
-        spTQueueOut{tQueueOut}
+        spTQueueOut{tQueueOut},
+        mStageIndex{0ull}
     {
         // spTQueueIn->addPopper();
         spTQueueOut->addPusher();
@@ -53,6 +81,64 @@ namespace op
 
     template<typename TDatums, typename TWorker, typename TQueue>
     bool SubThreadQueueInOut<TDatums, TWorker, TQueue>::work()
+    {
+        try
+        {
+            // No stage fusion
+            if (spStagePlanner == nullptr)
+                return workQueues();
+            // Fused into the previous thread (which runs these TWorkers directly) -> only process the frames left in
+            // the input queue (or its closing)
+            if (spStagePlanner->getHostStage(mStageIndex) != mStageIndex
+                && spTQueueIn->empty() && spTQueueIn->isRunning())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                return true;
+            }
+            std::lock_guard<std::mutex> lock{mStageMutex};
+            return workQueues();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            spTQueueIn->stop();
+            spTQueueOut->stop();
+            return false;
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void SubThreadQueueInOut<TDatums, TWorker, TQueue>::setStage(
+        const std::shared_ptr<StagePlanner>& stagePlanner, const unsigned long long stageIndex)
+    {
+        try
+        {
+            spStagePlanner = {stagePlanner};
+            mStageIndex = {stageIndex};
+            this->setCostMeasurement(true);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void SubThreadQueueInOut<TDatums, TWorker, TQueue>::setNextStage(
+        const std::shared_ptr<SubThreadQueueInOut<TDatums, TWorker, TQueue>>& nextStage)
+    {
+        try
+        {
+            spNextStage = {nextStage};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool SubThreadQueueInOut<TDatums, TWorker, TQueue>::workQueues()
     {
         try
         {
@@ -79,17 +165,18 @@ namespace op
                         workersAreRunning = spTQueueIn->isRunning();
                     // Process TDatums
                     workersAreRunning = this->workTWorkers(tDatums, workersAreRunning);
+                    if (spStagePlanner != nullptr && !this->getLastWorkerCosts().empty())
+                        spStagePlanner->recordCosts(mStageIndex, this->getLastWorkerCosts());
                     // Push/emplace tDatums if successfully processed
                     if (workersAreRunning)
-                    {
-                        if (tDatums != nullptr)
-                            spTQueueOut->waitAndEmplace(tDatums);
-                    }
+                        pushOutput(tDatums);
                     // Close both queues otherwise
                     else
                     {
                         spTQueueIn->stop();
                         spTQueueOut->stopPusher();
+                        if (spStagePlanner != nullptr)
+                            spStagePlanner->setClosed(mStageIndex);
                     }
                     return workersAreRunning;
                 }
@@ -109,6 +196,64 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    bool SubThreadQueueInOut<TDatums, TWorker, TQueue>::tryWorkFused(TDatums& tDatums)
+    {
+        try
+        {
+            // Not fused into the calling thread
+            if (spStagePlanner == nullptr || spStagePlanner->getHostStage(mStageIndex) == mStageIndex)
+                return false;
+            std::lock_guard<std::mutex> lock{mStageMutex};
+            // Frames still in the input queue (e.g., the plan just changed) must be processed first to keep the order
+            if (!spTQueueIn->empty())
+                return false;
+            // If output queue is closed -> close input queue (so the calling thread also finishes)
+            if (!spTQueueOut->isRunning())
+            {
+                spTQueueIn->stop();
+                return true;
+            }
+            // Process TDatums in the calling thread
+            const auto workersAreRunning = this->workTWorkers(tDatums, true);
+            if (!this->getLastWorkerCosts().empty())
+                spStagePlanner->recordCosts(mStageIndex, this->getLastWorkerCosts());
+            // Push/emplace tDatums if successfully processed
+            if (workersAreRunning)
+                pushOutput(tDatums);
+            // Close both queues otherwise
+            else
+            {
+                spTQueueIn->stop();
+                spTQueueOut->stopPusher();
+                spStagePlanner->setClosed(mStageIndex);
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            spTQueueIn->stop();
+            spTQueueOut->stop();
+            return true;
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void SubThreadQueueInOut<TDatums, TWorker, TQueue>::pushOutput(TDatums& tDatums)
+    {
+        try
+        {
+            // Next stage fused into this thread -> run it right away, skipping the output queue
+            if (tDatums != nullptr && (spNextStage == nullptr || !spNextStage->tryWorkFused(tDatums)))
+                spTQueueOut->waitAndEmplace(tDatums);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     COMPILE_TEMPLATE_DATUM(SubThreadQueueInOut);
 }
 
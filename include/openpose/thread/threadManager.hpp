@@ -2,11 +2,13 @@
 #define OPENPOSE_THREAD_THREAD_MANAGER_HPP
 
 #include <atomic>
+#include <map>
 #include <set> // std::multiset
 #include <tuple>
 #include <openpose/core/common.hpp>
 #include <openpose/thread/enumClasses.hpp>
 #include <openpose/thread/queue.hpp>
+#include <openpose/thread/stagePlanner.hpp>
 #include <openpose/thread/thread.hpp>
 #include <openpose/thread/worker.hpp>
 
@@ -38,6 +40,19 @@ namespace op
         void add(const unsigned long long threadId, const TWorker& tWorker, const unsigned long long queueInId,
                  const unsigned long long queueOutId);
 
+        /**
+         * It enables stage fusion (see StagePlanner) for the threads marked with setFusable().
+         */
+        void setStagePlanner(const std::shared_ptr<StagePlanner>& stagePlanner);
+
+        /**
+         * It marks the given thread as a fusable stage: As decided by the StagePlanner, its TWorkers could run
+         * directly in the thread feeding it (if that one is its only input, e.g., the single-GPU pose estimation
+         * thread), skipping the queue between both. Only for threads with a single set of TWorkers with an input and
+         * an output queue, none of them bound to its thread (e.g., no GPU or GUI). Ignored if no StagePlanner was set.
+         */
+        void setFusable(const unsigned long long threadId, const std::string& stageName);
+
         void reset();
 
         void exec();
@@ -75,6 +90,8 @@ namespace op
         std::multiset<std::tuple<unsigned long long, std::vector<TWorker>, unsigned long long, unsigned long long>> mThreadWorkerQueues;
         std::vector<std::shared_ptr<Thread<TDatums, TWorker>>> mThreads;
         std::vector<std::shared_ptr<TQueue>> mTQueues;
+        std::shared_ptr<StagePlanner> spStagePlanner;
+        std::map<unsigned long long, std::string> mFusableThreads;
 
         void add(const std::vector<std::tuple<unsigned long long, std::vector<TWorker>, unsigned long long, unsigned long long>>& threadWorkerQueues);
 
@@ -162,6 +179,33 @@ namespace op
         }
     }
 
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void ThreadManager<TDatums, TWorker, TQueue>::setStagePlanner(const std::shared_ptr<StagePlanner>& stagePlanner)
+    {
+        try
+        {
+            spStagePlanner = {stagePlanner};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    template<typename TDatums, typename TWorker, typename TQueue>
+    void ThreadManager<TDatums, TWorker, TQueue>::setFusable(
+        const unsigned long long threadId, const std::string& stageName)
+    {
+        try
+        {
+            mFusableThreads[threadId] = stageName;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template<typename TDatums, typename TWorker, typename TQueue>
     void ThreadManager<TDatums, TWorker, TQueue>::reset()
     {
@@ -170,6 +214,8 @@ namespace op
             mThreadWorkerQueues.clear();
             mThreads.clear();
             mTQueues.clear();
+            spStagePlanner.reset();
+            mFusableThreads.clear();
         }
         catch (const std::exception& e)
         {
@@ -409,15 +455,27 @@ namespace op
 
                 // Data
                 const auto maxQueueIdSynchronous = mTQueues.size()+1;
+                // Stage fusion: number of pushers and poppers of each queue id, and queue id -> SubThread pushing
+                // into it, its stage index (or -1 if it is not a stage yet) and its thread id
+                std::map<unsigned long long, std::pair<unsigned int, unsigned int>> queueUsers;
+                for (const auto& threadWorkerQueue : mThreadWorkerQueues)
+                {
+                    queueUsers[std::get<3>(threadWorkerQueue)].first++;
+                    queueUsers[std::get<2>(threadWorkerQueue)].second++;
+                }
+                std::map<unsigned long long, std::tuple<std::shared_ptr<SubThreadQueueInOut<TDatums, TWorker, TQueue>>,
+                                                        long long, unsigned long long>> queuePushers;
 
                 // Set up threads
                 for (const auto& threadWorkerQueue : mThreadWorkerQueues)
                 {
-                    auto& thread = mThreads[std::get<0>(threadWorkerQueue)];
+                    const auto threadId = std::get<0>(threadWorkerQueue);
+                    auto& thread = mThreads[threadId];
                     const auto& tWorkers = std::get<1>(threadWorkerQueue);
                     const auto queueIn = std::get<2>(threadWorkerQueue);
                     const auto queueOut = std::get<3>(threadWorkerQueue);
                     std::shared_ptr<SubThread<TDatums, TWorker>> subThread;
+                    std::shared_ptr<SubThreadQueueInOut<TDatums, TWorker, TQueue>> subThreadQueueInOut;
                     // If AsynchronousIn -> queue indexes are OK
                     if (mThreadManagerMode == ThreadManagerMode::Asynchronous
                         || mThreadManagerMode == ThreadManagerMode::AsynchronousIn)
@@ -427,7 +485,7 @@ namespace op
                             subThread = {std::make_shared<SubThreadQueueIn<TDatums, TWorker, TQueue>>(
                                 tWorkers, mTQueues.at(queueIn))};
                         else
-                            subThread = {std::make_shared<SubThreadQueueInOut<TDatums, TWorker, TQueue>>(
+                            subThreadQueueInOut = {std::make_shared<SubThreadQueueInOut<TDatums, TWorker, TQueue>>(
                                 tWorkers, mTQueues.at(queueIn), mTQueues.at(queueOut))};
                     }
                     // If !AsynchronousIn -> queue indexes - 1
@@ -436,7 +494,7 @@ namespace op
                     {
                         // Queue in + out
                         if (queueIn != 0)
-                            subThread = {std::make_shared<SubThreadQueueInOut<TDatums, TWorker, TQueue>>(
+                            subThreadQueueInOut = {std::make_shared<SubThreadQueueInOut<TDatums, TWorker, TQueue>>(
                                 tWorkers, mTQueues.at(queueIn-1), mTQueues.at(queueOut-1))};
                         // Case queue out (first TWorker(s))
                         else
@@ -450,6 +508,43 @@ namespace op
                     // Case no queue
                     else // if (queueIn == 0 && queueOut == maxQueueIdSynchronous)
                         subThread = {std::make_shared<SubThreadNoQueue<TDatums, TWorker>>(tWorkers)};
+                    if (subThreadQueueInOut != nullptr)
+                    {
+                        subThread = subThreadQueueInOut;
+                        // Fusable stage: only threads with a single SubThreadQueueInOut
+                        if (spStagePlanner != nullptr && mFusableThreads.count(threadId) > 0)
+                        {
+                            auto numberSubThreads = 0u;
+                            for (const auto& other : mThreadWorkerQueues)
+                                if (std::get<0>(other) == threadId)
+                                    numberSubThreads++;
+                            if (numberSubThreads == 1u)
+                            {
+                                // It can be fused into the SubThread feeding it if that one is its only input (of
+                                // any kind, e.g., the GPU pose estimation thread) and it is its only consumer
+                                auto previousStage = -1ll;
+                                const auto queuePusher = queuePushers.find(queueIn);
+                                if (queuePusher != queuePushers.end() && queueUsers[queueIn].first == 1u
+                                    && queueUsers[queueIn].second == 1u)
+                                {
+                                    auto& pusherStage = std::get<1>(queuePusher->second);
+                                    if (pusherStage < 0)
+                                        pusherStage = (long long)spStagePlanner->addStage(
+                                            "thread " + std::to_string(std::get<2>(queuePusher->second)));
+                                    previousStage = pusherStage;
+                                }
+                                const auto stageIndex = spStagePlanner->addStage(
+                                    mFusableThreads[threadId], previousStage);
+                                subThreadQueueInOut->setStage(spStagePlanner, stageIndex);
+                                if (previousStage >= 0)
+                                    std::get<0>(queuePusher->second)->setNextStage(subThreadQueueInOut);
+                                queuePushers[queueOut] = std::make_tuple(
+                                    subThreadQueueInOut, (long long)stageIndex, threadId);
+                            }
+                        }
+                        if (queuePushers.count(queueOut) == 0)
+                            queuePushers[queueOut] = std::make_tuple(subThreadQueueInOut, -1ll, threadId);
+                    }
                     thread->add(subThread);
                 }
             }
@@ -63,10 +63,16 @@ namespace op
                 // Profiling speed
                 const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
                 // Add ID
+                const auto captureNanoseconds = getSteadyTimeNanoseconds();
                 for (auto& tDatumPtr : *tDatums)
+                {
                     // To avoid overwriting ID if e.g., custom input has already filled it
                     if (tDatumPtr->id == std::numeric_limits<unsigned long long>::max())
                         tDatumPtr->id = mGlobalCounter;
+                    // Capture time (if not filled by the producer)
+                    if (tDatumPtr->captureNanoseconds == 0ull)
+                        tDatumPtr->captureNanoseconds = captureNanoseconds;
+                }
                 // Increase ID
                 const auto& tDatumPtr = (*tDatums)[0];
                 if (tDatumPtr->subId == tDatumPtr->subIdMax)
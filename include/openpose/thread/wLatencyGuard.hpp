@@ -0,0 +1,117 @@
+#ifndef OPENPOSE_THREAD_W_LATENCY_GUARD_HPP
+#define OPENPOSE_THREAD_W_LATENCY_GUARD_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/thread/enumClasses.hpp>
+#include <openpose/thread/latencyController.hpp>
+#include <openpose/thread/worker.hpp>
+
+namespace op
+{
+    /**
+     * Backpressure worker: It checks the age of each frame (from Datum::captureNanoseconds) and, if older than the
+     * LatencyController target, either drops it (LatencyAction::DropFrame) or empties its face or hand rectangles, so
+     * the following face or hand keypoint extractor skips that frame (LatencyAction::SkipFace and SkipHand).
+     * Multi-view frames are dropped as a whole (all the groups of views of the same ID, see
+     * LatencyController::dropIfStale), so WQueueOrderer and WQueueAssembler never receive part of a frame.
+     */
+    template<typename TDatums>
+    class WLatencyGuard : public Worker<TDatums>
+    {
+    public:
+        explicit WLatencyGuard(
+            const std::shared_ptr<LatencyController>& latencyController, const LatencyAction latencyAction);
+
+        virtual ~WLatencyGuard();
+
+        void initializationOnThread();
+
+        void work(TDatums& tDatums);
+
+    private:
+        const std::shared_ptr<LatencyController> spLatencyController;
+        const LatencyAction mLatencyAction;
+
+        DELETE_COPY(WLatencyGuard);
+    };
+}
+
+
+
+
+
+// Implementation
+#include <openpose/utilities/pointerContainer.hpp>
+namespace op
+{
+    template<typename TDatums>
+    WLatencyGuard<TDatums>::WLatencyGuard(
+        const std::shared_ptr<LatencyController>& latencyController, const LatencyAction latencyAction) :
+        spLatencyController{latencyController},
+        mLatencyAction{latencyAction}
+    {
+    }
+
+    template<typename TDatums>
+    WLatencyGuard<TDatums>::~WLatencyGuard()
+    {
+    }
+
+    template<typename TDatums>
+    void WLatencyGuard<TDatums>::initializationOnThread()
+    {
+    }
+
+    template<typename TDatums>
+    void WLatencyGuard<TDatums>::work(TDatums& tDatums)
+    {
+        try
+        {
+            if (checkNoNullNorEmpty(tDatums))
+            {
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Profiling speed
+                const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
+                // All the views of a frame share the same capture time
+                const auto& tDatumPtr = (*tDatums)[0];
+                // Drop frame (all its views)
+                if (mLatencyAction == LatencyAction::DropFrame)
+                {
+                    if (spLatencyController->dropIfStale(
+                        tDatumPtr->id, tDatumPtr->subIdMax, tDatums->size(), tDatumPtr->captureNanoseconds))
+                        tDatums = nullptr;
+                }
+                else if (spLatencyController->isStale(tDatumPtr->captureNanoseconds))
+                {
+                    // Skip face or hand keypoint detection (empty rectangles are ignored by the extractors)
+                    for (auto& tDatumIPtr : *tDatums)
+                    {
+                        if (mLatencyAction == LatencyAction::SkipFace)
+                            for (auto& faceRectangle : tDatumIPtr->faceRectangles)
+                                faceRectangle = Rectangle<float>{};
+                        else if (mLatencyAction == LatencyAction::SkipHand)
+                            for (auto& handRectangles : tDatumIPtr->handRectangles)
+                                handRectangles = std::array<Rectangle<float>, 2>{};
+                    }
+                    spLatencyController->recordSkip(mLatencyAction);
+                }
+                // Profiling speed
+                Profiler::timerEnd(profilerKey);
+                Profiler::printAveragedTimeMsOnIterationX(profilerKey, __LINE__, __FUNCTION__, __FILE__);
+                // Debugging log
+                opLogIfDebug("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            this->stop();
+            tDatums = nullptr;
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    COMPILE_TEMPLATE_DATUM(WLatencyGuard);
+}
+
+#endif // OPENPOSE_THREAD_W_LATENCY_GUARD_HPP
@@ -65,20 +65,29 @@ namespace op
             if (checkNoNullNorEmpty(tDatums))
             {
                 // Sanity check
-                if (tDatums->size() > 1)
+                if (tDatums->size() > 1 && (*tDatums)[0]->subIdMax == 0)
                     error("This function assumes that WQueueSplitter (inside WDatumProducer)"
-                          " was applied in the first place, i.e., that there is only 1 element"
-                          " per TDatums (size = " + std::to_string(tDatums->size()) + ").",
+                          " was applied in the first place, i.e., that each TDatums contains a group of consecutive"
+                          " views of the same frame (size = " + std::to_string(tDatums->size()) + ").",
                           __LINE__, __FUNCTION__, __FILE__);
-                auto tDatumPtr = (*tDatums)[0];
                 // Single view --> Return
-                if (tDatumPtr->subIdMax == 0)
+                if ((*tDatums)[0]->subIdMax == 0)
                     return;
+                // Multiple view --> Views of a new frame while the previous one is incomplete (e.g., part of it was
+                // lost) --> Discard the incomplete one rather than mixing both frames
+                if (mNextTDatums != nullptr && !mNextTDatums->empty()
+                    && mNextTDatums->back()->id != (*tDatums)[0]->id)
+                {
+                    opLog("Incomplete multi-view frame " + std::to_string(mNextTDatums->back()->id)
+                          + " discarded.", Priority::High);
+                    mNextTDatums = nullptr;
+                }
                 // Multiple view --> Merge views into different TDatums (1st frame)
                 if (mNextTDatums == nullptr)
                     mNextTDatums = std::make_shared<TDatums>();
-                // Multiple view --> Merge views into different TDatums
-                mNextTDatums->emplace_back(tDatumPtr);
+                // Multiple view --> Merge views (or groups of views) into different TDatums
+                for (const auto& tDatumPtr : *tDatums)
+                    mNextTDatums->emplace_back(tDatumPtr);
                 // Last view - Return frame
                 if (mNextTDatums->back()->subId == mNextTDatums->back()->subIdMax)
                 {
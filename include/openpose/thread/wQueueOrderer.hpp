@@ -3,6 +3,7 @@
 
 #include <queue> // std::priority_queue
 #include <openpose/core/common.hpp>
+#include <openpose/thread/latencyController.hpp>
 #include <openpose/thread/worker.hpp>
 #include <openpose/utilities/pointerContainer.hpp>
 
@@ -12,7 +13,12 @@ namespace op
     class WQueueOrderer : public Worker<TDatums>
     {
     public:
-        explicit WQueueOrderer(const unsigned int maxBufferSize = 64u);
+        /**
+         * @param latencyController If not nullptr, frames dropped by a previous WLatencyGuard are not waited for.
+         */
+        explicit WQueueOrderer(
+            const unsigned int maxBufferSize = 64u,
+            const std::shared_ptr<LatencyController>& latencyController = nullptr);
 
         virtual ~WQueueOrderer();
 
@@ -24,6 +30,7 @@ namespace op
 
     private:
         const unsigned int mMaxBufferSize;
+        const std::shared_ptr<LatencyController> spLatencyController;
         bool mStopWhenEmpty;
         unsigned long long mNextExpectedId;
         unsigned long long mNextExpectedSubId;
@@ -41,8 +48,10 @@ namespace op
 namespace op
 {
     template<typename TDatums>
-    WQueueOrderer<TDatums>::WQueueOrderer(const unsigned int maxBufferSize) :
+    WQueueOrderer<TDatums>::WQueueOrderer(
+        const unsigned int maxBufferSize, const std::shared_ptr<LatencyController>& latencyController) :
         mMaxBufferSize{maxBufferSize},
+        spLatencyController{latencyController},
         mStopWhenEmpty{false},
         mNextExpectedId{0},
         mNextExpectedSubId{0}
@@ -67,6 +76,15 @@ namespace op
             // Profiling speed
             const auto profilerKey = Profiler::timerInit(__LINE__, __FUNCTION__, __FILE__);
             bool profileSpeed = (tDatums != nullptr);
+            // Skip the IDs of the frames dropped by WLatencyGuard (none of their views will arrive)
+            if (spLatencyController != nullptr && mNextExpectedSubId == 0)
+            {
+                while (spLatencyController->popDrop(mNextExpectedId))
+                {
+                    mNextExpectedSubId = 0;
+                    mNextExpectedId++;
+                }
+            }
             // Input TDatum -> enqueue or return it back
             if (checkNoNullNorEmpty(tDatums))
             {
@@ -78,10 +96,10 @@ namespace op
                     // If single-view
                     if (tDatumsNoPtr[0]->subIdMax == 0)
                         mNextExpectedId++;
-                    // If muilti-view system
+                    // If muilti-view system (tDatums might contain a group of consecutive views)
                     else
                     {
-                        mNextExpectedSubId++;
+                        mNextExpectedSubId = tDatumsNoPtr.back()->subId + 1;
                         if (mNextExpectedSubId > tDatumsNoPtr[0]->subIdMax)
                         {
                             mNextExpectedSubId = 0;
@@ -126,7 +144,7 @@ namespace op
                 // If muilti-view system
                 else
                 {
-                    mNextExpectedSubId = tDatumsNoPtr[0]->subId + 1;
+                    mNextExpectedSubId = tDatumsNoPtr.back()->subId + 1;
                     if (mNextExpectedSubId > tDatumsNoPtr[0]->subIdMax)
                     {
                         mNextExpectedSubId = 0;
@@ -3,6 +3,7 @@
 
 // tracking module
 #include <openpose/tracking/personIdExtractor.hpp>
+#include <openpose/tracking/personRoiMosaic.hpp>
 #include <openpose/tracking/personTracker.hpp>
 #include <openpose/tracking/wPersonIdExtractor.hpp>
 
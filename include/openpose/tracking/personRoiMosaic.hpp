@@ -0,0 +1,76 @@
+#ifndef OPENPOSE_TRACKING_PERSON_ROI_MOSAIC_HPP
+#define OPENPOSE_TRACKING_PERSON_ROI_MOSAIC_HPP
+
+#include <openpose/core/common.hpp>
+#include <openpose/pose/enumClasses.hpp>
+
+namespace op
+{
+    /**
+     * ROI-cropped inference for static cameras. It keeps a set of active regions (one per group of nearby people),
+     * seeded by full-frame passes every fullFramePeriod frames and propagated between them from the detections of
+     * the previous frame (plus a motion margin and velocity extrapolation). In the remaining frames, those regions
+     * are packed into a mosaic image, so a single forward pass is run on a net input proportional to the occupied
+     * area (at the same scale than the full frame, and rounded up to multiples of a quarter of the frame size so the
+     * network only sees a few input sizes), and the resulting keypoints are mapped back to frame coordinates. Frames without active regions skip the network until the next full-frame pass.
+     * Thread-safe (it can be shared by several PoseExtractor instances).
+     */
+    class OP_API PersonRoiMosaic
+    {
+    public:
+        /**
+         * @param fullFramePeriod A full-frame pass is run every fullFramePeriod frames (to detect new people).
+         * @param roiMargin Margin added to each side of the person bounding boxes, relative to their size.
+         * @param maximumAreaRatio If the mosaic area is bigger than this ratio of the frame area, the full frame is
+         * processed instead.
+         */
+        PersonRoiMosaic(
+            const PoseModel poseModel, const int fullFramePeriod, const float roiMargin = 0.3f,
+            const float maximumAreaRatio = 0.6f);
+
+        virtual ~PersonRoiMosaic();
+
+        /**
+         * It returns false if the full frame must be processed (full-frame pass, no previous results, or mosaic not
+         * worth it). Otherwise, it fills the net input for the mosaic of the current regions (empty if there are no
+         * active regions, i.e., the network can be skipped for this frame), as well as the mosaic layout required
+         * by mosaicToFrame(). The full frame scaleInputToNetInputs are re-used for the mosaic.
+         */
+        bool createMosaicNetInput(
+            std::vector<Array<float>>& mosaicNetInput, std::vector<double>& mosaicScaleInputToNetInputs,
+            Point<int>& mosaicSize, std::vector<Rectangle<int>>& mosaicRegions,
+            std::vector<Point<int>>& mosaicOffsets, const Matrix& cvInputData,
+            const std::vector<double>& scaleInputToNetInputs, const unsigned long long frameId,
+            const unsigned long long imageViewIndex = 0ull);
+
+        /**
+         * It maps the keypoints detected on a mosaic back into the frame coordinates, removing the people outside
+         * of any region (and their poseScores).
+         * @param mosaicRegions Regions (frame coordinates) of the mosaic, as returned by createMosaicNetInput().
+         * @param mosaicOffsets Top-left corner of each region in the mosaic, as returned by createMosaicNetInput().
+         */
+        void mosaicToFrame(
+            Array<float>& poseKeypoints, Array<float>& poseScores, const std::vector<Rectangle<int>>& mosaicRegions,
+            const std::vector<Point<int>>& mosaicOffsets) const;
+
+        /**
+         * It updates the active regions with the final keypoints of frameId (in frame coordinates). Results of
+         * frames older than the last update (e.g., multi-GPU out-of-order processing) are ignored.
+         */
+        void update(
+            const Array<float>& poseKeypoints, const Point<int>& frameSize, const unsigned long long frameId,
+            const unsigned long long imageViewIndex = 0ull);
+
+    private:
+        // PIMPL idiom
+        // http://www.cppsamples.com/common-tasks/pimpl.html
+        struct ImplPersonRoiMosaic;
+        std::shared_ptr<ImplPersonRoiMosaic> spImpl;
+
+        // PIMP requires DELETE_COPY & destructor, or extra code
+        // http://oliora.github.io/2015/12/29/pimpl-and-rule-of-zero.html
+        DELETE_COPY(PersonRoiMosaic);
+    };
+}
+
+#endif // OPENPOSE_TRACKING_PERSON_ROI_MOSAIC_HPP
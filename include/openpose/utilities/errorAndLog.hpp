@@ -129,6 +129,36 @@ namespace op
 
         // This function is not thread-safe. It must be run at the beginning
         OP_API void setLogModes(const std::vector<LogMode>& loggingModes);
+
+        /**
+         * Asynchronous logging. If enabled, opLog() does not write anything. Instead, it pushes the message into a
+         * lock-free buffer of its thread (dropping it if the buffer is full), and a background thread writes all of
+         * them (sorted by call order) into the enabled LogModes, without blocking the caller. Error messages (error(),
+         * etc.) are still synchronous, but all the messages logged before them are written first.
+         * This function is not thread-safe. It must be run at the beginning (and at the end, if disabled again).
+         */
+        OP_API void setAsynchronous(const bool asynchronous);
+
+        OP_API bool getAsynchronous();
+
+        /**
+         * Rate limiting of asynchronous logging: Identical messages repeated by the same thread within this
+         * interval (in seconds) are dropped, and their count is reported with the next logged message. 0 disables
+         * it. Default: 1 second.
+         */
+        OP_API void setRepeatedMessageInterval(const double repeatedMessageInterval);
+
+        /**
+         * Asynchronous logging also writes binary structured records into this file (empty to disable it, default).
+         * Each record is: sequence (uint64), timestamp in microseconds since epoch (int64), thread index (uint32),
+         * priority (uint8), line (int32), number of previously dropped repetitions (uint32), and message, function
+         * and file (each one as its uint32 length followed by its characters). All in native endianness.
+         * This function is not thread-safe. It must be run before setAsynchronous(true).
+         */
+        OP_API void setBinaryRecordsPath(const std::string& binaryRecordsPath);
+
+        // It blocks until all the asynchronous messages logged so far are written. Thread-safe.
+        OP_API void flush();
     }
 }
 
@@ -23,11 +23,13 @@ namespace op
     // Determine type of frame source
     OP_API ProducerType flagsToProducerType(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath,
-        const int webcamIndex, const bool flirCamera);
+        const int webcamIndex, const bool flirCamera, const String& netOutputPath = String(""),
+        const String& multiStream = String(""));
 
     OP_API std::pair<ProducerType, String> flagsToProducer(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath = String(""),
-        const int webcamIndex = -1, const bool flirCamera = false, const int flirCameraIndex = -1);
+        const int webcamIndex = -1, const bool flirCamera = false, const int flirCameraIndex = -1,
+        const String& netOutputPath = String(""), const String& multiStream = String(""));
 
     OP_API std::vector<HeatMapType> flagsToHeatMaps(
         const bool heatMapsAddParts = false, const bool heatMapsAddBkg = false,
@@ -43,6 +45,12 @@ namespace op
      * E.g., const Point<int> resolution = flagsToPoint(resolutionString, "1280x720");
      */
     OP_API Point<int> flagsToPoint(const String& pointString, const String& pointExample);
+
+    /**
+     * E.g., const auto netInputSizeBuckets = flagsToNetResolutionBuckets(op::String(FLAGS_net_resolution_buckets));
+     * It returns an empty std::vector if bucketsString is empty.
+     */
+    OP_API std::vector<int> flagsToNetResolutionBuckets(const String& bucketsString);
 }
 
 #endif // OPENPOSE_UTILITIES_FLAGS_TO_OPEN_POSE_HPP
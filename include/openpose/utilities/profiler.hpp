@@ -21,6 +21,10 @@ namespace op
         const std::chrono::time_point<std::chrono::high_resolution_clock>& timerInit, const std::string& firstMessage,
         const std::string& secondMessage, const Priority priority);
 
+    // Monotonic time (std::chrono::steady_clock) in nanoseconds, e.g., to measure the latency of a frame between
+    // different threads
+    OP_API unsigned long long getSteadyTimeNanoseconds();
+
     // The following functions will run REPS times and average the final time in seconds. Usage example:
     //     const auto REPS = 1000;
     //     double time = 0.;
@@ -226,6 +226,7 @@ namespace op
             const auto writeJsonCleaned = formatAsDirectory(wrapperStructOutput.writeJson.getStdString());
             const auto writeHeatMapsCleaned = formatAsDirectory(wrapperStructOutput.writeHeatMaps.getStdString());
             const auto modelFolder = formatAsDirectory(wrapperStructPose.modelFolder.getStdString());
+            const auto modelCacheFolder = wrapperStructPose.modelCacheFolder.getStdString();
             opLog("writeImagesCleaned = " + writeImagesCleaned, Priority::Normal);
             opLog("writeKeypointCleaned = " + writeKeypointCleaned, Priority::Normal);
             opLog("writeJsonCleaned = " + writeJsonCleaned, Priority::Normal);
@@ -263,7 +264,8 @@ namespace op
                     producerSharedPtr, wrapperStructInput.frameFirst, wrapperStructInput.frameStep,
                     wrapperStructInput.frameLast, spVideoSeek
                 );
-                datumProducerW = std::make_shared<WDatumProducer<TDatum>>(datumProducer);
+                datumProducerW = std::make_shared<WDatumProducer<TDatum>>(
+                    datumProducer, wrapperStructInput.multiStreamBatch);
             }
             else
                 datumProducerW = nullptr;
@@ -286,19 +288,40 @@ namespace op
             std::vector<std::vector<TWorker>> poseTriangulationsWs;
             std::vector<std::vector<TWorker>> jointAngleEstimationsWs;
             std::vector<TWorker> postProcessingWs;
+            std::shared_ptr<ScaleAndSizeExtractor> scaleAndSizeExtractor;
+            // Latency target (backpressure)
+            std::shared_ptr<LatencyController> latencyController;
+            if (wrapperStructPose.latencyTargetMs > 0.)
+            {
+                // Dropped IDs only required by the WQueueOrderer of the multi-GPU version
+                const auto trackDroppedIds = (multiThreadEnabled && numberGpuThreads > 1);
+                latencyController = std::make_shared<LatencyController>(
+                    wrapperStructPose.latencyTargetMs, wrapperStructPose.latencyPolicy, trackDroppedIds);
+            }
+            const auto latencySkipFaceHand = (
+                latencyController != nullptr && latencyController->getPolicy() == LatencyPolicy::SkipFaceHand);
             if (numberGpuThreads > 0)
             {
                 // Get input scales and sizes
-                const auto scaleAndSizeExtractor = std::make_shared<ScaleAndSizeExtractor>(
+                scaleAndSizeExtractor = std::make_shared<ScaleAndSizeExtractor>(
                     wrapperStructPose.netInputSize, (float)wrapperStructPose.netInputSizeDynamicBehavior, finalOutputSize,
-                    wrapperStructPose.scalesNumber, wrapperStructPose.scaleGap);
+                    wrapperStructPose.scalesNumber, wrapperStructPose.scaleGap,
+                    (wrapperStructPose.poseMode == PoseMode::Enabled ? wrapperStructPose.netInputSizeAdaptive : 0.f),
+                    wrapperStructPose.netInputSizeBuckets);
                 scaleAndSizeExtractorW = std::make_shared<WScaleAndSizeExtractor<TDatumsSP>>(scaleAndSizeExtractor);
 
                 // Input cvMat to OpenPose input & output format
                 // Note: resize on GPU reduces accuracy about 0.1%
                 bool resizeOnCpu = true;
                 // const auto resizeOnCpu = (wrapperStructPose.poseMode != PoseMode::Enabled);
-                if (resizeOnCpu)
+                // CPU-only version: The input is resized and normalized by each pose extractor thread directly into
+                // its network input memory, avoiding 1 full-size float copy (and allocation) per scale and frame
+                // ROI mosaic: The pose extractor threads create it too, so it is only done for the frames that run the
+                // full-frame network (and not for the mosaic ones)
+                const auto netInputInPoseExtractor = (
+                    wrapperStructPose.poseMode == PoseMode::Enabled
+                    && (gpuMode == GpuMode::NoGpu || wrapperStructExtra.roiMosaic > 0));
+                if (resizeOnCpu && !netInputInPoseExtractor)
                 {
                     const auto gpuResize = false;
                     const auto cvMatToOpInput = std::make_shared<CvMatToOpInput>(
@@ -325,16 +348,37 @@ namespace op
                 if (wrapperStructPose.poseMode != PoseMode::Disabled)
                 {
                     // Pose estimators
+                    // Shape bucketing - 1 network workspace per bucket, plus 1 for bigger sizes, plus a few for the
+                    // (size-bucketed) ROI mosaics
+                    const auto maxNetWorkspaces = (unsigned int)wrapperStructPose.netInputSizeBuckets.size() + 1u
+                                                + (wrapperStructExtra.roiMosaic > 0 ? 4u : 0u);
                     for (auto gpuId = 0; gpuId < numberGpuThreads; gpuId++)
-                        poseExtractorNets.emplace_back(std::make_shared<PoseExtractorCaffe>(
-                            wrapperStructPose.poseModel, modelFolder, gpuId + gpuNumberStart,
-                            wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.addPartCandidates, wrapperStructPose.maximizePositives,
-                            wrapperStructPose.protoTxtPath.getStdString(),
-                            wrapperStructPose.caffeModelPath.getStdString(),
-                            wrapperStructPose.upsamplingRatio, wrapperStructPose.poseMode == PoseMode::Enabled,
-                            wrapperStructPose.enableGoogleLogging
-                        ));
+                    {
+                        // OpenCV DNN network + CPU post-processing (no Caffe)
+                        if (wrapperStructPose.openCvDnn)
+                            poseExtractorNets.emplace_back(std::make_shared<PoseExtractorOpenCv>(
+                                wrapperStructPose.poseModel, modelFolder, gpuId + gpuNumberStart,
+                                wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
+                                wrapperStructPose.addPartCandidates, wrapperStructPose.maximizePositives,
+                                wrapperStructPose.protoTxtPath.getStdString(),
+                                wrapperStructPose.caffeModelPath.getStdString(),
+                                wrapperStructPose.upsamplingRatio, wrapperStructPose.poseMode == PoseMode::Enabled,
+                                wrapperStructPose.temporalConnection, wrapperStructPose.openCvDnnBackend,
+                                wrapperStructPose.openCvDnnTarget, wrapperStructPose.openCvDnnPrecision,
+                                wrapperStructPose.openCvDnnThreads
+                            ));
+                        else
+                            poseExtractorNets.emplace_back(std::make_shared<PoseExtractorCaffe>(
+                                wrapperStructPose.poseModel, modelFolder, gpuId + gpuNumberStart,
+                                wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
+                                wrapperStructPose.addPartCandidates, wrapperStructPose.maximizePositives,
+                                wrapperStructPose.protoTxtPath.getStdString(),
+                                wrapperStructPose.caffeModelPath.getStdString(),
+                                wrapperStructPose.upsamplingRatio, wrapperStructPose.poseMode == PoseMode::Enabled,
+                                wrapperStructPose.enableGoogleLogging, wrapperStructPose.temporalConnection,
+                                maxNetWorkspaces, modelCacheFolder
+                            ));
+                    }
 
                     // Pose renderers
                     if (renderOutputGpu || renderModePose == RenderMode::Cpu)
@@ -363,7 +407,8 @@ namespace op
                             poseCpuRenderer = std::make_shared<PoseCpuRenderer>(
                                 wrapperStructPose.poseModel, wrapperStructPose.renderThreshold,
                                 wrapperStructPose.blendOriginalFrame, alphaKeypoint, alphaHeatMap,
-                                wrapperStructPose.defaultPartToRender);
+                                wrapperStructPose.defaultPartToRender, wrapperStructPose.heatMapTypes,
+                                wrapperStructPose.heatMapScaleMode);
                             cpuRenderers.emplace_back(std::make_shared<WPoseRenderer<TDatumsSP>>(poseCpuRenderer));
                         }
                     }
@@ -387,15 +432,19 @@ namespace op
                     if (wrapperStructExtra.tracking > -1)
                         personTrackers->emplace_back(
                             std::make_shared<PersonTracker>(wrapperStructExtra.tracking == 0));
+                    // ROI mosaic (shared among GPUs, so all of them propagate the same regions)
+                    const auto personRoiMosaic = (wrapperStructExtra.roiMosaic > 0
+                        ? std::make_shared<PersonRoiMosaic>(wrapperStructPose.poseModel, wrapperStructExtra.roiMosaic)
+                        : nullptr);
                     for (auto i = 0u; i < poseExtractorsWs.size(); i++)
                     {
                         // OpenPose keypoint detector + keepTopNPeople
                         //    + ID extractor (experimental) + tracking (experimental)
                         const auto poseExtractor = std::make_shared<PoseExtractor>(
                             poseExtractorNets.at(i), keepTopNPeople, personIdExtractor, personTrackers,
-                            wrapperStructPose.numberPeopleMax, wrapperStructExtra.tracking);
+                            wrapperStructPose.numberPeopleMax, wrapperStructExtra.tracking, personRoiMosaic);
                         // If we want the initial image resize on GPU
-                        if (cvMatToOpInputW == nullptr)
+                        if (cvMatToOpInputW == nullptr && !netInputInPoseExtractor)
                         {
                             const auto gpuResize = true;
                             const auto cvMatToOpInput = std::make_shared<CvMatToOpInput>(
@@ -412,7 +461,10 @@ namespace op
                                 std::make_shared<WCvMatToOpOutput<TDatumsSP>>(cvMatToOpOutputs.back()));
                         }
                         poseExtractorsWs.at(i).emplace_back(
-                            std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor));
+                            std::make_shared<WPoseExtractor<TDatumsSP>>(
+                                poseExtractor, !wrapperStructOutput.writeNetOutput.empty(),
+                                (netInputInPoseExtractor
+                                    ? std::make_shared<CvMatToOpInput>(wrapperStructPose.poseModel) : nullptr)));
                         // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractor<TDatumsSP>>(poseExtractor)};
                         // // Just OpenPose keypoint detector
                         // poseExtractorsWs.at(i) = {std::make_shared<WPoseExtractorNet<TDatumsSP>>(
@@ -476,7 +528,8 @@ namespace op
                         for (auto& wPose : poseExtractorsWs)
                         {
                             // 1 FaceDetectorOpenCV per thread, OpenCV face detector is not thread-safe
-                            const auto faceDetectorOpenCV = std::make_shared<FaceDetectorOpenCV>(modelFolder);
+                            const auto faceDetectorOpenCV = std::make_shared<FaceDetectorOpenCV>(
+                                modelFolder, wrapperStructFace.detectorPeriod);
                             wPose.emplace_back(
                                 std::make_shared<WFaceDetectorOpenCV<TDatumsSP>>(faceDetectorOpenCV)
                             );
@@ -495,9 +548,13 @@ namespace op
                         const auto faceExtractorNet = std::make_shared<FaceExtractorCaffe>(
                             wrapperStructFace.netInputSize, netOutputSize, modelFolder,
                             gpu + gpuNumberStart, wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.enableGoogleLogging
+                            wrapperStructPose.enableGoogleLogging, wrapperStructFace.reuseFrames, modelCacheFolder
                         );
                         faceExtractorNets.emplace_back(faceExtractorNet);
+                        // Skip stale frames
+                        if (latencySkipFaceHand)
+                            poseExtractorsWs.at(gpu).emplace_back(std::make_shared<WLatencyGuard<TDatumsSP>>(
+                                latencyController, LatencyAction::SkipFace));
                         poseExtractorsWs.at(gpu).emplace_back(
                             std::make_shared<WFaceExtractorNet<TDatumsSP>>(faceExtractorNet));
                     }
@@ -542,9 +599,13 @@ namespace op
                             wrapperStructHand.netInputSize, netOutputSize, modelFolder,
                             gpu + gpuNumberStart, wrapperStructHand.scalesNumber, wrapperStructHand.scaleRange,
                             wrapperStructPose.heatMapTypes, wrapperStructPose.heatMapScaleMode,
-                            wrapperStructPose.enableGoogleLogging
+                            wrapperStructPose.enableGoogleLogging, wrapperStructHand.reuseFrames, modelCacheFolder
                         );
                         handExtractorNets.emplace_back(handExtractorNet);
+                        // Skip stale frames
+                        if (latencySkipFaceHand)
+                            poseExtractorsWs.at(gpu).emplace_back(std::make_shared<WLatencyGuard<TDatumsSP>>(
+                                latencyController, LatencyAction::SkipHand));
                         poseExtractorsWs.at(gpu).emplace_back(
                             std::make_shared<WHandExtractorNet<TDatumsSP>>(handExtractorNet)
                             );
@@ -696,6 +757,10 @@ namespace op
                     postProcessingWs.emplace_back(std::make_shared<WOpOutputToCvMat<TDatumsSP>>(opOutputToCvMat));
                 }
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                // Adaptive net input resolution (it requires the keypoints in input resolution, so before re-scaling)
+                if (wrapperStructPose.poseMode == PoseMode::Enabled && wrapperStructPose.netInputSizeAdaptive > 0.f)
+                    postProcessingWs.emplace_back(
+                        std::make_shared<WScaleAndSizeUpdater<TDatumsSP>>(scaleAndSizeExtractor));
                 // Re-scale pose if desired
                 // If desired scale is not the current input
                 if (wrapperStructPose.keypointScaleMode != ScaleMode::InputResolution
@@ -757,6 +822,15 @@ namespace op
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
 #endif
+            // Publish keypoints (and optionally the rendered image) to other local processes though shared memory
+            if (!wrapperStructOutput.writeSharedMemory.empty())
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                const auto sharedMemorySender = std::make_shared<SharedMemorySender>(
+                    wrapperStructOutput.writeSharedMemory.getStdString(), wrapperStructOutput.writeSharedMemoryImage);
+                outputWs.emplace_back(std::make_shared<WSharedMemorySender<TDatumsSP>>(sharedMemorySender));
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             // Write people pose data on disk (json for OpenCV >= 3, xml, yml...)
             if (!writeKeypointCleaned.empty())
             {
@@ -796,12 +870,20 @@ namespace op
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            // Image writer pool (shared by the image and heat map savers)
+            std::shared_ptr<ImageWriterPool> imageWriterPool;
+            if ((!writeImagesCleaned.empty() || !writeHeatMapsCleaned.empty())
+                && (wrapperStructOutput.writeImagesThreads != 0 || wrapperStructOutput.writePngCompression != 9
+                    || wrapperStructOutput.writeJpgQuality != 100))
+                imageWriterPool = std::make_shared<ImageWriterPool>(
+                    wrapperStructOutput.writeImagesThreads, wrapperStructOutput.writeImagesMemory,
+                    wrapperStructOutput.writePngCompression, wrapperStructOutput.writeJpgQuality);
             // Write frames as desired image format on hard disk
             if (!writeImagesCleaned.empty())
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 const auto imageSaver = std::make_shared<ImageSaver>(
-                    writeImagesCleaned, wrapperStructOutput.writeImagesFormat.getStdString());
+                    writeImagesCleaned, wrapperStructOutput.writeImagesFormat.getStdString(), imageWriterPool);
                 outputWs.emplace_back(std::make_shared<WImageSaver<TDatumsSP>>(imageSaver));
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
@@ -838,7 +920,8 @@ namespace op
                 // Create video saver worker
                 const auto videoSaver = std::make_shared<VideoSaver>(
                     wrapperStructOutput.writeVideo.getStdString(), getCvFourcc('M','J','P','G'), originalVideoFps,
-                    (wrapperStructOutput.writeVideoWithAudio ? wrapperStructInput.producerString.getStdString() : ""));
+                    (wrapperStructOutput.writeVideoWithAudio ? wrapperStructInput.producerString.getStdString() : ""),
+                    wrapperStructOutput.writeVideoAsyncQueue, wrapperStructOutput.writeVideoAsyncDrop);
                 outputWs.emplace_back(std::make_shared<WVideoSaver<TDatumsSP>>(videoSaver));
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
@@ -859,10 +942,19 @@ namespace op
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 const auto heatMapSaver = std::make_shared<HeatMapSaver>(
-                    writeHeatMapsCleaned, wrapperStructOutput.writeHeatMapsFormat.getStdString());
+                    writeHeatMapsCleaned, wrapperStructOutput.writeHeatMapsFormat.getStdString(), imageWriterPool);
                 outputWs.emplace_back(std::make_shared<WHeatMapSaver<TDatumsSP>>(heatMapSaver));
             }
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            // Write raw network outputs on hard disk (to be replayed with ProducerType::NetOutput)
+            if (!wrapperStructOutput.writeNetOutput.empty())
+            {
+                opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                const auto netOutputSaver = std::make_shared<NetOutputSaver>(
+                    wrapperStructOutput.writeNetOutput.getStdString());
+                outputWs.emplace_back(std::make_shared<WNetOutputSaver<TDatumsSP>>(netOutputSaver));
+            }
+            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             // Add frame information for GUI
             const bool guiEnabled = (wrapperStructGui.displayMode != DisplayMode::NoDisplay);
             // If this WGuiInfoAdder instance is placed before the WImageSaver or WVideoSaver, then the resulting
@@ -933,7 +1025,8 @@ namespace op
                     if (!wrapperStructOutput.writeVideo3D.empty())
                     {
                         const auto videoSaver = std::make_shared<VideoSaver>(
-                            wrapperStructOutput.writeVideo3D.getStdString(), getCvFourcc('M','J','P','G'), originalVideoFps, "");
+                            wrapperStructOutput.writeVideo3D.getStdString(), getCvFourcc('M','J','P','G'), originalVideoFps, "",
+                            wrapperStructOutput.writeVideoAsyncQueue, wrapperStructOutput.writeVideoAsyncDrop);
                         videoSaver3DW = std::make_shared<WVideoSaver3D<TDatumsSP>>(videoSaver);
                     }
                 }
@@ -991,6 +1084,15 @@ namespace op
             // Thread Manager
             // Clean previous thread manager (avoid configure to crash the program if used more than once)
             threadManager.reset();
+            // Stage fusion (cheap consecutive stages run in the same thread)
+            if (wrapperStructPose.stageFusionMs > 0.)
+            {
+                if (multiThreadEnabled)
+                    threadManager.setStagePlanner(std::make_shared<StagePlanner>(wrapperStructPose.stageFusionMs));
+                else
+                    opLog("Multi-threading disabled, so `--stage_fusion` has no effect (all the stages already run"
+                          " in the same thread).", Priority::High);
+            }
             unsigned long long threadId = 0ull;
             auto queueIn = 0ull;
             auto queueOut = 1ull;
@@ -1047,6 +1149,11 @@ namespace op
             // Thread 1 or 2...X, queues 1 -> 2, X = 2 + #GPUs
             if (!poseExtractorsWs.empty())
             {
+                // Drop stale frames before any network (i.e., as soon as they are popped from the input queue)
+                if (latencyController != nullptr && latencyController->getPolicy() == LatencyPolicy::DropFrames)
+                    for (auto& wPose : poseExtractorsWs)
+                        wPose.insert(wPose.begin(), std::make_shared<WLatencyGuard<TDatumsSP>>(
+                            latencyController, LatencyAction::DropFrame));
                 if (multiThreadEnabled)
                 {
                     for (auto& wPose : poseExtractorsWs)
@@ -1060,9 +1167,11 @@ namespace op
                     // Sort frames - Required own thread
                     if (poseExtractorsWs.size() > 1u)
                     {
-                        const auto wQueueOrderer = std::make_shared<WQueueOrderer<TDatumsSP>>();
+                        const auto wQueueOrderer = std::make_shared<WQueueOrderer<TDatumsSP>>(
+                            64u, latencyController);
                         opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                         threadManager.add(threadId, wQueueOrderer, queueIn++, queueOut++);
+                        threadManager.setFusable(threadId, "pose sorting");
                         threadIdPP(threadId, multiThreadEnabled);
                     }
                 }
@@ -1084,6 +1193,7 @@ namespace op
                 // Assemble frames
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 threadManager.add(threadId, wQueueAssembler, queueIn++, queueOut++);
+                threadManager.setFusable(threadId, "3-D assembling");
                 threadIdPP(threadId, multiThreadEnabled);
                 // 3-D reconstruction
                 if (multiThreadEnabled)
@@ -1102,6 +1212,7 @@ namespace op
                         const auto wQueueOrderer = std::make_shared<WQueueOrderer<TDatumsSP>>();
                         opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                         threadManager.add(threadId, wQueueOrderer, queueIn++, queueOut++);
+                        threadManager.setFusable(threadId, "3-D sorting");
                         threadIdPP(threadId, multiThreadEnabled);
                     }
                 }
@@ -1135,6 +1246,7 @@ namespace op
                         const auto wQueueOrderer = std::make_shared<WQueueOrderer<TDatumsSP>>();
                         opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                         threadManager.add(threadId, wQueueOrderer, queueIn++, queueOut++);
+                        threadManager.setFusable(threadId, "joint angle sorting");
                         threadIdPP(threadId, multiThreadEnabled);
                     }
                 }
@@ -1172,17 +1284,25 @@ namespace op
                 else
                     outputWs = mergeVectors(outputWs, userPostProcessingWs);
             }
+            // Stage fusion: user output workers in the same thread are merged into the output stage, so it keeps a
+            // single set of workers and it can still be fused into the thread feeding it
+            const auto userOutputWsInOutputStage = (
+                !outputWs.empty() && !userOutputWs.empty() && !userOutputWsOnNewThread && multiThreadEnabled
+                && wrapperStructPose.stageFusionMs > 0.);
+            if (userOutputWsInOutputStage)
+                outputWs = mergeVectors(outputWs, userOutputWs);
             // Output workers
             if (!outputWs.empty())
             {
                 // Thread 4 or 5, queues 4 -> 5
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 threadManager.add(threadId, outputWs, queueIn++, queueOut++);
+                threadManager.setFusable(threadId, "output");
                 threadIdPP(threadId, multiThreadEnabled);
             }
             // User output worker
             // Thread Y, queues Q -> Q+1
-            if (!userOutputWs.empty())
+            if (!userOutputWs.empty() && !userOutputWsInOutputStage)
             {
                 if (userOutputWsOnNewThread)
                 {
@@ -1213,6 +1333,7 @@ namespace op
             {
                 opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
                 threadManager.add(threadId, wFpsMax, queueIn++, queueOut++);
+                threadManager.setFusable(threadId, "FPS limiting");
                 threadIdPP(threadId, multiThreadEnabled);
             }
         }
@@ -46,6 +46,13 @@ namespace op
          */
         int ikThreads;
 
+        /**
+         * Whether to enable ROI-cropped inference for static cameras. The value indicates the period (in frames) of
+         * the full-frame passes. Between them, only the regions around the people detected in the previous frame are
+         * processed (packed into a single mosaic image). Select 0 (default) to disable it.
+         */
+        int roiMosaic;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -53,7 +60,7 @@ namespace op
          */
         WrapperStructExtra(
             const bool reconstruct3d = false, const int minViews3d = -1, const bool identification = false,
-            const int tracking = -1, const int ikThreads = 0);
+            const int tracking = -1, const int ikThreads = 0, const int roiMosaic = 0);
     };
 }
 
@@ -61,6 +61,20 @@ namespace op
          */
         float renderThreshold;
 
+        /**
+         * Keypoint re-use for videos and webcams. If > 0, the face keypoints of a person whose face rectangle
+         * (driven by the body keypoints) and crop appearance barely changed since the last network run are re-used
+         * (motion-compensated) for up to this number of consecutive frames. If 0 (default), the network always runs.
+         */
+        int reuseFrames;
+
+        /**
+         * Only for Detector::OpenCV. If 0 (default), the OpenCV face detector processes the whole frame on every
+         * frame. Otherwise, it only processes the whole frame every detectorPeriod frames, and only the regions
+         * around the previous faces in between (for videos and webcams).
+         */
+        int detectorPeriod;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -70,7 +84,8 @@ namespace op
             const bool enable = false, const Detector detector = Detector::Body,
             const Point<int>& netInputSize = Point<int>{368, 368}, const RenderMode renderMode = RenderMode::Auto,
             const float alphaKeypoint = FACE_DEFAULT_ALPHA_KEYPOINT,
-            const float alphaHeatMap = FACE_DEFAULT_ALPHA_HEAT_MAP, const float renderThreshold = 0.4f);
+            const float alphaHeatMap = FACE_DEFAULT_ALPHA_HEAT_MAP, const float renderThreshold = 0.4f,
+            const int reuseFrames = 0, const int detectorPeriod = 0);
     };
 }
 
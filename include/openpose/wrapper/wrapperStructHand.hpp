@@ -80,6 +80,13 @@ namespace op
          */
         float renderThreshold;
 
+        /**
+         * Keypoint re-use for videos and webcams. If > 0, the hand keypoints of a person whose hand rectangle
+         * (driven by the body keypoints) and crop appearance barely changed since the last network run are re-used
+         * (motion-compensated) for up to this number of consecutive frames. If 0 (default), the network always runs.
+         */
+        int reuseFrames;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -90,7 +97,8 @@ namespace op
             const Point<int>& netInputSize = Point<int>{368, 368}, const int scalesNumber = 1,
             const float scaleRange = 0.4f, const RenderMode renderMode = RenderMode::Auto,
             const float alphaKeypoint = HAND_DEFAULT_ALPHA_KEYPOINT,
-            const float alphaHeatMap = HAND_DEFAULT_ALPHA_HEAT_MAP, const float renderThreshold = 0.2f);
+            const float alphaHeatMap = HAND_DEFAULT_ALPHA_HEAT_MAP, const float renderThreshold = 0.2f,
+            const int reuseFrames = 0);
     };
 }
 
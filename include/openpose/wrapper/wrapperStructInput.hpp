@@ -91,6 +91,14 @@ namespace op
          */
         int numberViews;
 
+        /**
+         * Number of streams processed together by the same pose extractor thread (only for
+         * ProducerType::MultiStream, see MultiStreamReader).
+         * Each frame of a MultiStreamReader contains 1 image per stream, and they are split into groups of this size,
+         * which are distributed over the GPU threads (1 means each stream of each frame is sent independently).
+         */
+        int multiStreamBatch;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -103,7 +111,7 @@ namespace op
             const bool realTimeProcessing = false, const bool frameFlip = false, const int frameRotate = 0,
             const bool framesRepeat = false, const Point<int>& cameraResolution = Point<int>{-1,-1},
             const String& cameraParameterPath = "models/cameraParameters/",
-            const bool undistortImage = false, const int numberViews = -1);
+            const bool undistortImage = false, const int numberViews = -1, const int multiStreamBatch = 1);
     };
 }
 
@@ -142,6 +142,59 @@ namespace op
          */
         String udpPort;
 
+        /**
+         * POSIX shared memory name (e.g., `/openpose`) to publish the keypoints, IDs and scores of each frame into a
+         * ring buffer readable by other local processes (see `openpose/filestream/sharedMemoryReader.h`).
+         * If it is empty (default), it is disabled.
+         */
+        String writeSharedMemory;
+
+        /**
+         * Whether to also publish the rendered image (cvOutputData) into the shared memory.
+         */
+        bool writeSharedMemoryImage;
+
+        /**
+         * Full file path to record the raw body network output of each frame (plus the input metadata required to
+         * replay it with ProducerType::NetOutput).
+         * If it is empty (default), it is disabled.
+         */
+        String writeNetOutput;
+
+        /**
+         * If > 0, writeVideo and writeVideo3D frames are encoded asynchronously by a dedicated encoder thread per
+         * output video, with a queue of up to writeVideoAsyncQueue frames (see VideoSaver).
+         * If 0 (default), frames are encoded synchronously.
+         */
+        int writeVideoAsyncQueue;
+
+        /**
+         * Only for writeVideoAsyncQueue > 0. Whether to drop new frames (rather than blocking) if the encoding queue
+         * is full.
+         */
+        bool writeVideoAsyncDrop;
+
+        /**
+         * Number of threads of the ImageWriterPool shared by writeImages and writeHeatMaps.
+         * If 0 (default), images are saved synchronously. If < 0, the number of hardware threads.
+         */
+        int writeImagesThreads;
+
+        /**
+         * Only for writeImagesThreads != 0. Maximum memory (in MB) of the images waiting to be saved.
+         */
+        int writeImagesMemory;
+
+        /**
+         * PNG compression level (0-9) of writeImages and writeHeatMaps.
+         */
+        int writePngCompression;
+
+        /**
+         * JPG quality (0-100) of writeImages and writeHeatMaps.
+         */
+        int writeJpgQuality;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -157,7 +210,11 @@ namespace op
             const String& writeHeatMaps = "", const String& writeHeatMapsFormat = "png",
             const String& writeVideo3D = "", const String& writeVideoAdam = "",
             const String& writeBvh = "", const String& udpHost = "",
-            const String& udpPort = "8051");
+            const String& udpPort = "8051", const String& writeSharedMemory = "",
+            const bool writeSharedMemoryImage = false, const String& writeNetOutput = "",
+            const int writeVideoAsyncQueue = 0, const bool writeVideoAsyncDrop = false,
+            const int writeImagesThreads = 0, const int writeImagesMemory = 512, const int writePngCompression = 9,
+            const int writeJpgQuality = 100);
     };
 }
 
@@ -3,9 +3,11 @@
 
 #include <openpose/core/common.hpp>
 #include <openpose/core/enumClasses.hpp>
+#include <openpose/net/enumClasses.hpp>
 #include <openpose/pose/enumClasses.hpp>
 #include <openpose/pose/poseParameters.hpp>
 #include <openpose/pose/poseParametersRender.hpp>
+#include <openpose/thread/enumClasses.hpp>
 #include <openpose/wrapper/enumClasses.hpp>
 
 namespace op
@@ -213,6 +215,82 @@ namespace op
          */
         bool enableGoogleLogging;
 
+        /**
+         * Adaptive net input resolution. If > 0, the net input resolution is reduced (to 75% or 50% of
+         * netInputSize) while the smallest person detected in the previous frames is at least this height (in net
+         * input pixels), and restored as soon as a person gets smaller or lost. If <= 0 (default), it is disabled.
+         */
+        float netInputSizeAdaptive;
+
+        /**
+         * Temporal body part connection (CPU version only, videos and webcams). If true, the body keypoints of the
+         * previous frame are used as prior to skip the PAF scores of the candidate pairs inconsistent with them,
+         * falling back to full scoring when a previous pairing is not confirmed. It speeds up crowded scenes.
+         */
+        bool temporalConnection;
+
+        /**
+         * Net input shape bucketing. If not empty, the -1 dimension of netInputSize is rounded up to the closest of
+         * these sizes (padding the remaining area), and each network keeps a pre-reshaped workspace per size. It
+         * avoids reshaping the network for almost each frame when the inputs have different resolutions (e.g., an
+         * image directory). If empty (default), it is disabled.
+         */
+        std::vector<int> netInputSizeBuckets;
+
+        /**
+         * Whether to run the body network with the OpenCV DNN module (NetOpenCv) and the body post-processing on
+         * CPU (PoseExtractorOpenCv) rather than Caffe. It requires neither Caffe nor CUDA. It is automatically
+         * enabled if OpenPose was compiled without Caffe but with OpenCV DNN.
+         */
+        bool openCvDnn;
+
+        /**
+         * OpenCV DNN backend. Only used if openCvDnn.
+         */
+        OpenCvDnnBackend openCvDnnBackend;
+
+        /**
+         * OpenCV DNN target device. Only used if openCvDnn.
+         */
+        OpenCvDnnTarget openCvDnnTarget;
+
+        /**
+         * OpenCV DNN precision. Only used if openCvDnn. OpenCvDnnPrecision::Int8 quantizes the network with the
+         * first frame as calibration data.
+         */
+        OpenCvDnnPrecision openCvDnnPrecision;
+
+        /**
+         * Number of OpenCV threads. Only used if openCvDnn. If <= 0 (default), OpenCV default value.
+         */
+        int openCvDnnThreads;
+
+        /**
+         * Folder of the weight cache (see NetCaffe). If not empty, the Caffe trained weights (pose, face, and hand)
+         * are memory-mapped from flat cache files in this folder (written in the first run) rather than parsed from
+         * the caffemodel files, speeding up the start-up. If empty (default), it is disabled.
+         */
+        String modelCacheFolder;
+
+        /**
+         * Maximum desired end-to-end latency (in milliseconds, from Datum::captureNanoseconds) of each frame. Stale
+         * frames are handled with latencyPolicy (see WLatencyGuard).
+         * If <= 0 (default), it is disabled.
+         */
+        double latencyTargetMs;
+
+        /**
+         * Backpressure policy for the frames older than latencyTargetMs.
+         */
+        LatencyPolicy latencyPolicy;
+
+        /**
+         * Maximum cost (in milliseconds per frame) of a group of consecutive pipeline stages fused into the thread
+         * feeding them (see StagePlanner). Only if multi-threading is enabled.
+         * If <= 0 (default), it is disabled and each stage runs in its own thread.
+         */
+        double stageFusionMs;
+
         /**
          * Constructor of the struct.
          * It has the recommended and default values we recommend for each element of the struct.
@@ -231,7 +309,14 @@ namespace op
             const ScaleMode heatMapScaleMode = ScaleMode::UnsignedChar, const bool addPartCandidates = false,
             const float renderThreshold = 0.05f, const int numberPeopleMax = -1, const bool maximizePositives = false,
             const double fpsMax = -1., const String& protoTxtPath = "", const String& caffeModelPath = "",
-            const float upsamplingRatio = 0.f, const bool enableGoogleLogging = true);
+            const float upsamplingRatio = 0.f, const bool enableGoogleLogging = true,
+            const float netInputSizeAdaptive = 0.f, const bool temporalConnection = false,
+            const std::vector<int>& netInputSizeBuckets = {}, const bool openCvDnn = false,
+            const OpenCvDnnBackend openCvDnnBackend = OpenCvDnnBackend::OpenCv,
+            const OpenCvDnnTarget openCvDnnTarget = OpenCvDnnTarget::Cpu,
+            const OpenCvDnnPrecision openCvDnnPrecision = OpenCvDnnPrecision::Fp32, const int openCvDnnThreads = -1,
+            const String& modelCacheFolder = "", const double latencyTargetMs = -1.,
+            const LatencyPolicy latencyPolicy = LatencyPolicy::DropFrames, const double stageFusionMs = -1.);
     };
 }
 
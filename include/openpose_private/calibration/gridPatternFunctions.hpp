@@ -17,6 +17,16 @@ namespace op
     std::pair<bool, std::vector<cv::Point2f>> findAccurateGridCorners(
         const cv::Mat& image, const cv::Size& gridInnerCorners);
 
+    /**
+     * Faster version of findAccurateGridCorners for high resolution images. It first looks for the grid on a
+     * downscaled copy of the image (whose biggest side is coarseMaxSide), and then refines the corners at sub-pixel
+     * level on the full resolution image. If the coarse pass fails, it falls back to findAccurateGridCorners.
+     * @param coarseMaxSide Maximum width or height of the image used for the coarse pass. Images smaller than this
+     * are directly processed at full resolution.
+     */
+    std::pair<bool, std::vector<cv::Point2f>> findAccurateGridCornersCoarseToFine(
+        const cv::Mat& image, const cv::Size& gridInnerCorners, const int coarseMaxSide = 1280);
+
     std::vector<cv::Point3f> getObjects3DVector(
         const cv::Size& gridInnerCorners, const float gridSquareSizeMm);
 
@@ -14,6 +14,13 @@ namespace op
     void resizeFixedAspectRatio(
         cv::Mat& resizedCvMat, const cv::Mat& cvMat, const double scaleFactor, const Point<int>& targetSize,
         const int borderMode = cv::BORDER_CONSTANT, const cv::Scalar& borderValue = cv::Scalar{0,0,0});
+
+    /**
+     * Horizontal concatenation of several views (e.g., multiple cameras or streams), which might have different
+     * resolutions: the views with a different height than the first one are resized to its height (keeping their
+     * aspect ratio).
+     */
+    void hconcatViews(cv::Mat& concatenatedCvMat, const std::vector<cv::Mat>& cvMats);
 }
 
 #endif // OPENPOSE_PRIVATE_UTILITIES_OPEN_CV_PRIVATE_HPP
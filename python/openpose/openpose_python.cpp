@@ -10,6 +10,9 @@
 #include <pybind11/stl_bind.h>
 #include <pybind11/numpy.h>
 #include <opencv2/core/core.hpp>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <stdexcept>
 
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<op::Datum>>);
@@ -78,12 +81,71 @@ namespace op
         }
     }
 
+    typedef std::shared_ptr<std::vector<std::shared_ptr<Datum>>> DatumsSP;
+    typedef py::array_t<unsigned char, py::array::c_style | py::array::forcecast> NumpyFrame;
+
+    // Zero-copy numpy view of an op::Array. The resulting numpy array keeps `base` (i.e., the Python object owning
+    // the op::Array, such as the Datum) alive, so the memory is not released while the view exists.
+    template<typename T>
+    py::object getArrayView(const Array<T>& array, const py::object& base)
+    {
+        if (array.empty())
+            return py::none();
+        const auto sizes = array.getSize();
+        const auto strides = array.getStride();
+        return py::array_t<T>(
+            std::vector<size_t>(sizes.begin(), sizes.end()), std::vector<size_t>(strides.begin(), strides.end()),
+            array.getConstPtr(), base);
+    }
+
+    // Result of WrapperPython::submit(). It also keeps the input numpy frame alive until it has been processed, given
+    // that the input Datum only borrows its memory (no copy).
+    class DatumsFuture{
+    public:
+        DatumsFuture(const std::shared_future<DatumsSP>& future, const NumpyFrame& frame) :
+            mFuture{future},
+            mFrame{frame}
+        {
+        }
+
+        ~DatumsFuture()
+        {
+            // The frame memory cannot be released while OpenPose is still reading it
+            if (mFuture.valid())
+            {
+                py::gil_scoped_release release;
+                mFuture.wait();
+            }
+        }
+
+        bool ready() const
+        {
+            return mFuture.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+        }
+
+        std::vector<std::shared_ptr<Datum>> get()
+        {
+            // Wait without the GIL, so other Python threads can keep submitting/processing frames
+            {
+                py::gil_scoped_release release;
+                mFuture.wait();
+            }
+            const auto datumsPtr = mFuture.get();
+            return (datumsPtr != nullptr ? *datumsPtr : std::vector<std::shared_ptr<Datum>>{});
+        }
+
+    private:
+        std::shared_future<DatumsSP> mFuture;
+        NumpyFrame mFrame;
+    };
+
     class WrapperPython{
     public:
         std::unique_ptr<Wrapper> opWrapper;
         bool synchronousIn;
 
-        WrapperPython(ThreadManagerMode mode = ThreadManagerMode::Asynchronous)
+        WrapperPython(ThreadManagerMode mode = ThreadManagerMode::Asynchronous) :
+            mThreadManagerMode{mode}
         {
             opLog("Starting OpenPose Python Wrapper...", Priority::High);
 
@@ -97,6 +159,24 @@ namespace op
             );
         }
 
+        ~WrapperPython()
+        {
+            try
+            {
+                // Stopping the wrapper unblocks waitAndPop(), so the output thread can finish
+                if (mPopThread.joinable())
+                {
+                    py::gil_scoped_release release;
+                    opWrapper->stop();
+                    mPopThread.join();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
         void configure(py::dict params = py::dict())
         {
             try
@@ -109,6 +189,9 @@ namespace op
                     0 <= FLAGS_logging_level && FLAGS_logging_level <= 255, "Wrong logging_level value.",
                     __LINE__, __FUNCTION__, __FILE__);
                 ConfigureLog::setPriorityThreshold((Priority)FLAGS_logging_level);
+                // logging_async
+                ConfigureLog::setBinaryRecordsPath(FLAGS_logging_records);
+                ConfigureLog::setAsynchronous(FLAGS_logging_async);
                 Profiler::setDefaultX(FLAGS_profile_speed);
 
                 // Applying user defined configuration - GFlags to program variables
@@ -135,7 +218,7 @@ namespace op
                                                               FLAGS_heatmaps_add_PAFs);
                 const auto heatMapScaleMode = flagsToHeatMapScaleMode(FLAGS_heatmaps_scale);
                 // >1 camera view?
-                const auto multipleView = (FLAGS_3d || FLAGS_3d_views > 1);
+                const auto multipleView = (FLAGS_3d || FLAGS_3d_views > 1 || !FLAGS_multi_stream.empty());
                 // Face and hand detectors
                 const auto faceDetector = flagsToDetector(FLAGS_face_detector);
                 const auto handDetector = flagsToDetector(FLAGS_hand_detector);
@@ -150,23 +233,32 @@ namespace op
                     (float)FLAGS_alpha_pose, (float)FLAGS_alpha_heatmap, FLAGS_part_to_show, op::String(FLAGS_model_folder),
                     heatMapTypes, heatMapScaleMode, FLAGS_part_candidates, (float)FLAGS_render_threshold,
                     FLAGS_number_people_max, FLAGS_maximize_positives, FLAGS_fps_max, op::String(FLAGS_prototxt_path),
-                    op::String(FLAGS_caffemodel_path), (float)FLAGS_upsampling_ratio, enableGoogleLogging};
+                    op::String(FLAGS_caffemodel_path), (float)FLAGS_upsampling_ratio, enableGoogleLogging,
+                    (float)FLAGS_net_resolution_adaptive, FLAGS_temporal_connection,
+                    op::flagsToNetResolutionBuckets(op::String(FLAGS_net_resolution_buckets)), FLAGS_opencv_dnn,
+                    (op::OpenCvDnnBackend)FLAGS_opencv_dnn_backend, (op::OpenCvDnnTarget)FLAGS_opencv_dnn_target,
+                    (op::OpenCvDnnPrecision)FLAGS_opencv_dnn_precision, FLAGS_opencv_dnn_threads,
+                    op::String(FLAGS_model_cache_folder), FLAGS_latency_target,
+                    (op::LatencyPolicy)FLAGS_latency_policy, FLAGS_stage_fusion};
                 opWrapper->configure(wrapperStructPose);
                 // Face configuration (use WrapperStructFace{} to disable it)
                 const WrapperStructFace wrapperStructFace{
                     FLAGS_face, faceDetector, faceNetInputSize,
                     flagsToRenderMode(FLAGS_face_render, multipleView, FLAGS_render_pose),
-                    (float)FLAGS_face_alpha_pose, (float)FLAGS_face_alpha_heatmap, (float)FLAGS_face_render_threshold};
+                    (float)FLAGS_face_alpha_pose, (float)FLAGS_face_alpha_heatmap, (float)FLAGS_face_render_threshold,
+                    FLAGS_face_reuse_frames, FLAGS_face_detector_period};
                 opWrapper->configure(wrapperStructFace);
                 // Hand configuration (use WrapperStructHand{} to disable it)
                 const WrapperStructHand wrapperStructHand{
                     FLAGS_hand, handDetector, handNetInputSize, FLAGS_hand_scale_number, (float)FLAGS_hand_scale_range,
                     flagsToRenderMode(FLAGS_hand_render, multipleView, FLAGS_render_pose), (float)FLAGS_hand_alpha_pose,
-                    (float)FLAGS_hand_alpha_heatmap, (float)FLAGS_hand_render_threshold};
+                    (float)FLAGS_hand_alpha_heatmap, (float)FLAGS_hand_render_threshold,
+                    FLAGS_hand_reuse_frames};
                 opWrapper->configure(wrapperStructHand);
                 // Extra functionality configuration (use WrapperStructExtra{} to disable it)
                 const WrapperStructExtra wrapperStructExtra{
-                    FLAGS_3d, FLAGS_3d_min_views, FLAGS_identification, FLAGS_tracking, FLAGS_ik_threads};
+                    FLAGS_3d, FLAGS_3d_min_views, FLAGS_identification, FLAGS_tracking, FLAGS_ik_threads,
+                    FLAGS_roi_mosaic};
                 opWrapper->configure(wrapperStructExtra);
                 // Output (comment or use default argument to disable any output)
                 const WrapperStructOutput wrapperStructOutput{
@@ -176,7 +268,10 @@ namespace op
                     op::String(FLAGS_write_video), FLAGS_write_video_fps, FLAGS_write_video_with_audio,
                     op::String(FLAGS_write_heatmaps), op::String(FLAGS_write_heatmaps_format), op::String(FLAGS_write_video_3d),
                     op::String(FLAGS_write_video_adam), op::String(FLAGS_write_bvh), op::String(FLAGS_udp_host),
-                    op::String(FLAGS_udp_port)};
+                    op::String(FLAGS_udp_port), op::String(FLAGS_write_shared_memory),
+                    FLAGS_write_shared_memory_image, op::String(FLAGS_write_net_output), FLAGS_write_video_async_queue,
+                    FLAGS_write_video_async_drop, FLAGS_write_images_threads, FLAGS_write_images_memory,
+                    FLAGS_write_png_compression, FLAGS_write_jpg_quality};
                 opWrapper->configure(wrapperStructOutput);
                 if (synchronousIn) {
                     // SynchronousIn => We need a producer
@@ -187,11 +282,13 @@ namespace op
                     op::String producerString;
                     std::tie(producerType, producerString) = flagsToProducer(
                         op::String(FLAGS_image_dir), op::String(FLAGS_video), op::String(FLAGS_ip_camera), FLAGS_camera,
-                        FLAGS_flir_camera, FLAGS_flir_camera_index);
+                        FLAGS_flir_camera, FLAGS_flir_camera_index, op::String(FLAGS_net_output),
+                        op::String(FLAGS_multi_stream));
                     const WrapperStructInput wrapperStructInput{
                         producerType, producerString, FLAGS_frame_first, FLAGS_frame_step, FLAGS_frame_last,
                         FLAGS_process_real_time, FLAGS_frame_flip, FLAGS_frame_rotate, FLAGS_frames_repeat,
-                        cameraSize, op::String(FLAGS_camera_parameter_path), FLAGS_frame_undistort, FLAGS_3d_views};
+                        cameraSize, op::String(FLAGS_camera_parameter_path), FLAGS_frame_undistort, FLAGS_3d_views,
+                        FLAGS_multi_stream_batch};
                     opWrapper->configure(wrapperStructInput);
                 }
                 // No GUI. Equivalent to: opWrapper.configure(WrapperStructGui{});
@@ -297,6 +394,144 @@ namespace op
                 return false;
             }
         }
+
+        // Asynchronous zero-copy API: The numpy frame (BGR, uint8, HxWx3) is wrapped into the Datum without
+        // copying it, and the GIL is released while OpenPose processes it. Results are retrieved through the
+        // returned DatumsFuture. It requires ThreadManagerMode::Asynchronous and should not be mixed with
+        // waitAndPop() or emplaceAndPop() on the same wrapper.
+        std::shared_ptr<DatumsFuture> submit(const NumpyFrame& frame)
+        {
+            try
+            {
+                // Sanity checks
+                if (mThreadManagerMode != ThreadManagerMode::Asynchronous)
+                    error("submit() requires ThreadManagerMode.Asynchronous.", __LINE__, __FUNCTION__, __FILE__);
+                if (frame.ndim() != 3 || frame.shape(2) != 3)
+                    error("submit() expects BGR images with shape (height, width, 3).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Wrap numpy frame (no copy)
+                auto datumsPtr = std::make_shared<std::vector<std::shared_ptr<Datum>>>();
+                datumsPtr->emplace_back(std::make_shared<Datum>());
+                datumsPtr->at(0)->cvInputData = Matrix(
+                    (int)frame.shape(0), (int)frame.shape(1), CV_8UC3, (void*)frame.data());
+                auto promise = std::make_shared<std::promise<DatumsSP>>();
+                const std::shared_future<DatumsSP> future{promise->get_future()};
+                // Emplace without the GIL (it might block if the input queue is full)
+                {
+                    py::gil_scoped_release release;
+                    // Pending promises are fulfilled in the same order than the frames were emplaced
+                    const std::lock_guard<std::mutex> lockSubmit{mSubmitMutex};
+                    if (!mPopThread.joinable())
+                        mPopThread = std::thread{&WrapperPython::popLoop, this};
+                    {
+                        const std::lock_guard<std::mutex> lockPending{mPendingMutex};
+                        mPendingPromises.emplace_back(promise);
+                    }
+                    if (!opWrapper->waitAndEmplace(datumsPtr))
+                    {
+                        const std::lock_guard<std::mutex> lockPending{mPendingMutex};
+                        mPendingPromises.pop_back();
+                        promise->set_exception(std::make_exception_ptr(
+                            std::runtime_error("Frame could not be emplaced, is the wrapper running?")));
+                    }
+                }
+                return std::make_shared<DatumsFuture>(future, frame);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
+        std::vector<std::shared_ptr<DatumsFuture>> submitBatch(const std::vector<NumpyFrame>& frames)
+        {
+            try
+            {
+                std::vector<std::shared_ptr<DatumsFuture>> futures;
+                futures.reserve(frames.size());
+                for (const auto& frame : frames)
+                    futures.emplace_back(submit(frame));
+                return futures;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return {};
+            }
+        }
+
+        // Synchronous version of submitBatch(): All frames are pipelined through OpenPose, and the results are
+        // returned in the same order.
+        std::vector<std::vector<std::shared_ptr<Datum>>> processBatch(const std::vector<NumpyFrame>& frames)
+        {
+            try
+            {
+                auto futures = submitBatch(frames);
+                std::vector<std::vector<std::shared_ptr<Datum>>> results;
+                results.reserve(futures.size());
+                for (auto& future : futures)
+                    results.emplace_back(future->get());
+                return results;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return {};
+            }
+        }
+
+    private:
+        const ThreadManagerMode mThreadManagerMode;
+        std::thread mPopThread;
+        std::mutex mSubmitMutex;
+        std::mutex mPendingMutex;
+        std::deque<std::shared_ptr<std::promise<DatumsSP>>> mPendingPromises;
+
+        // Runs without the GIL: It only touches C++ objects
+        void popLoop()
+        {
+            try
+            {
+                DatumsSP datumsPtr;
+                while (opWrapper->waitAndPop(datumsPtr))
+                {
+                    std::shared_ptr<std::promise<DatumsSP>> promise;
+                    {
+                        const std::lock_guard<std::mutex> lock{mPendingMutex};
+                        if (!mPendingPromises.empty())
+                        {
+                            promise = mPendingPromises.front();
+                            mPendingPromises.pop_front();
+                        }
+                    }
+                    if (promise == nullptr)
+                        opLog("Popped a frame that was not submitted with submit(). Do not mix submit() with"
+                              " emplaceAndPop() or waitAndPop().", Priority::High);
+                    else
+                    {
+                        // cvInputData borrows the numpy frame memory, which might be released after the future
+                        // is resolved
+                        if (datumsPtr != nullptr)
+                            for (auto& datumPtr : *datumsPtr)
+                                datumPtr->cvInputData = Matrix();
+                        promise->set_value(datumsPtr);
+                    }
+                    datumsPtr = nullptr;
+                }
+                // Wrapper stopped - Release the frames that will never be processed
+                const std::lock_guard<std::mutex> lock{mPendingMutex};
+                for (auto& promise : mPendingPromises)
+                    promise->set_exception(std::make_exception_ptr(
+                        std::runtime_error("OpenPose wrapper stopped before the frame was processed.")));
+                mPendingPromises.clear();
+            }
+            catch (const std::exception& e)
+            {
+                // Exceptions cannot leave the thread
+                opLog(std::string{"Error on the output thread: "} + e.what(), Priority::Max);
+            }
+        }
     };
 
     std::vector<std::string> getImagesFromDirectory(const std::string& directoryPath)
@@ -343,9 +578,18 @@ namespace op
             .def("start", &WrapperPython::start)
             .def("stop", &WrapperPython::stop)
             .def("execute", &WrapperPython::exec)
-            .def("emplaceAndPop", &WrapperPython::emplaceAndPop)
-            .def("waitAndEmplace", &WrapperPython::waitAndEmplace)
-            .def("waitAndPop", &WrapperPython::waitAndPop)
+            .def("emplaceAndPop", &WrapperPython::emplaceAndPop, py::call_guard<py::gil_scoped_release>())
+            .def("waitAndEmplace", &WrapperPython::waitAndEmplace, py::call_guard<py::gil_scoped_release>())
+            .def("waitAndPop", &WrapperPython::waitAndPop, py::call_guard<py::gil_scoped_release>())
+            .def("submit", &WrapperPython::submit)
+            .def("submitBatch", &WrapperPython::submitBatch)
+            .def("processBatch", &WrapperPython::processBatch)
+            ;
+
+        // DatumsFuture (returned by WrapperPython.submit)
+        py::class_<DatumsFuture, std::shared_ptr<DatumsFuture>>(m, "DatumsFuture")
+            .def("ready", &DatumsFuture::ready)
+            .def("get", &DatumsFuture::get)
             ;
 
         // ThreadManagerMode
@@ -393,6 +637,19 @@ namespace op
             .def_readwrite("netOutputSize", &Datum::netOutputSize)
             .def_readwrite("scaleNetToOutput", &Datum::scaleNetToOutput)
             .def_readwrite("elementRendered", &Datum::elementRendered)
+            // Zero-copy (read-only by convention) numpy views, they keep the Datum alive
+            .def_property_readonly("poseKeypointsView", [](const py::object& self) {
+                return getArrayView(self.cast<const Datum&>().poseKeypoints, self); })
+            .def_property_readonly("poseIdsView", [](const py::object& self) {
+                return getArrayView(self.cast<const Datum&>().poseIds, self); })
+            .def_property_readonly("poseScoresView", [](const py::object& self) {
+                return getArrayView(self.cast<const Datum&>().poseScores, self); })
+            .def_property_readonly("faceKeypointsView", [](const py::object& self) {
+                return getArrayView(self.cast<const Datum&>().faceKeypoints, self); })
+            .def_property_readonly("handKeypointsView", [](const py::object& self) {
+                const auto& handKeypoints = self.cast<const Datum&>().handKeypoints;
+                return py::make_tuple(
+                    getArrayView(handKeypoints[0], self), getArrayView(handKeypoints[1], self)); })
             ;
 
         py::bind_vector<std::vector<std::shared_ptr<Datum>>>(m, "VectorDatum");
@@ -1,5 +1,7 @@
 #include <openpose/calibration/cameraParameterEstimation.hpp>
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <numeric> // std::accumulate
 #ifdef USE_CERES
     #include <ceres/ceres.h>
@@ -81,26 +83,111 @@ namespace op
         }
     }
 
-    std::vector<std::pair<cv::Mat, std::string>> getImageAndPaths(const std::string& imageDirectoryPath)
+    struct GridCorners
+    {
+        bool found;
+        std::vector<cv::Point2f> points2DVector;
+        cv::Size imageSize;
+    };
+
+    void findGridCornersSubThread(
+        std::vector<GridCorners>* gridCornersPtr, std::atomic<unsigned long long>* nextImageIndexPtr,
+        std::string* errorMessagePtr, std::mutex* errorMutexPtr, const std::vector<std::string>& imagePaths,
+        const cv::Size& gridInnerCornersCvSize, const bool showWarning,
+        const std::vector<std::string>& imagesWithCornersPaths)
     {
         try
         {
-            // Get images on directory
-            const auto imagePaths = getImagePaths(imageDirectoryPath);
-            // Check #files > 0
-            if (imagePaths.empty())
-                error("No images were found on `" + imageDirectoryPath + "`.", __LINE__, __FUNCTION__, __FILE__);
-            // Read images
-            std::vector<std::pair<cv::Mat, std::string>> imageAndPaths;
-            for (const auto& imagePath : imagePaths)
+            auto& gridCorners = *gridCornersPtr;
+            // Each thread only keeps 1 decoded image at a time, so memory is bounded by the number of threads
+            for (auto imageIndex = (*nextImageIndexPtr)++ ; imageIndex < imagePaths.size() ;
+                 imageIndex = (*nextImageIndexPtr)++)
             {
-                imageAndPaths.emplace_back(std::make_pair(cv::imread(imagePath, CV_LOAD_IMAGE_COLOR), imagePath));
-                if (imageAndPaths.back().first.empty())
+                const auto& imagePath = imagePaths[imageIndex];
+                const cv::Mat image = cv::imread(imagePath, CV_LOAD_IMAGE_COLOR);
+                if (image.empty())
                     error("Image could not be opened from path `" + imagePath + "`.",
                           __LINE__, __FUNCTION__, __FILE__);
+                auto& result = gridCorners[imageIndex];
+                result.imageSize = image.size();
+
+                // Find grid corners (coarse pass on a downscaled image + full resolution sub-pixel refinement)
+                std::tie(result.found, result.points2DVector) = findAccurateGridCornersCoarseToFine(
+                    image, gridInnerCornersCvSize);
+
+                // Reorder 2D pixels points
+                if (result.found)
+                    reorderPoints(result.points2DVector, gridInnerCornersCvSize, image, showWarning);
+
+                // Debugging (optional) - Save image (with chessboard corners if found)
+                if (!imagesWithCornersPaths.empty())
+                {
+                    cv::Mat imageToPlot = image.clone();
+                    if (result.found)
+                        drawGridCorners(imageToPlot, gridInnerCornersCvSize, result.points2DVector);
+                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
+                    // was "only" modified at that time, not created
+                    remove(imagesWithCornersPaths[imageIndex].c_str());
+                    const auto opMat = OP_CV2OPMAT(imageToPlot);
+                    saveImage(opMat, imagesWithCornersPaths[imageIndex]);
+                }
             }
+        }
+        catch (const std::exception& e)
+        {
+            // Exceptions cannot cross the thread boundaries, the caller will throw it after joining the threads
+            const std::lock_guard<std::mutex> lock{*errorMutexPtr};
+            if (errorMessagePtr->empty())
+                *errorMessagePtr = e.what();
+            // Make the other threads finish early
+            *nextImageIndexPtr = imagePaths.size();
+        }
+    }
+
+    std::vector<GridCorners> findGridCornersOnImagePaths(
+        cv::Size& imageSize, const std::vector<std::string>& imagePaths, const cv::Size& gridInnerCornersCvSize,
+        const bool showWarning, const std::vector<std::string>& imagesWithCornersPaths = {})
+    {
+        try
+        {
+            // Sanity checks
+            if (imagePaths.empty())
+                error("No image paths were provided.", __LINE__, __FUNCTION__, __FILE__);
+            if (!imagesWithCornersPaths.empty() && imagesWithCornersPaths.size() != imagePaths.size())
+                error("imagesWithCornersPaths must be empty or have the same size than imagePaths.",
+                      __LINE__, __FUNCTION__, __FILE__);
+
+            // Streaming & parallel grid detection: Images are read and processed by a pool of threads, each one
+            // taking the next image to process, so at most numberThreads images are in memory simultaneously
+            std::vector<GridCorners> gridCorners(imagePaths.size());
+            std::atomic<unsigned long long> nextImageIndex{0ull};
+            std::string errorMessage;
+            std::mutex errorMutex;
+            const auto numberThreads = (unsigned int)std::max(1ull, std::min(
+                (unsigned long long)std::thread::hardware_concurrency(), (unsigned long long)imagePaths.size()));
+            opLog("Detecting grid corners on " + std::to_string(imagePaths.size()) + " images with "
+                + std::to_string(numberThreads) + " threads...", Priority::High);
+            std::vector<std::thread> threads;
+            for (auto thread = 0u ; thread < numberThreads ; thread++)
+                threads.emplace_back(
+                    findGridCornersSubThread, &gridCorners, &nextImageIndex, &errorMessage, &errorMutex,
+                    std::cref(imagePaths), std::cref(gridInnerCornersCvSize), showWarning,
+                    std::cref(imagesWithCornersPaths));
+            for (auto& thread : threads)
+                if (thread.joinable())
+                    thread.join();
+            if (!errorMessage.empty())
+                error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+
+            // Sanity check
+            imageSize = gridCorners.at(0).imageSize;
+            for (auto i = 0u ; i < gridCorners.size() ; i++)
+                if (imageSize != gridCorners[i].imageSize)
+                    error("Detected images with different sizes (e.g., `" + imagePaths[i] + "`). All images"
+                          " must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
+
             // Return result
-            return imageAndPaths;
+            return gridCorners;
         }
         catch (const std::exception& e)
         {
@@ -109,6 +196,22 @@ namespace op
         }
     }
 
+    void removeLeftoverImagesWithCorners(const std::string& pathPrefix, const unsigned long long firstIndex)
+    {
+        try
+        {
+            // Remove leftovers/previous files
+            const std::string extension{".png"};
+            auto fileRemoved = true;
+            for (auto i = firstIndex ; fileRemoved ; i++)
+                fileRemoved = {remove((pathPrefix + std::to_string(i+1) + extension).c_str()) == 0};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     std::pair<double, std::vector<double>> calcReprojectionErrors(
         const std::vector<std::vector<cv::Point3f>>& objects3DVectors,
         const std::vector<std::vector<cv::Point2f>>& points2DVectors, const std::vector<cv::Mat>& rVecs,
@@ -735,11 +838,10 @@ namespace op
         }
     }
 
-    void estimateAndSaveSiftFileSubThread(
+    void estimateAndSaveSiftFileCamera(
         std::vector<cv::Point2f>* points2DExtrinsicPtr, std::vector<unsigned int>* matchIndexesCameraPtr,
         const int cameraIndex, const int numberCameras, const int numberCorners, const unsigned int numberViews,
-        const bool saveImagesWithCorners, const std::string& imageFolder, const cv::Size& gridInnerCornersCvSize,
-        const cv::Size& imageSize, const std::vector<std::pair<cv::Mat, std::string>>& imageAndPaths,
+        const std::vector<GridCorners>& gridCorners, const std::vector<std::string>& imagePaths,
         const bool saveSIFTFile)
     {
         try
@@ -754,93 +856,78 @@ namespace op
             // Estimate and save SIFT file
             std::vector<cv::Point2f>& points2DExtrinsic = *points2DExtrinsicPtr;
             std::vector<unsigned int>& matchIndexesCamera = *matchIndexesCameraPtr;
-            std::vector<cv::Mat> imagesWithCorners;
             for (auto viewIndex = 0u ; viewIndex < numberViews ; viewIndex++)
             {
-                // Get right image
-                const auto& imageAndPath = imageAndPaths.at(viewIndex * numberCameras + cameraIndex);
-                const auto& image = imageAndPath.first;
-
-                if (viewIndex % std::max(1, int(numberViews/4)) == 0)
-                    opLog("Camera " + std::to_string(cameraIndex) + " - Image view "
-                        + std::to_string(viewIndex+1) + "/" + std::to_string(numberViews),
-                        Priority::High);
-
-                // Sanity check
-                if (imageSize.width != image.cols || imageSize.height != image.rows)
-                    error("Detected images with different sizes in `" + imageFolder + "` All images"
-                          " must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
-
-                // Find grid corners
-                bool found;
-                std::vector<cv::Point2f> points2DVector;
-                std::tie(found, points2DVector) = findAccurateGridCorners(image, gridInnerCornersCvSize);
+                // Get right grid corners (already found and reordered)
+                const auto& gridCornersView = gridCorners.at(viewIndex * numberCameras + cameraIndex);
 
-                // Reorder & save 2D pixels points
-                if (found)
+                // Save 2D pixels points
+                if (gridCornersView.found)
                 {
-                    reorderPoints(points2DVector, gridInnerCornersCvSize, image);
+                    points2DExtrinsic.insert(
+                        points2DExtrinsic.end(), gridCornersView.points2DVector.begin(),
+                        gridCornersView.points2DVector.end());
                     for (auto i = 0 ; i < numberCorners ; i++)
                         matchIndexesCamera.emplace_back(viewIndex * numberCorners + i);
                 }
                 else
                 {
-                    points2DVector.clear();
-                    points2DVector.resize(numberCorners, cv::Point2f{-1.f,-1.f});
+                    points2DExtrinsic.insert(points2DExtrinsic.end(), numberCorners, cv::Point2f{-1.f,-1.f});
                     opLog("Camera " + std::to_string(cameraIndex) + " - Image view "
                         + std::to_string(viewIndex+1) + "/" + std::to_string(numberViews)
                         + " - Chessboard not found.", Priority::High);
                 }
-                points2DExtrinsic.insert(points2DExtrinsic.end(), points2DVector.begin(), points2DVector.end());
-
-                // Show image (with chessboard corners if found)
-                if (saveImagesWithCorners)
-                {
-                    cv::Mat imageToPlot = image.clone();
-                    if (found)
-                        drawGridCorners(imageToPlot, gridInnerCornersCvSize, points2DVector);
-                    imagesWithCorners.emplace_back(imageToPlot);
-                }
             }
 
             // Save *.sift file for camera
             if (saveSIFTFile)
             {
-                // const auto fileName = getFullFilePathNoExtension(imageAndPaths.at(cameraIndex).second) + ".sift";
-                const auto fileName = getFileParentFolderPath(imageAndPaths.at(cameraIndex).second)
+                // const auto fileName = getFullFilePathNoExtension(imagePaths.at(cameraIndex)) + ".sift";
+                const auto fileName = getFileParentFolderPath(imagePaths.at(cameraIndex))
                                     + getFileNameFromCameraIndex(cameraIndex) + ".sift";
                 writeVisualSFMSiftGPU(fileName, points2DExtrinsic);
             }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
 
-            // Save images with corners
+    std::vector<GridCorners> findGridCornersMultiView(
+        cv::Size& imageSize, const std::vector<std::string>& imagePaths, const cv::Size& gridInnerCornersCvSize,
+        const int numberCameras, const bool saveImagesWithCorners, const std::string& imageFolder)
+    {
+        try
+        {
+            // Images are sorted as view0-camera0, view0-camera1, ..., view1-camera0, etc.
+            std::vector<std::string> imagesWithCornersPaths;
             if (saveImagesWithCorners)
             {
                 const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
                 // Create directory in case it did not exist
                 makeDirectory(folderWhereSavingImages);
-                const auto pathWhereSavingImages = folderWhereSavingImages + std::to_string(cameraIndex) + "_";
-                // Save new images
-                const std::string extension{".png"};
-                auto fileRemoved = true;
-                for (auto i = 0u ; i < imagesWithCorners.size() || fileRemoved; i++)
+                const auto numberViews = (unsigned long long)(imagePaths.size() / numberCameras);
+                imagesWithCornersPaths.resize(imagePaths.size());
+                for (auto i = 0u ; i < imagePaths.size() ; i++)
                 {
-                    const auto finalPath = pathWhereSavingImages + std::to_string(i+1) + extension;
-                    // remove leftovers/previous files
-                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
-                    // was "only" modified at that time, not created
-                    fileRemoved = {remove(finalPath.c_str()) == 0};
-                    // save images on hhd in the desired place
-                    if (i < imagesWithCorners.size())
-                    {
-                        const auto opMat = OP_CV2OPMAT(imagesWithCorners.at(i));
-                        saveImage(opMat, finalPath);
-                    }
+                    const auto cameraIndex = i % numberCameras;
+                    const auto viewIndex = i / numberCameras;
+                    imagesWithCornersPaths[i] = folderWhereSavingImages + std::to_string(cameraIndex) + "_"
+                                              + std::to_string(viewIndex+1) + ".png";
                 }
+                for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
+                    removeLeftoverImagesWithCorners(
+                        folderWhereSavingImages + std::to_string(cameraIndex) + "_", numberViews);
             }
+            const auto showWarning = true;
+            return findGridCornersOnImagePaths(
+                imageSize, imagePaths, gridInnerCornersCvSize, showWarning, imagesWithCornersPaths);
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
         }
     }
 
@@ -866,52 +953,36 @@ namespace op
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
 
-            // Read images in folder
+            // Get images in folder
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-            const auto imageAndPaths = getImageAndPaths(imageFolder);
+            const auto imagePaths = getImagePaths(imageFolder);
+
+            // Debugging (optional) - Where to save the images with corners
+            std::vector<std::string> imagesWithCornersPaths;
+            if (saveImagesWithCorners)
+            {
+                const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
+                // Create directory in case it did not exist
+                makeDirectory(folderWhereSavingImages);
+                for (auto i = 0u ; i < imagePaths.size() ; i++)
+                    imagesWithCornersPaths.emplace_back(folderWhereSavingImages + std::to_string(i+1) + ".png");
+                removeLeftoverImagesWithCorners(folderWhereSavingImages, imagePaths.size());
+            }
 
-            // Get 2D grid corners of each image
+            // Get 2D grid corners of each image (streamed & parallelized, images are not kept in memory)
+            // For intrinsics order is irrelevant, so I do not care if reordering fails
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            cv::Size imageSize;
+            const auto showWarning = false;
+            const auto gridCorners = findGridCornersOnImagePaths(
+                imageSize, imagePaths, gridInnerCornersCvSize, showWarning, imagesWithCornersPaths);
             std::vector<std::vector<cv::Point2f>> points2DVectors;
-            std::vector<cv::Mat> imagesWithCorners;
-            const auto imageSize = imageAndPaths.at(0).first.size();
-            for (auto i = 0u ; i < imageAndPaths.size() ; i++)
+            for (auto i = 0u ; i < gridCorners.size() ; i++)
             {
-                opLog("\nImage " + std::to_string(i+1) + "/" + std::to_string(imageAndPaths.size()), Priority::High);
-                const auto& image = imageAndPaths.at(i).first;
-
-                // Sanity check
-                if (imageSize.width != image.cols || imageSize.height != image.rows)
-                    error("Detected images with different sizes in `" + imageFolder + "` All images"
-                          " must have the same resolution.", __LINE__, __FUNCTION__, __FILE__);
-
-                // Find grid corners
-                bool found;
-                std::vector<cv::Point2f> points2DVector;
-                std::tie(found, points2DVector) = findAccurateGridCorners(image, gridInnerCornersCvSize);
-
-                // Reorder & save 2D pixels points
-                if (found)
-                {
-                    // For intrinsics order is irrelevant, so I do not care if it fails
-                    const auto showWarning = false;
-                    reorderPoints(points2DVector, gridInnerCornersCvSize, image, showWarning);
-                    points2DVectors.emplace_back(points2DVector);
-                }
+                if (gridCorners[i].found)
+                    points2DVectors.emplace_back(gridCorners[i].points2DVector);
                 else
-                    opLog("Chessboard not found in image " + imageAndPaths.at(i).second + ".", Priority::High);
-
-                // Debugging (optional) - Show image (with chessboard corners if found)
-                if (saveImagesWithCorners)
-                {
-                    cv::Mat imageToPlot = image.clone();
-                    if (found)
-                        drawGridCorners(imageToPlot, gridInnerCornersCvSize, points2DVector);
-                    // cv::pyrDown(imageToPlot, imageToPlot);
-                    // cv::imshow("Image View", imageToPlot);
-                    // cv::waitKey(delayMilliseconds);
-                    imagesWithCorners.emplace_back(imageToPlot);
-                }
+                    opLog("Chessboard not found in image " + imagePaths[i] + ".", Priority::High);
             }
             // Sanity check
             if (points2DVectors.empty())
@@ -931,32 +1002,6 @@ namespace op
             CameraParameterReader cameraParameterReader{
                 serialNumber, opCameraMatrix, opDistortionCoefficients };
             cameraParameterReader.writeParameters(outputParameterFolder);
-
-            // Debugging (optional) - Save images with corners
-            opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
-            if (saveImagesWithCorners)
-            {
-                const auto folderWhereSavingImages = imageFolder + "images_with_corners/";
-                // Create directory in case it did not exist
-                makeDirectory(folderWhereSavingImages);
-                // Save new images
-                const std::string extension{".png"};
-                auto fileRemoved = true;
-                for (auto i = 0u ; i < imagesWithCorners.size() || fileRemoved; i++)
-                {
-                    const auto finalPath = folderWhereSavingImages + std::to_string(i+1) + extension;
-                    // remove leftovers/previous files
-                    // Note: If file is not deleted before cv::imwrite, Windows considers that the file
-                    // was "only" modified at that time, not created
-                    fileRemoved = {remove(finalPath.c_str()) == 0};
-                    // save images on hhd in the desired place
-                    if (i < imagesWithCorners.size())
-                    {
-                        const auto opMat = OP_CV2OPMAT(imagesWithCorners.at(i));
-                        saveImage(opMat, finalPath);
-                    }
-                }
-            }
         }
         catch (const std::exception& e)
         {
@@ -2119,9 +2164,9 @@ namespace op
                     error("This mode assumes that the images are already undistorted (add flag `--omit_distortion`).",
                           __LINE__, __FUNCTION__, __FILE__);
 
-                opLog("Loading images...", Priority::High);
-                const auto imageAndPaths = getImageAndPaths(imageFolder);
-                opLog("Images loaded.", Priority::High);
+                opLog("Loading image paths...", Priority::High);
+                const auto imagePaths = getImagePaths(imageFolder);
+                opLog("Image paths loaded.", Priority::High);
 
                 // Point<int> --> cv::Size
                 const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
@@ -2160,45 +2205,28 @@ namespace op
                 const auto cameraDistortions = (
                     imagesAreUndistorted
                     ? std::vector<Matrix>{cameraIntrinsics.size()} : cameraParameterReader.getCameraDistortions());
-                // Read images in folder
+                // Get 2D grid corners of each image (streamed & parallelized, images are not kept in memory)
                 opLog("Reading images in folder...", Priority::High);
                 const auto numberCorners = gridInnerCorners.area();
                 std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic(numberCameras); // camera - keypoints
                 std::vector<std::vector<unsigned int>> matchIndexes(numberCameras); // camera - indixes found
-                if (imageAndPaths.empty())
-                    error("imageAndPaths.empty()!.", __LINE__, __FUNCTION__, __FILE__);
+                cv::Size imageSize;
+                const auto gridCorners = findGridCornersMultiView(
+                    imageSize, imagePaths, gridInnerCornersCvSize, numberCameras, saveImagesWithCorners,
+                    imageFolder);
                 opLog("Images read.", Priority::High);
-                // Get 2D grid corners of each image
-                std::vector<cv::Mat> imagesWithCorners;
-                const auto imageSize = imageAndPaths.at(0).first.size();
-                const auto numberViews = (unsigned int)(imageAndPaths.size() / numberCameras);
+                const auto numberViews = (unsigned int)(imagePaths.size() / numberCameras);
                 opLog("Processing cameras...", Priority::High);
-                std::vector<std::thread> threads;
                 for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
-                {
-                    auto* points2DExtrinsic = &points2DVectorsExtrinsic[cameraIndex];
-                    auto* matchIndexesCamera = &matchIndexes[cameraIndex];
-                    // Threaded version
-                    threads.emplace_back(estimateAndSaveSiftFileSubThread, points2DExtrinsic,
-                                         matchIndexesCamera, cameraIndex, numberCameras,
-                                         numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                                         gridInnerCornersCvSize, imageSize, imageAndPaths, saveVisualSFMFiles);
-                    // // Non-threaded version
-                    // estimateAndSaveSiftFileSubThread(points2DExtrinsic, matchIndexesCamera, cameraIndex, numberCameras,
-                    //                                  numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                    //                                  gridInnerCornersCvSize, imageSize, imageAndPaths,
-                    //                                  saveVisualSFMFiles);
-                }
-                // Threaded version
-                for (auto& thread : threads)
-                    if (thread.joinable())
-                        thread.join();
+                    estimateAndSaveSiftFileCamera(
+                        &points2DVectorsExtrinsic[cameraIndex], &matchIndexes[cameraIndex], cameraIndex,
+                        numberCameras, numberCorners, numberViews, gridCorners, imagePaths, saveVisualSFMFiles);
 
                 // Matching file
                 if (saveVisualSFMFiles)
                 {
                     std::ofstream ofstreamMatches{
-                        getFileParentFolderPath(imageAndPaths.at(0).second) + "FeatureMatches.txt"};
+                        getFileParentFolderPath(imagePaths.at(0)) + "FeatureMatches.txt"};
                     for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
                     {
                         for (auto cameraIndex2 = cameraIndex+1 ; cameraIndex2 < numberCameras ; cameraIndex2++)
@@ -2210,8 +2238,8 @@ namespace op
 
                             ofstreamMatches << getFileNameFromCameraIndex(cameraIndex) << ".jpg"
                                             << " " << getFileNameFromCameraIndex(cameraIndex2) << ".jpg"
-                            // ofstreamMatches << getFileNameAndExtension(imageAndPaths.at(cameraIndex).second)
-                            //                 << " " << getFileNameAndExtension(imageAndPaths.at(cameraIndex2).second)
+                            // ofstreamMatches << getFileNameAndExtension(imagePaths.at(cameraIndex))
+                            //                 << " " << getFileNameAndExtension(imagePaths.at(cameraIndex2))
                                             << " " << matchIndexesIntersection.size() << "\n";
                             for (auto reps = 0 ; reps < 2 ; reps++)
                             {
@@ -2342,48 +2370,32 @@ namespace op
     {
         try
         {
-            opLog("Loading images...", Priority::High);
-            const auto imageAndPaths = getImageAndPaths(imageFolder);
-            opLog("Images loaded.", Priority::High);
+            opLog("Loading image paths...", Priority::High);
+            const auto imagePaths = getImagePaths(imageFolder);
+            opLog("Image paths loaded.", Priority::High);
 
             // Point<int> --> cv::Size
             const cv::Size gridInnerCornersCvSize{gridInnerCorners.x, gridInnerCorners.y};
 
-            // Read images in folder
+            // Get 2D grid corners of each image (streamed & parallelized, images are not kept in memory)
             const auto numberCorners = gridInnerCorners.area();
             std::vector<std::vector<cv::Point2f>> points2DVectorsExtrinsic(numberCameras); // camera - keypoints
             std::vector<std::vector<unsigned int>> matchIndexes(numberCameras); // camera - indixes found
-            if (imageAndPaths.empty())
-                error("imageAndPaths.empty()!.", __LINE__, __FUNCTION__, __FILE__);
-
-            // Get 2D grid corners of each image
-            std::vector<cv::Mat> imagesWithCorners;
-            const auto imageSize = imageAndPaths.at(0).first.size();
-            const auto numberViews = (unsigned int)(imageAndPaths.size() / numberCameras);
+            cv::Size imageSize;
+            const auto gridCorners = findGridCornersMultiView(
+                imageSize, imagePaths, gridInnerCornersCvSize, numberCameras, saveImagesWithCorners, imageFolder);
+            const auto numberViews = (unsigned int)(imagePaths.size() / numberCameras);
             opLog("Processing cameras...", Priority::High);
-            std::vector<std::thread> threads;
             for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
             {
-                auto* points2DExtrinsic = &points2DVectorsExtrinsic[cameraIndex];
-                auto* matchIndexesCamera = &matchIndexes[cameraIndex];
-                // Threaded version
                 const auto saveSIFTFile = true;
-                threads.emplace_back(estimateAndSaveSiftFileSubThread, points2DExtrinsic,
-                                     matchIndexesCamera, cameraIndex, numberCameras,
-                                     numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                                     gridInnerCornersCvSize, imageSize, imageAndPaths, saveSIFTFile);
-                // // Non-threaded version
-                // estimateAndSaveSiftFileSubThread(points2DExtrinsic, matchIndexesCamera, cameraIndex, numberCameras,
-                //                                  numberCorners, numberViews, saveImagesWithCorners, imageFolder,
-                //                                  gridInnerCornersCvSize, imageSize, imageAndPaths, saveSIFTFile);
+                estimateAndSaveSiftFileCamera(
+                    &points2DVectorsExtrinsic[cameraIndex], &matchIndexes[cameraIndex], cameraIndex, numberCameras,
+                    numberCorners, numberViews, gridCorners, imagePaths, saveSIFTFile);
             }
-            // Threaded version
-            for (auto& thread : threads)
-                if (thread.joinable())
-                    thread.join();
 
             // Matching file
-            std::ofstream ofstreamMatches{getFileParentFolderPath(imageAndPaths.at(0).second) + "FeatureMatches.txt"};
+            std::ofstream ofstreamMatches{getFileParentFolderPath(imagePaths.at(0)) + "FeatureMatches.txt"};
             for (auto cameraIndex = 0 ; cameraIndex < numberCameras ; cameraIndex++)
             {
                 for (auto cameraIndex2 = cameraIndex+1 ; cameraIndex2 < numberCameras ; cameraIndex2++)
@@ -2395,8 +2407,8 @@ namespace op
 
                     ofstreamMatches << getFileNameFromCameraIndex(cameraIndex) << ".jpg"
                                     << " " << getFileNameFromCameraIndex(cameraIndex2) << ".jpg"
-                    // ofstreamMatches << getFileNameAndExtension(imageAndPaths.at(cameraIndex).second)
-                    //                 << " " << getFileNameAndExtension(imageAndPaths.at(cameraIndex2).second)
+                    // ofstreamMatches << getFileNameAndExtension(imagePaths.at(cameraIndex))
+                    //                 << " " << getFileNameAndExtension(imagePaths.at(cameraIndex2))
                                     << " " << matchIndexesIntersection.size() << "\n";
                     for (auto reps = 0 ; reps < 2 ; reps++)
                     {
@@ -234,6 +234,48 @@ namespace op
         }
     }
 
+    std::pair<bool, std::vector<cv::Point2f>> findAccurateGridCornersCoarseToFine(
+        const cv::Mat& image, const cv::Size& gridInnerCorners, const int coarseMaxSide)
+    {
+        try
+        {
+            // Grayscale for speeding up
+            cv::Mat imageGray;
+            cv::cvtColor(image, imageGray, CV_BGR2GRAY);
+
+            // Coarse pass on a downscaled image (only worth it for big images)
+            const auto maxSide = std::max(imageGray.cols, imageGray.rows);
+            if (coarseMaxSide > 0 && maxSide > coarseMaxSide)
+            {
+                const auto scale = coarseMaxSide / (double)maxSide;
+                cv::Mat imageGrayCoarse;
+                cv::resize(imageGray, imageGrayCoarse, cv::Size{}, scale, scale, cv::INTER_AREA);
+                auto foundGridCornersAndLocations = mediumlyTryToFindGridCorners(imageGrayCoarse, gridInnerCorners);
+                if (foundGridCornersAndLocations.first)
+                {
+                    // Back to full resolution
+                    const auto scaleInverse = float(1. / scale);
+                    for (auto& point : foundGridCornersAndLocations.second)
+                        point *= scaleInverse;
+                    // Fine pass - Sub-pixel refinement at full resolution
+                    improveCornersPositionsAtSubPixelLevel(foundGridCornersAndLocations.second, imageGray);
+                    return foundGridCornersAndLocations;
+                }
+            }
+
+            // Full resolution pass (small images, or coarse pass failed)
+            auto foundGridCornersAndLocations = heavilyTryToFindGridCorners(imageGray, gridInnerCorners);
+            if (foundGridCornersAndLocations.first)
+                improveCornersPositionsAtSubPixelLevel(foundGridCornersAndLocations.second, imageGray);
+            return foundGridCornersAndLocations;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return std::make_pair(false, std::vector<cv::Point2f>());
+        }
+    }
+
     std::vector<cv::Point3f> getObjects3DVector(
         const cv::Size& gridInnerCorners, const float gridSquareSizeMm)
     {
@@ -2,7 +2,7 @@
 #include <typeinfo> // typeid
 #include <numeric> // std::accumulate
 #include <opencv2/core/core.hpp> // cv::Mat
-#include <openpose_private/utilities/avx.hpp>
+#include <openpose/core/arrayAllocator.hpp>
 
 // Note: std::shared_ptr not (fully) supported for array pointers:
 // http://stackoverflow.com/questions/8947579/
@@ -198,6 +198,7 @@ namespace op
         mVolume{array.mVolume},
         spData{array.spData},
         pData{array.pData},
+        mCapacity{array.mCapacity},
         mCvMatData{array.mCvMatData}
     {
     }
@@ -211,6 +212,7 @@ namespace op
             mVolume = array.mVolume;
             spData = array.spData;
             pData = array.pData;
+            mCapacity = array.mCapacity;
             mCvMatData = array.mCvMatData;
             // Return
             return *this;
@@ -225,7 +227,8 @@ namespace op
     template<typename T>
     Array<T>::Array(Array<T>&& array) :
         mSize{array.mSize},
-        mVolume{array.mVolume}
+        mVolume{array.mVolume},
+        mCapacity{array.mCapacity}
     {
         try
         {
@@ -248,6 +251,7 @@ namespace op
             mVolume = array.mVolume;
             std::swap(spData, array.spData);
             std::swap(pData, array.pData);
+            std::swap(mCapacity, array.mCapacity);
             std::swap(mCvMatData, array.mCvMatData);
             // Return
             return *this;
@@ -279,6 +283,25 @@ namespace op
         }
     }
 
+    template<typename T>
+    void Array<T>::copyTo(Array<T>& array) const
+    {
+        try
+        {
+            // Self-copy
+            if (&array == this)
+                return;
+            // (Re-)Allocate memory (if required)
+            array.reset(mSize);
+            // Copy data
+            std::copy(pData, pData + mVolume, array.pData);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template<typename T>
     void Array<T>::reset(const int size)
     {
@@ -308,6 +331,19 @@ namespace op
         }
     }
 
+    template<typename T>
+    void Array<T>::emptyKeepingCapacity()
+    {
+        try
+        {
+            resetAuxiliary(std::vector<int>{}, nullptr, true);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template<typename T>
     void Array<T>::reset(const int sizes, const T value)
     {
@@ -658,7 +694,7 @@ namespace op
     }
 
     template<typename T>
-    void Array<T>::resetAuxiliary(const std::vector<int>& sizes, T* const dataPtr)
+    void Array<T>::resetAuxiliary(const std::vector<int>& sizes, T* const dataPtr, const bool keepCapacity)
     {
         try
         {
@@ -670,21 +706,32 @@ namespace op
                 // Prepare shared_ptr
                 if (dataPtr == nullptr)
                 {
-                    #ifdef WITH_AVX
-                        spData = aligned_shared_ptr<T>(mVolume);
-                    #else
-                        spData.reset(new T[mVolume], std::default_delete<T[]>());
-                    #endif
-                    pData = spData.get();
-                    // Sanity check
-                    if (pData == nullptr)
-                        error("Shared pointer could not be allocated for Array data storage.",
-                              __LINE__, __FUNCTION__, __FILE__);
+                    // Re-use current memory if big enough and not shared with any other Array (e.g., same frame
+                    // size than the previous one)
+                    if (spData != nullptr && spData.use_count() == 1 && mVolume <= mCapacity)
+                        pData = spData.get();
+                    else
+                    {
+                        // Pooled and 64-byte aligned memory (see ArrayAllocator). The deleter keeps the
+                        // deallocation function of the allocator that created the block
+                        const auto bytes = mVolume * sizeof(T);
+                        const auto deallocateFunction = ArrayAllocator::getDeallocateFunction();
+                        spData.reset(
+                            static_cast<T*>(ArrayAllocator::getAllocateFunction()(bytes)),
+                            [deallocateFunction, bytes](T* const ptr) { deallocateFunction(ptr, bytes); });
+                        pData = spData.get();
+                        mCapacity = mVolume;
+                        // Sanity check
+                        if (pData == nullptr)
+                            error("Shared pointer could not be allocated for Array data storage.",
+                                  __LINE__, __FUNCTION__, __FILE__);
+                    }
                 }
                 else
                 {
                     spData.reset();
                     pData = dataPtr;
+                    mCapacity = 0ul;
                 }
                 setCvMatFromPtr(mCvMatData, pData, mSize); // spData.get()
             }
@@ -692,7 +739,12 @@ namespace op
             {
                 mSize = {};
                 mVolume = 0ul;
-                spData.reset();
+                // Keep memory (only if requested and not shared) so it can be re-used by the next reset()
+                if (!keepCapacity || spData.use_count() != 1)
+                {
+                    spData.reset();
+                    mCapacity = 0ul;
+                }
                 pData = nullptr;
                 // Matrix available but empty
                 mCvMatData = std::make_pair(true, Matrix());
@@ -0,0 +1,223 @@
+#include <openpose/core/arrayAllocator.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint> // uintptr_t
+#include <cstdlib> // std::malloc, std::free
+#include <vector>
+#include <openpose/utilities/errorAndLog.hpp>
+
+namespace op
+{
+    namespace ArrayAllocator
+    {
+        // Size classes: Powers of two from 64 B (2^6) to 16 MB (2^24)
+        const auto MIN_SIZE_CLASS_LOG2 = 6u;
+        const auto MAX_SIZE_CLASS_LOG2 = 24u;
+        const auto NUMBER_SIZE_CLASSES = MAX_SIZE_CLASS_LOG2 - MIN_SIZE_CLASS_LOG2 + 1u;
+        // Idle blocks kept by each thread
+        const auto MAX_BLOCKS_PER_SIZE_CLASS = 16u;
+        const auto MAX_BYTES_PER_THREAD_POOL = 64ull << 20;
+
+        // ArrayAllocator - Private variables
+        std::atomic<AllocateFunction> sAllocateFunction     {nullptr};
+        std::atomic<DeallocateFunction> sDeallocateFunction {nullptr};
+        std::atomic<bool> sPoolEnabled                      {true};
+        std::atomic<unsigned long long> sHits               {0ull};
+        std::atomic<unsigned long long> sMisses             {0ull};
+        std::atomic<unsigned long long> sUsedBytes          {0ull};
+        std::atomic<unsigned long long> sPeakBytes          {0ull};
+        std::atomic<unsigned long long> sPooledBytes        {0ull};
+
+        void* alignedMalloc(const std::size_t bytes)
+        {
+            // The original malloc pointer is stored right before the aligned block
+            void* const basePtr = std::malloc(bytes + Alignment - 1u + sizeof(void*));
+            if (basePtr == nullptr)
+                error("Memory block of " + std::to_string(bytes) + " bytes could not be allocated for Array data"
+                      " storage.", __LINE__, __FUNCTION__, __FILE__);
+            const auto alignedAddress = ((uintptr_t)basePtr + sizeof(void*) + Alignment - 1u)
+                                      & ~(uintptr_t)(Alignment - 1u);
+            void** const alignedPtr = (void**)alignedAddress;
+            alignedPtr[-1] = basePtr;
+            return alignedPtr;
+        }
+
+        void alignedFree(void* const ptr)
+        {
+            std::free(((void**)ptr)[-1]);
+        }
+
+        // Returns NUMBER_SIZE_CLASSES if too big for any size class
+        unsigned int getSizeClass(const std::size_t bytes)
+        {
+            auto sizeClass = 0u;
+            while (sizeClass < NUMBER_SIZE_CLASSES && ((std::size_t)1 << (sizeClass + MIN_SIZE_CLASS_LOG2)) < bytes)
+                sizeClass++;
+            return sizeClass;
+        }
+
+        std::size_t getBlockBytes(const unsigned int sizeClass, const std::size_t bytes)
+        {
+            return (sizeClass < NUMBER_SIZE_CLASSES ? (std::size_t)1 << (sizeClass + MIN_SIZE_CLASS_LOG2) : bytes);
+        }
+
+        struct ThreadPool
+        {
+            std::array<std::vector<void*>, NUMBER_SIZE_CLASSES> freeBlocks;
+            unsigned long long pooledBytes;
+
+            ThreadPool();
+
+            ~ThreadPool();
+        };
+
+        // Trivially destructible, so it is still valid while (and after) the ThreadPool is destroyed, e.g., if a
+        // static Array is released after the thread_local variables of its thread
+        thread_local bool sThreadPoolDestroyed = false;
+
+        ThreadPool::ThreadPool() :
+            pooledBytes{0ull}
+        {
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            try
+            {
+                sThreadPoolDestroyed = true;
+                for (auto sizeClass = 0u ; sizeClass < NUMBER_SIZE_CLASSES ; sizeClass++)
+                    for (auto* blockPtr : freeBlocks[sizeClass])
+                        alignedFree(blockPtr);
+                sPooledBytes -= pooledBytes;
+            }
+            catch (const std::exception& e)
+            {
+                errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        ThreadPool* getThreadPool()
+        {
+            if (!sPoolEnabled || sThreadPoolDestroyed)
+                return nullptr;
+            thread_local ThreadPool sThreadPool;
+            return &sThreadPool;
+        }
+
+        void* allocate(const std::size_t bytes)
+        {
+            try
+            {
+                const auto sizeClass = getSizeClass(bytes);
+                const auto blockBytes = getBlockBytes(sizeClass, bytes);
+                void* blockPtr = nullptr;
+                // Re-use an idle block of this thread
+                if (sizeClass < NUMBER_SIZE_CLASSES)
+                {
+                    auto* const threadPool = getThreadPool();
+                    if (threadPool != nullptr && !threadPool->freeBlocks[sizeClass].empty())
+                    {
+                        blockPtr = threadPool->freeBlocks[sizeClass].back();
+                        threadPool->freeBlocks[sizeClass].pop_back();
+                        threadPool->pooledBytes -= blockBytes;
+                        sPooledBytes -= blockBytes;
+                        sHits.fetch_add(1ull, std::memory_order_relaxed);
+                    }
+                }
+                // New block
+                if (blockPtr == nullptr)
+                {
+                    blockPtr = alignedMalloc(blockBytes);
+                    sMisses.fetch_add(1ull, std::memory_order_relaxed);
+                }
+                // Statistics
+                const auto usedBytes = (sUsedBytes += blockBytes);
+                auto peakBytes = sPeakBytes.load();
+                while (usedBytes > peakBytes && !sPeakBytes.compare_exchange_weak(peakBytes, usedBytes))
+                    ;
+                return blockPtr;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return nullptr;
+            }
+        }
+
+        void deallocate(void* const ptr, const std::size_t bytes)
+        {
+            try
+            {
+                if (ptr == nullptr)
+                    return;
+                const auto sizeClass = getSizeClass(bytes);
+                const auto blockBytes = getBlockBytes(sizeClass, bytes);
+                sUsedBytes -= blockBytes;
+                // Keep it for this thread (if room left)
+                if (sizeClass < NUMBER_SIZE_CLASSES)
+                {
+                    auto* const threadPool = getThreadPool();
+                    if (threadPool != nullptr
+                        && threadPool->freeBlocks[sizeClass].size() < MAX_BLOCKS_PER_SIZE_CLASS
+                        && threadPool->pooledBytes + blockBytes <= MAX_BYTES_PER_THREAD_POOL)
+                    {
+                        threadPool->freeBlocks[sizeClass].emplace_back(ptr);
+                        threadPool->pooledBytes += blockBytes;
+                        sPooledBytes += blockBytes;
+                        return;
+                    }
+                }
+                alignedFree(ptr);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        void setAllocator(const AllocateFunction allocateFunction, const DeallocateFunction deallocateFunction)
+        {
+            try
+            {
+                if ((allocateFunction == nullptr) != (deallocateFunction == nullptr))
+                    error("Both allocateFunction and deallocateFunction must be either nullptr or not nullptr.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                sAllocateFunction = allocateFunction;
+                sDeallocateFunction = deallocateFunction;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        AllocateFunction getAllocateFunction()
+        {
+            const auto allocateFunction = sAllocateFunction.load();
+            return (allocateFunction != nullptr ? allocateFunction : &allocate);
+        }
+
+        DeallocateFunction getDeallocateFunction()
+        {
+            const auto deallocateFunction = sDeallocateFunction.load();
+            return (deallocateFunction != nullptr ? deallocateFunction : &deallocate);
+        }
+
+        void setPoolEnabled(const bool poolEnabled)
+        {
+            sPoolEnabled = poolEnabled;
+        }
+
+        ArrayAllocatorStatistics getStatistics()
+        {
+            return ArrayAllocatorStatistics{sHits, sMisses, sUsedBytes, sPeakBytes, sPooledBytes};
+        }
+
+        void resetStatistics()
+        {
+            sHits = 0ull;
+            sMisses = 0ull;
+            sPeakBytes = sUsedBytes.load();
+        }
+    }
+}
@@ -63,6 +63,59 @@ namespace op
     std::vector<Array<float>> CvMatToOpInput::createArray(
         const Matrix& inputData, const std::vector<double>& scaleInputToNetInputs,
         const std::vector<Point<int>>& netInputSizes)
+    {
+        try
+        {
+            std::vector<Array<float>> inputNetData;
+            createArray(inputNetData, inputData, scaleInputToNetInputs, netInputSizes);
+            return inputNetData;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    void CvMatToOpInput::fillArray(
+        std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+        const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes)
+    {
+        try
+        {
+            // Sanity checks
+            if (inputData.empty())
+                error("Wrong input element (empty inputData).", __LINE__, __FUNCTION__, __FILE__);
+            if (inputData.channels() != 3)
+                error("Input images must be 3-channel BGR.", __LINE__, __FUNCTION__, __FILE__);
+            if (scaleInputToNetInputs.size() != netInputSizes.size() || inputNetData.size() != netInputSizes.size())
+                error("scaleInputToNetInputs.size(), inputNetData.size(), and netInputSizes.size() must match.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
+            for (auto i = 0u ; i < inputNetData.size() ; i++)
+            {
+                // Sanity check
+                if (inputNetData[i].getVolume() != 3u * netInputSizes[i].x * netInputSizes[i].y)
+                    error("inputNetData[" + std::to_string(i) + "] does not match the net input size.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Re-using the same temporary cv::Mat (no new memory allocation if same net input size)
+                cv::Mat& frameWithNetSize = OP_OP2CVMAT(mFrameWithNetSize);
+                resizeFixedAspectRatio(frameWithNetSize, cvInputData, scaleInputToNetInputs[i], netInputSizes[i]);
+                // Fill inputNetData[i] in-place
+                uCharCvMatToFloatPtr(
+                    inputNetData[i].getPtr(), OP_CV2OPMAT(frameWithNetSize),
+                    (mPoseModel == PoseModel::BODY_19N ? 2 : 1));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void CvMatToOpInput::createArray(
+        std::vector<Array<float>>& inputNetData, const Matrix& inputData,
+        const std::vector<double>& scaleInputToNetInputs, const std::vector<Point<int>>& netInputSizes)
     {
         try
         {
@@ -75,14 +128,15 @@ namespace op
                 error("scaleInputToNetInputs.size() != netInputSizes.size().", __LINE__, __FUNCTION__, __FILE__);
             // inputNetData - Reescale keeping aspect ratio and transform to float the input deep net image
             const auto numberScales = (int)scaleInputToNetInputs.size();
-            std::vector<Array<float>> inputNetData(numberScales);
+            inputNetData.resize(numberScales);
             cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
             for (auto i = 0u ; i < inputNetData.size() ; i++)
             {
                 // CPU version (faster if #Gpus <= 3 and relatively small images)
                 if (!mGpuResize)
                 {
-                    cv::Mat frameWithNetSize;
+                    // Re-using the same temporary cv::Mat (no new memory allocation if same net input size)
+                    cv::Mat& frameWithNetSize = OP_OP2CVMAT(mFrameWithNetSize);
                     resizeFixedAspectRatio(frameWithNetSize, cvInputData, scaleInputToNetInputs[i], netInputSizes[i]);
                     // Fill inputNetData[i]
                     inputNetData[i].reset({1, 3, netInputSizes.at(i).y, netInputSizes.at(i).x});
@@ -149,12 +203,10 @@ namespace op
                     #endif
                 }
             }
-            return inputNetData;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return {};
         }
     }
 }
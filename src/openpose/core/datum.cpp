@@ -7,6 +7,7 @@ namespace op
         id{std::numeric_limits<unsigned long long>::max()},
         subId{0},
         subIdMax{0},
+        captureNanoseconds{0ull},
         poseIds{-1}
     {
     }
@@ -19,6 +20,7 @@ namespace op
         subIdMax{datum.subIdMax},
         name{datum.name},
         frameNumber{datum.frameNumber},
+        captureNanoseconds{datum.captureNanoseconds},
         // Input image and rendered version
         cvInputData{datum.cvInputData},
         inputNetData{datum.inputNetData},
@@ -86,6 +88,7 @@ namespace op
             subIdMax = datum.subIdMax;
             name = datum.name;
             frameNumber = datum.frameNumber;
+            captureNanoseconds = datum.captureNanoseconds;
             // Input image and rendered version
             cvInputData = datum.cvInputData;
             inputNetData = datum.inputNetData;
@@ -154,6 +157,7 @@ namespace op
         subId{datum.subId},
         subIdMax{datum.subIdMax},
         frameNumber{datum.frameNumber},
+        captureNanoseconds{datum.captureNanoseconds},
         // Other parameters
         scaleInputToOutput{datum.scaleInputToOutput},
         scaleNetToOutput{datum.scaleNetToOutput}
@@ -229,6 +233,7 @@ namespace op
             subIdMax = datum.subIdMax;
             std::swap(name, datum.name);
             frameNumber = datum.frameNumber;
+            captureNanoseconds = datum.captureNanoseconds;
             // Input image and rendered version
             std::swap(cvInputData, datum.cvInputData);
             std::swap(inputNetData, datum.inputNetData);
@@ -304,6 +309,7 @@ namespace op
             datum.subIdMax = subIdMax;
             datum.name = name;
             datum.frameNumber = frameNumber;
+            datum.captureNanoseconds = captureNanoseconds;
             // Input image and rendered version
             datum.cvInputData = cvInputData.clone();
             datum.inputNetData.resize(inputNetData.size());
@@ -8,5 +8,6 @@ namespace op
     DEFINE_TEMPLATE_DATUM(WKeypointScaler);
     DEFINE_TEMPLATE_DATUM(WOpOutputToCvMat);
     DEFINE_TEMPLATE_DATUM(WScaleAndSizeExtractor);
+    DEFINE_TEMPLATE_DATUM(WScaleAndSizeUpdater);
     DEFINE_TEMPLATE_DATUM(WVerbosePrinter);
 }
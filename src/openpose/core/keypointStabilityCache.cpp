@@ -0,0 +1,216 @@
+#include <openpose/core/keypointStabilityCache.hpp>
+#include <algorithm> // std::fill
+#include <cmath> // std::abs
+#include <limits> // std::numeric_limits
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    // Side of the (squared) appearance thumbnail
+    const auto THUMBNAIL_SIDE = 16;
+
+    struct KeypointStabilityCache::ImplKeypointStabilityCache
+    {
+        struct CachedPerson
+        {
+            // Rectangle and thumbnail of the last network run
+            Rectangle<float> rectangle;
+            std::vector<float> thumbnail;
+            // Keypoints relative to rectangle (i.e., in [0,1] inside the rectangle), and score
+            std::vector<float> normalizedKeypoints;
+            int reusedFrames;
+        };
+
+        const int mMaximumReusedFrames;
+        const float mMaximumMotion;
+        const float mMaximumAppearanceChange;
+        std::vector<CachedPerson> mPreviousPeople;
+        std::vector<bool> mPreviousPeopleMatched;
+        std::vector<CachedPerson> mCurrentPeople;
+        std::vector<float> mThumbnail;
+
+        ImplKeypointStabilityCache(
+            const int maximumReusedFrames, const float maximumMotion, const float maximumAppearanceChange) :
+            mMaximumReusedFrames{maximumReusedFrames},
+            mMaximumMotion{maximumMotion},
+            mMaximumAppearanceChange{maximumAppearanceChange}
+        {
+        }
+    };
+
+    void getCropThumbnail(std::vector<float>& thumbnail, const Array<float>& netInputCrop)
+    {
+        try
+        {
+            // Block average of all channels, at THUMBNAIL_SIDE x THUMBNAIL_SIDE resolution
+            if (netInputCrop.getNumberDimensions() != 4)
+                error("The network input crop must have 4 dimensions (1 x channels x height x width).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            const auto channels = netInputCrop.getSize(1);
+            const auto height = netInputCrop.getSize(2);
+            const auto width = netInputCrop.getSize(3);
+            thumbnail.assign(THUMBNAIL_SIDE*THUMBNAIL_SIDE, 0.f);
+            std::vector<int> counts(THUMBNAIL_SIDE*THUMBNAIL_SIDE, 0);
+            for (auto channel = 0 ; channel < channels ; channel++)
+            {
+                for (auto y = 0 ; y < height ; y++)
+                {
+                    const auto* const rowPtr = netInputCrop.getConstPtr() + (channel*height + y)*width;
+                    auto* const thumbnailRowPtr = &thumbnail[(y*THUMBNAIL_SIDE/height)*THUMBNAIL_SIDE];
+                    auto* const countsRowPtr = &counts[(y*THUMBNAIL_SIDE/height)*THUMBNAIL_SIDE];
+                    for (auto x = 0 ; x < width ; x++)
+                    {
+                        const auto xThumbnail = x*THUMBNAIL_SIDE/width;
+                        thumbnailRowPtr[xThumbnail] += rowPtr[x];
+                        countsRowPtr[xThumbnail]++;
+                    }
+                }
+            }
+            for (auto i = 0u ; i < thumbnail.size() ; i++)
+                if (counts[i] > 0)
+                    thumbnail[i] /= counts[i];
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    KeypointStabilityCache::KeypointStabilityCache(
+        const int maximumReusedFrames, const float maximumMotion, const float maximumAppearanceChange) :
+        upImpl{new ImplKeypointStabilityCache{maximumReusedFrames, maximumMotion, maximumAppearanceChange}}
+    {
+        try
+        {
+            if (maximumReusedFrames < 1)
+                error("The maximum number of re-used frames must be positive.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    KeypointStabilityCache::~KeypointStabilityCache()
+    {
+    }
+
+    void KeypointStabilityCache::newFrame()
+    {
+        try
+        {
+            std::swap(upImpl->mPreviousPeople, upImpl->mCurrentPeople);
+            upImpl->mCurrentPeople.clear();
+            upImpl->mPreviousPeopleMatched.assign(upImpl->mPreviousPeople.size(), false);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    bool KeypointStabilityCache::reuse(
+        float* keypointsPtr, const int numberKeypoints, const Rectangle<float>& rectangle,
+        const Array<float>& netInputCrop)
+    {
+        try
+        {
+            if (rectangle.area() <= 0)
+                return false;
+            // Closest previous person (that no other current person already matched)
+            const auto center = rectangle.center();
+            const auto size = fastMax(rectangle.width, rectangle.height);
+            auto closestPerson = -1;
+            auto closestDistanceSquared = std::numeric_limits<float>::max();
+            for (auto person = 0u ; person < upImpl->mPreviousPeople.size() ; person++)
+            {
+                if (!upImpl->mPreviousPeopleMatched[person])
+                {
+                    const auto previousCenter = upImpl->mPreviousPeople[person].rectangle.center();
+                    const auto distanceX = center.x - previousCenter.x;
+                    const auto distanceY = center.y - previousCenter.y;
+                    const auto distanceSquared = distanceX*distanceX + distanceY*distanceY;
+                    if (closestDistanceSquared > distanceSquared)
+                    {
+                        closestDistanceSquared = distanceSquared;
+                        closestPerson = (int)person;
+                    }
+                }
+            }
+            if (closestPerson < 0)
+                return false;
+            upImpl->mPreviousPeopleMatched[closestPerson] = true;
+            const auto& cachedPerson = upImpl->mPreviousPeople[closestPerson];
+            // Refresh budget exhausted or different number of keypoints
+            if (cachedPerson.reusedFrames >= upImpl->mMaximumReusedFrames
+                || (int)cachedPerson.normalizedKeypoints.size() != 3*numberKeypoints)
+                return false;
+            // Rectangle motion (w.r.t. the last network run)
+            const auto maximumMotion = upImpl->mMaximumMotion * size;
+            const auto cachedSize = fastMax(cachedPerson.rectangle.width, cachedPerson.rectangle.height);
+            if (closestDistanceSquared > maximumMotion*maximumMotion || std::abs(size - cachedSize) > maximumMotion)
+                return false;
+            // Appearance change (both crops are aligned with their rectangle, so motion is already compensated)
+            getCropThumbnail(upImpl->mThumbnail, netInputCrop);
+            if (upImpl->mThumbnail.size() != cachedPerson.thumbnail.size())
+                return false;
+            auto appearanceChange = 0.f;
+            for (auto i = 0u ; i < upImpl->mThumbnail.size() ; i++)
+                appearanceChange += std::abs(upImpl->mThumbnail[i] - cachedPerson.thumbnail[i]);
+            appearanceChange /= (float)upImpl->mThumbnail.size();
+            if (appearanceChange > upImpl->mMaximumAppearanceChange)
+                return false;
+            // Re-use cached keypoints, motion-compensated to the current rectangle
+            for (auto part = 0 ; part < numberKeypoints ; part++)
+            {
+                const auto* const normalizedKeypointPtr = &cachedPerson.normalizedKeypoints[3*part];
+                auto* const keypointPtr = keypointsPtr + 3*part;
+                if (normalizedKeypointPtr[2] > 0.f)
+                {
+                    keypointPtr[0] = rectangle.x + normalizedKeypointPtr[0] * rectangle.width;
+                    keypointPtr[1] = rectangle.y + normalizedKeypointPtr[1] * rectangle.height;
+                    keypointPtr[2] = normalizedKeypointPtr[2];
+                }
+                else
+                    std::fill(keypointPtr, keypointPtr + 3, 0.f);
+            }
+            upImpl->mCurrentPeople.emplace_back(cachedPerson);
+            upImpl->mCurrentPeople.back().reusedFrames++;
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void KeypointStabilityCache::update(
+        const float* const keypointsPtr, const int numberKeypoints, const Rectangle<float>& rectangle,
+        const Array<float>& netInputCrop)
+    {
+        try
+        {
+            if (rectangle.area() <= 0)
+                return;
+            ImplKeypointStabilityCache::CachedPerson cachedPerson;
+            cachedPerson.rectangle = rectangle;
+            getCropThumbnail(cachedPerson.thumbnail, netInputCrop);
+            cachedPerson.normalizedKeypoints.resize(3*numberKeypoints);
+            for (auto part = 0 ; part < numberKeypoints ; part++)
+            {
+                const auto* const keypointPtr = keypointsPtr + 3*part;
+                auto* const normalizedKeypointPtr = &cachedPerson.normalizedKeypoints[3*part];
+                normalizedKeypointPtr[0] = (keypointPtr[0] - rectangle.x) / rectangle.width;
+                normalizedKeypointPtr[1] = (keypointPtr[1] - rectangle.y) / rectangle.height;
+                normalizedKeypointPtr[2] = keypointPtr[2];
+            }
+            cachedPerson.reusedFrames = 0;
+            upImpl->mCurrentPeople.emplace_back(std::move(cachedPerson));
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
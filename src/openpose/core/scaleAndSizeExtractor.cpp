@@ -1,17 +1,65 @@
 #include <openpose/core/scaleAndSizeExtractor.hpp>
+#include <algorithm> // std::lower_bound, std::sort
+#include <limits> // std::numeric_limits
 #include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/keypoint.hpp> // getKeypointsRectangle
 #include <openpose/utilities/openCv.hpp> // resizeGetScaleFactor
 
 namespace op
 {
+    // Adaptive resolution - Net input size levels (as ratio of the net input resolution). Only a few of them, so the
+    // network is only reshaped a few times (and never re-allocated after the first and biggest one)
+    const std::array<double, 3> ADAPTIVE_SCALES{{1., 0.75, 0.5}};
+    // Adaptive resolution - Hysteresis: frames that a lower level must be consistently desired before switching to
+    // it (switching to higher resolutions is immediate), and extra height margin required to switch to it
+    const auto ADAPTIVE_FRAMES_TO_DOWNSCALE = 10;
+    const auto ADAPTIVE_HEIGHT_MARGIN = 1.2f;
+    const auto ADAPTIVE_KEYPOINT_THRESHOLD = 0.1f;
+
+    std::vector<int> sortBuckets(const std::vector<int>& netInputSizeBuckets)
+    {
+        try
+        {
+            auto sortedBuckets = netInputSizeBuckets;
+            std::sort(sortedBuckets.begin(), sortedBuckets.end());
+            return sortedBuckets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    Point<int> getScaledNetInputSize(const Point<int>& poseNetInputSize, const double currentScale)
+    {
+        try
+        {
+            return Point<int>{
+                fastTruncate(positiveIntRound(poseNetInputSize.x * currentScale) / 16 * 16, 1, poseNetInputSize.x),
+                fastTruncate(positiveIntRound(poseNetInputSize.y * currentScale) / 16 * 16, 1, poseNetInputSize.y)};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Point<int>{};
+        }
+    }
+
     ScaleAndSizeExtractor::ScaleAndSizeExtractor(const Point<int>& netInputResolution,
         const float netInputResolutionDynamicBehavior, const Point<int>& outputResolution, const int scaleNumber,
-        const double scaleGap) :
+        const double scaleGap, const float adaptiveMinPersonHeight, const std::vector<int>& netInputSizeBuckets) :
         mNetInputResolution{netInputResolution},
         mNetInputResolutionDynamicBehavior{netInputResolutionDynamicBehavior},
         mOutputSize{outputResolution},
         mScaleNumber{scaleNumber},
-        mScaleGap{scaleGap}
+        mScaleGap{scaleGap},
+        mAdaptiveMinPersonHeight{adaptiveMinPersonHeight},
+        mNetInputSizeBuckets{sortBuckets(netInputSizeBuckets)},
+        mAdaptiveLevel{0},
+        mAdaptiveCandidateLevel{0},
+        mAdaptiveCandidateCounter{0},
+        mAdaptiveLastNumberPeople{0}
     {
         try
         {
@@ -23,6 +71,10 @@ namespace op
                 error("There must be at least 1 scale.", __LINE__, __FUNCTION__, __FILE__);
             if (scaleGap <= 0.)
                 error("The gap between scales must be strictly positive.", __LINE__, __FUNCTION__, __FILE__);
+            for (const auto bucket : mNetInputSizeBuckets)
+                if (bucket <= 0 || bucket % 16 != 0)
+                    error("Net input size buckets must be positive multiples of 16.",
+                          __LINE__, __FUNCTION__, __FILE__);
         }
         catch (const std::exception& e)
         {
@@ -43,31 +95,18 @@ namespace op
             if (inputResolution.area() <= 0)
                 error("Wrong input element (empty cvInputData).", __LINE__, __FUNCTION__, __FILE__);
             // Set poseNetInputSize
-            auto poseNetInputSize = mNetInputResolution;
-            if (poseNetInputSize.x <= 0 || poseNetInputSize.y <= 0)
+            auto poseNetInputSize = getPoseNetInputSize(inputResolution);
+            // Adaptive resolution - Reduce it if people are big enough
+            if (mAdaptiveMinPersonHeight > 0.f)
             {
-                // Sanity check
-                if (poseNetInputSize.x <= 0 && poseNetInputSize.y <= 0)
-                    error("Only 1 of the dimensions of net input resolution can be <= 0.",
-                          __LINE__, __FUNCTION__, __FILE__);
-                // mNetInputResolutionDynamicBehavior limiting maximum
-                if (mNetInputResolutionDynamicBehavior > 0)
-                {
-                    if (poseNetInputSize.x <= 0)
-                        poseNetInputSize.x = 16 * positiveIntRound(1 / 16.f *
-                            fastMin(poseNetInputSize.y * mNetInputResolutionDynamicBehavior * 16.f / 9.f, poseNetInputSize.y * inputResolution.x / (float)inputResolution.y));
-                    else // if (poseNetInputSize.y <= 0)
-                        poseNetInputSize.y = 16 * positiveIntRound(1 / 16.f *
-                            fastMin(poseNetInputSize.x * mNetInputResolutionDynamicBehavior * 9.f / 16.f, poseNetInputSize.x * inputResolution.y / (float)inputResolution.x));
-                }
-                else // No mNetInputResolutionDynamicBehavior behavior
-                {
-                    if (poseNetInputSize.x <= 0)
-                        poseNetInputSize.x = 16 * positiveIntRound(1 / 16.f * poseNetInputSize.y * inputResolution.x / (float)inputResolution.y);
-                    else // if (poseNetInputSize.y <= 0)
-                        poseNetInputSize.y = 16 * positiveIntRound(1 / 16.f * poseNetInputSize.x * inputResolution.y / (float)inputResolution.x);
-                }
+                const auto adaptiveScale = ADAPTIVE_SCALES[mAdaptiveLevel.load()];
+                poseNetInputSize = Point<int>{
+                    16 * fastMax(1, positiveIntRound(poseNetInputSize.x * adaptiveScale / 16.)),
+                    16 * fastMax(1, positiveIntRound(poseNetInputSize.y * adaptiveScale / 16.))};
             }
+            // Shape bucketing - Free dimension rounded up to the closest bucket (the image is not stretched, the
+            // extra area is padded)
+            const auto bucketedNetInputSize = getBucketedNetInputSize(poseNetInputSize);
             // scaleInputToNetInputs & netInputSizes - Reescale keeping aspect ratio
             std::vector<double> scaleInputToNetInputs(mScaleNumber, 1.f);
             std::vector<Point<int>> netInputSizes(mScaleNumber);
@@ -78,13 +117,10 @@ namespace op
                     error("All scales must be in the range [0, 1], i.e., 0 <= 1-scale_number*scale_gap <= 1",
                           __LINE__, __FUNCTION__, __FILE__);
 
-                const auto targetWidth = fastTruncate(
-                    positiveIntRound(poseNetInputSize.x * currentScale) / 16 * 16, 1, poseNetInputSize.x);
-                const auto targetHeight = fastTruncate(
-                    positiveIntRound(poseNetInputSize.y * currentScale) / 16 * 16, 1, poseNetInputSize.y);
-                const Point<int> targetSize{targetWidth, targetHeight};
+                const auto targetSize = getScaledNetInputSize(poseNetInputSize, currentScale);
                 scaleInputToNetInputs[i] = resizeGetScaleFactor(inputResolution, targetSize);
-                netInputSizes[i] = targetSize;
+                netInputSizes[i] = (bucketedNetInputSize == poseNetInputSize
+                    ? targetSize : getScaledNetInputSize(bucketedNetInputSize, currentScale));
             }
             // scaleInputToOutput - Scale between input and desired output size
             Point<int> outputResolution;
@@ -110,4 +146,138 @@ namespace op
             return std::make_tuple(std::vector<double>{}, std::vector<Point<int>>{}, 1., Point<int>{});
         }
     }
+
+    void ScaleAndSizeExtractor::update(const Array<float>& poseKeypoints, const Point<int>& inputResolution)
+    {
+        try
+        {
+            if (mAdaptiveMinPersonHeight > 0.f && inputResolution.area() > 0)
+            {
+                const auto currentLevel = mAdaptiveLevel.load();
+                const auto numberPeople = (poseKeypoints.empty() ? 0 : poseKeypoints.getSize(0));
+                // Desired level - Full resolution if no people or if some person was lost (it might have been too
+                // small for the current resolution)
+                auto desiredLevel = 0;
+                if (numberPeople > 0 && numberPeople >= mAdaptiveLastNumberPeople)
+                {
+                    // Height of the smallest person (input resolution pixels)
+                    auto minHeight = std::numeric_limits<float>::max();
+                    for (auto person = 0 ; person < numberPeople ; person++)
+                    {
+                        const auto personRectangle = getKeypointsRectangle(
+                            poseKeypoints, person, ADAPTIVE_KEYPOINT_THRESHOLD);
+                        if (personRectangle.area() > 0)
+                            minHeight = fastMin(minHeight, personRectangle.height);
+                    }
+                    if (minHeight < std::numeric_limits<float>::max())
+                    {
+                        // Height of the smallest person in the full resolution net input
+                        const auto minNetHeight = minHeight * (float)resizeGetScaleFactor(
+                            inputResolution, getPoseNetInputSize(inputResolution));
+                        // Lowest level keeping that person big enough
+                        for (auto level = (int)ADAPTIVE_SCALES.size()-1 ; level > 0 ; level--)
+                        {
+                            const auto margin = (level > currentLevel ? ADAPTIVE_HEIGHT_MARGIN : 1.f);
+                            if (minNetHeight * ADAPTIVE_SCALES[level] >= margin * mAdaptiveMinPersonHeight)
+                            {
+                                desiredLevel = level;
+                                break;
+                            }
+                        }
+                    }
+                }
+                mAdaptiveLastNumberPeople = numberPeople;
+                // Hysteresis - Higher resolution: immediately
+                auto newLevel = currentLevel;
+                if (desiredLevel <= currentLevel)
+                {
+                    newLevel = desiredLevel;
+                    mAdaptiveCandidateCounter = 0;
+                }
+                // Hysteresis - Lower resolution: only after being consistently desired for some frames
+                else
+                {
+                    mAdaptiveCandidateLevel = (mAdaptiveCandidateCounter == 0
+                        ? desiredLevel : fastMin(mAdaptiveCandidateLevel, desiredLevel));
+                    if (++mAdaptiveCandidateCounter >= ADAPTIVE_FRAMES_TO_DOWNSCALE)
+                    {
+                        newLevel = mAdaptiveCandidateLevel;
+                        mAdaptiveCandidateCounter = 0;
+                    }
+                }
+                if (newLevel != currentLevel)
+                {
+                    mAdaptiveLevel.store(newLevel);
+                    opLog("Adaptive net resolution: "
+                          + std::to_string(positiveIntRound(100*ADAPTIVE_SCALES[newLevel]))
+                          + "% of `net_resolution`.", Priority::Low);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Point<int> ScaleAndSizeExtractor::getPoseNetInputSize(const Point<int>& inputResolution) const
+    {
+        try
+        {
+            auto poseNetInputSize = mNetInputResolution;
+            if (poseNetInputSize.x <= 0 || poseNetInputSize.y <= 0)
+            {
+                // Sanity check
+                if (poseNetInputSize.x <= 0 && poseNetInputSize.y <= 0)
+                    error("Only 1 of the dimensions of net input resolution can be <= 0.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // mNetInputResolutionDynamicBehavior limiting maximum
+                if (mNetInputResolutionDynamicBehavior > 0)
+                {
+                    if (poseNetInputSize.x <= 0)
+                        poseNetInputSize.x = 16 * positiveIntRound(1 / 16.f *
+                            fastMin(poseNetInputSize.y * mNetInputResolutionDynamicBehavior * 16.f / 9.f, poseNetInputSize.y * inputResolution.x / (float)inputResolution.y));
+                    else // if (poseNetInputSize.y <= 0)
+                        poseNetInputSize.y = 16 * positiveIntRound(1 / 16.f *
+                            fastMin(poseNetInputSize.x * mNetInputResolutionDynamicBehavior * 9.f / 16.f, poseNetInputSize.x * inputResolution.y / (float)inputResolution.x));
+                }
+                else // No mNetInputResolutionDynamicBehavior behavior
+                {
+                    if (poseNetInputSize.x <= 0)
+                        poseNetInputSize.x = 16 * positiveIntRound(1 / 16.f * poseNetInputSize.y * inputResolution.x / (float)inputResolution.y);
+                    else // if (poseNetInputSize.y <= 0)
+                        poseNetInputSize.y = 16 * positiveIntRound(1 / 16.f * poseNetInputSize.x * inputResolution.y / (float)inputResolution.x);
+                }
+            }
+            return poseNetInputSize;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Point<int>{};
+        }
+    }
+
+    Point<int> ScaleAndSizeExtractor::getBucketedNetInputSize(const Point<int>& poseNetInputSize) const
+    {
+        try
+        {
+            auto bucketedNetInputSize = poseNetInputSize;
+            // Only the free dimension (if any) is bucketed
+            if (!mNetInputSizeBuckets.empty() && (mNetInputResolution.x <= 0 || mNetInputResolution.y <= 0))
+            {
+                auto& freeDimension = (mNetInputResolution.x <= 0 ? bucketedNetInputSize.x : bucketedNetInputSize.y);
+                const auto bucketIterator = std::lower_bound(
+                    mNetInputSizeBuckets.begin(), mNetInputSizeBuckets.end(), freeDimension);
+                if (bucketIterator != mNetInputSizeBuckets.end())
+                    freeDimension = *bucketIterator;
+            }
+            return bucketedNetInputSize;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Point<int>{};
+        }
+    }
 }
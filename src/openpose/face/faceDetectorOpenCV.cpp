@@ -1,23 +1,109 @@
 #include <openpose/face/faceDetectorOpenCV.hpp>
+#include <exception> // std::exception_ptr
+#include <thread>
 #include <opencv2/objdetect/objdetect.hpp> // cv::CascadeClassifier
 #include <openpose/pose/poseParameters.hpp>
+#include <openpose/utilities/fastMath.hpp>
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
 
 namespace op
 {
+    // Maximum number of parallel stripes of the full-frame sweep
+    const auto MAX_NUMBER_STRIPES = 4;
+    // Detected faces in the tracked regions are searched in the pyramid level where they are at least this size
+    const auto MIN_TRACKED_FACE_SIZE = 40;
+
     struct FaceDetectorOpenCV::ImplFaceDetectorOpenCV
     {
-        cv::CascadeClassifier mFaceCascade;
+        // 1 per stripe (cv::CascadeClassifier is not thread-safe)
+        std::vector<cv::CascadeClassifier> mFaceCascades;
+        const int mFullFramePeriod;
+        unsigned long long mFrameCounter;
+        // Grayscale pyramid (its memory is re-used across frames)
+        std::vector<cv::Mat> mPyramid;
+        // Detected faces of the previous frame (full resolution, before enlarging them)
+        std::vector<cv::Rect> mPreviousFaces;
+
+        ImplFaceDetectorOpenCV(const int fullFramePeriod) :
+            mFullFramePeriod{fullFramePeriod},
+            mFrameCounter{0ull}
+        {
+        }
     };
 
-    FaceDetectorOpenCV::FaceDetectorOpenCV(const std::string& modelFolder) :
-        upImpl{new ImplFaceDetectorOpenCV{}}
+    void buildGrayPyramid(std::vector<cv::Mat>& pyramid, int& sweepLevel, const cv::Mat& cvInputData)
+    {
+        try
+        {
+            // Level 0: full resolution. sweepLevel: first level not bigger than 640x360
+            if (pyramid.empty())
+                pyramid.resize(1);
+            cv::cvtColor(cvInputData, pyramid[0], cv::COLOR_BGR2GRAY);
+            sweepLevel = 0;
+            while (pyramid[sweepLevel].cols * pyramid[sweepLevel].rows > 640*360)
+            {
+                if ((int)pyramid.size() <= sweepLevel+1)
+                    pyramid.emplace_back();
+                cv::pyrDown(pyramid[sweepLevel], pyramid[sweepLevel+1]);
+                sweepLevel++;
+            }
+            // 1 extra level for big faces
+            if ((int)pyramid.size() <= sweepLevel+1)
+                pyramid.emplace_back();
+            cv::pyrDown(pyramid[sweepLevel], pyramid[sweepLevel+1]);
+            pyramid.resize(sweepLevel+2);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void addFacesWithoutDuplicates(
+        std::vector<cv::Rect>& faces, const std::vector<cv::Rect>& newFaces, const cv::Point& offset,
+        const int multiplier)
+    {
+        try
+        {
+            for (const auto& newFace : newFaces)
+            {
+                const cv::Rect face{
+                    (newFace.x + offset.x) * multiplier, (newFace.y + offset.y) * multiplier,
+                    newFace.width * multiplier, newFace.height * multiplier};
+                // Same face detected in 2 overlapping stripes or tracked regions
+                auto duplicated = false;
+                for (const auto& previousFace : faces)
+                {
+                    const auto intersectionArea = (face & previousFace).area();
+                    if (2*intersectionArea > fastMin(face.area(), previousFace.area()))
+                    {
+                        duplicated = true;
+                        break;
+                    }
+                }
+                if (!duplicated)
+                    faces.emplace_back(face);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    FaceDetectorOpenCV::FaceDetectorOpenCV(const std::string& modelFolder, const int fullFramePeriod) :
+        upImpl{new ImplFaceDetectorOpenCV{fullFramePeriod}}
     {
         try
         {
             const std::string faceDetectorModelPath{modelFolder + "face/haarcascade_frontalface_alt.xml"};
-            if (!upImpl->mFaceCascade.load(faceDetectorModelPath))
-                error("Face detector model not found at: " + faceDetectorModelPath, __LINE__, __FUNCTION__, __FILE__);
+            const auto numberCascades = (fullFramePeriod > 0
+                ? fastMax(1, fastMin(MAX_NUMBER_STRIPES, (int)std::thread::hardware_concurrency())) : 1);
+            upImpl->mFaceCascades.resize(numberCascades);
+            for (auto& faceCascade : upImpl->mFaceCascades)
+                if (!faceCascade.load(faceDetectorModelPath))
+                    error("Face detector model not found at: " + faceDetectorModelPath,
+                          __LINE__, __FUNCTION__, __FILE__);
         }
         catch (const std::exception& e)
         {
@@ -34,19 +120,110 @@ namespace op
         try
         {
             cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
-            // Image to grey and pyrDown
-            cv::Mat frameGray;
-            cv::cvtColor(cvInputData, frameGray, cv::COLOR_BGR2GRAY);
+            std::vector<cv::Rect> detectedFaces;
             auto multiplier = 1.f;
-            while (frameGray.cols * frameGray.rows > 640*360)
+            // Original mode: Image to grey and pyrDown + full-frame detection
+            if (upImpl->mFullFramePeriod < 1)
             {
-                cv::pyrDown(frameGray, frameGray);
-                multiplier *= 2.f;
+                cv::Mat frameGray;
+                cv::cvtColor(cvInputData, frameGray, cv::COLOR_BGR2GRAY);
+                while (frameGray.cols * frameGray.rows > 640*360)
+                {
+                    cv::pyrDown(frameGray, frameGray);
+                    multiplier *= 2.f;
+                }
+                // Face detection - Example from:
+                // http://docs.opencv.org/2.4/doc/tutorials/objdetect/cascade_classifier/cascade_classifier.html
+                upImpl->mFaceCascades[0].detectMultiScale(frameGray, detectedFaces, 1.2, 3, 0|CV_HAAR_SCALE_IMAGE);
+            }
+            // Accelerated mode: Periodic full-frame sweep + tracked regions in between
+            else
+            {
+                // Grayscale pyramid (computed once per frame, shared by all the detections)
+                int sweepLevel;
+                buildGrayPyramid(upImpl->mPyramid, sweepLevel, cvInputData);
+                // Full-frame sweep
+                if (upImpl->mFrameCounter % upImpl->mFullFramePeriod == 0 || upImpl->mPreviousFaces.empty())
+                {
+                    // Horizontal stripes (in parallel) for small and medium faces (up to stripeOverlap pixels), plus
+                    // the next pyramid level for the bigger ones. Each face fits entirely in at least 1 stripe.
+                    const auto& sweepImage = upImpl->mPyramid[sweepLevel];
+                    const auto& bigFacesImage = upImpl->mPyramid[sweepLevel+1];
+                    const auto numberStripes = (int)upImpl->mFaceCascades.size();
+                    const auto stripeHeight = (sweepImage.rows + numberStripes - 1) / numberStripes;
+                    const auto stripeOverlap = fastMax(stripeHeight/2, 40);
+                    std::vector<std::vector<cv::Rect>> stripeFaces(numberStripes+1);
+                    std::vector<std::exception_ptr> exceptionPtrs(numberStripes);
+                    const auto detectStripe = [&](const int stripe)
+                    {
+                        try
+                        {
+                            const auto yStart = stripe * stripeHeight;
+                            const auto yEnd = fastMin(sweepImage.rows, yStart + stripeHeight + stripeOverlap);
+                            if (yStart < yEnd)
+                                upImpl->mFaceCascades[stripe].detectMultiScale(
+                                    sweepImage(cv::Rect{0, yStart, sweepImage.cols, yEnd - yStart}),
+                                    stripeFaces[stripe], 1.2, 3, 0|CV_HAAR_SCALE_IMAGE, cv::Size{},
+                                    cv::Size{stripeOverlap, stripeOverlap});
+                            // Big faces (last stripe thread, it is the one with the least rows)
+                            if (stripe == numberStripes-1 && bigFacesImage.rows > stripeOverlap/2)
+                                upImpl->mFaceCascades[stripe].detectMultiScale(
+                                    bigFacesImage, stripeFaces[numberStripes], 1.2, 3, 0|CV_HAAR_SCALE_IMAGE,
+                                    cv::Size{stripeOverlap/2, stripeOverlap/2});
+                        }
+                        catch (const std::exception&)
+                        {
+                            exceptionPtrs[stripe] = std::current_exception();
+                        }
+                    };
+                    std::vector<std::thread> threads;
+                    threads.reserve(numberStripes-1);
+                    for (auto stripe = 0 ; stripe < numberStripes-1 ; stripe++)
+                        threads.emplace_back(detectStripe, stripe);
+                    detectStripe(numberStripes-1);
+                    for (auto& thread : threads)
+                        thread.join();
+                    for (const auto& exceptionPtr : exceptionPtrs)
+                        if (exceptionPtr)
+                            std::rethrow_exception(exceptionPtr);
+                    // Merge them (full resolution)
+                    for (auto stripe = 0 ; stripe < numberStripes ; stripe++)
+                        addFacesWithoutDuplicates(
+                            detectedFaces, stripeFaces[stripe], cv::Point{0, stripe * stripeHeight},
+                            1 << sweepLevel);
+                    addFacesWithoutDuplicates(
+                        detectedFaces, stripeFaces[numberStripes], cv::Point{0, 0}, 1 << (sweepLevel+1));
+                }
+                // Tracked regions: Only around the previous faces, and only at their scale
+                else
+                {
+                    for (const auto& previousFace : upImpl->mPreviousFaces)
+                    {
+                        // Smallest pyramid level where the face is still big enough
+                        auto level = 0;
+                        while (level+1 < (int)upImpl->mPyramid.size()
+                               && (previousFace.width >> (level+1)) >= MIN_TRACKED_FACE_SIZE)
+                            level++;
+                        const auto& levelImage = upImpl->mPyramid[level];
+                        // Search region: previous face + motion margin (half the face size on each side)
+                        const auto faceSize = previousFace.width >> level;
+                        const cv::Rect searchRegion = cv::Rect{
+                            (previousFace.x >> level) - faceSize/2, (previousFace.y >> level) - faceSize/2,
+                            2*faceSize, 2*faceSize} & cv::Rect{0, 0, levelImage.cols, levelImage.rows};
+                        if (searchRegion.area() > 0)
+                        {
+                            std::vector<cv::Rect> regionFaces;
+                            upImpl->mFaceCascades[0].detectMultiScale(
+                                levelImage(searchRegion), regionFaces, 1.1, 3, 0|CV_HAAR_SCALE_IMAGE,
+                                cv::Size{positiveIntRound(0.7f*faceSize), positiveIntRound(0.7f*faceSize)},
+                                cv::Size{positiveIntRound(1.5f*faceSize), positiveIntRound(1.5f*faceSize)});
+                            addFacesWithoutDuplicates(detectedFaces, regionFaces, searchRegion.tl(), 1 << level);
+                        }
+                    }
+                }
+                upImpl->mPreviousFaces = detectedFaces;
+                upImpl->mFrameCounter++;
             }
-            // Face detection - Example from:
-            // http://docs.opencv.org/2.4/doc/tutorials/objdetect/cascade_classifier/cascade_classifier.html
-            std::vector<cv::Rect> detectedFaces;
-            upImpl->mFaceCascade.detectMultiScale(frameGray, detectedFaces, 1.2, 3, 0|CV_HAAR_SCALE_IMAGE);
             // Rescale rectangles
             std::vector<Rectangle<float>> faceRectangles(detectedFaces.size());
             for(auto i = 0u; i < detectedFaces.size(); i++)
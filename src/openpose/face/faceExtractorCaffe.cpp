@@ -17,6 +17,7 @@ namespace op
     {
         #ifdef USE_CAFFE
             bool netInitialized;
+            bool resizeHeatMaps;
             const int mGpuId;
             std::shared_ptr<NetCaffe> spNetCaffe;
             std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
@@ -26,11 +27,14 @@ namespace op
             std::shared_ptr<ArrayCpuGpu<float>> spHeatMapsBlob;
             std::shared_ptr<ArrayCpuGpu<float>> spPeaksBlob;
 
-            ImplFaceExtractorCaffe(const std::string& modelFolder, const int gpuId, const bool enableGoogleLogging) :
+            ImplFaceExtractorCaffe(const std::string& modelFolder, const int gpuId, const bool enableGoogleLogging,
+                                   const std::string& weightCacheFolder) :
                 netInitialized{false},
+                resizeHeatMaps{true},
                 mGpuId{gpuId},
                 spNetCaffe{std::make_shared<NetCaffe>(modelFolder + FACE_PROTOTXT, modelFolder + FACE_TRAINED_MODEL,
-                                                      gpuId, enableGoogleLogging)},
+                                                      gpuId, enableGoogleLogging, "net_output", 1u,
+                                                      weightCacheFolder)},
                 spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
                 spMaximumCaffe{std::make_shared<MaximumCaffe<float>>()}
             {
@@ -82,18 +86,24 @@ namespace op
                                               std::shared_ptr<ArrayCpuGpu<float>>& caffeNetOutputBlob,
                                               std::shared_ptr<ArrayCpuGpu<float>>& heatMapsBlob,
                                               std::shared_ptr<ArrayCpuGpu<float>>& peaksBlob,
-                                              const int gpuID)
+                                              const bool resizeHeatMaps, const int gpuID)
         {
             try
             {
-                // HeatMaps extractor blob and layer
-                const bool mergeFirstDimension = true;
-                resizeAndMergeCaffe->Reshape(
-                    std::vector<ArrayCpuGpu<float>*>{caffeNetOutputBlob.get()},
-                    std::vector<ArrayCpuGpu<float>*>{heatMapsBlob.get()},
-                    FACE_CCN_DECREASE_FACTOR, 1.f, mergeFirstDimension, gpuID);
-                // Pose extractor blob and layer
-                maximumCaffe->Reshape({heatMapsBlob.get()}, {peaksBlob.get()});
+                if (resizeHeatMaps)
+                {
+                    // HeatMaps extractor blob and layer
+                    const bool mergeFirstDimension = true;
+                    resizeAndMergeCaffe->Reshape(
+                        std::vector<ArrayCpuGpu<float>*>{caffeNetOutputBlob.get()},
+                        std::vector<ArrayCpuGpu<float>*>{heatMapsBlob.get()},
+                        FACE_CCN_DECREASE_FACTOR, 1.f, mergeFirstDimension, gpuID);
+                    // Pose extractor blob and layer
+                    maximumCaffe->Reshape({heatMapsBlob.get()}, {peaksBlob.get()});
+                }
+                // Peaks directly from the net output (no heat maps resize)
+                else
+                    maximumCaffe->Reshape({caffeNetOutputBlob.get()}, {peaksBlob.get()}, FACE_CCN_DECREASE_FACTOR);
                 // Cuda check
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
@@ -109,10 +119,11 @@ namespace op
     FaceExtractorCaffe::FaceExtractorCaffe(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                            const std::string& modelFolder, const int gpuId,
                                            const std::vector<HeatMapType>& heatMapTypes,
-                                           const ScaleMode heatMapScaleMode, const bool enableGoogleLogging) :
-        FaceExtractorNet{netInputSize, netOutputSize, heatMapTypes, heatMapScaleMode}
+                                           const ScaleMode heatMapScaleMode, const bool enableGoogleLogging,
+                                           const int reuseFrames, const std::string& weightCacheFolder) :
+        FaceExtractorNet{netInputSize, netOutputSize, heatMapTypes, heatMapScaleMode, reuseFrames}
         #ifdef USE_CAFFE
-        , upImpl{new ImplFaceExtractorCaffe{modelFolder, gpuId, enableGoogleLogging}}
+        , upImpl{new ImplFaceExtractorCaffe{modelFolder, gpuId, enableGoogleLogging, weightCacheFolder}}
         #endif
     {
         try
@@ -125,6 +136,7 @@ namespace op
                 UNUSED(heatMapTypes);
                 UNUSED(heatMapScaleMode);
                 UNUSED(enableGoogleLogging);
+                UNUSED(weightCacheFolder);
                 error("OpenPose must be compiled with the `USE_CAFFE` & `USE_CUDA` macro definitions in order to run"
                       " this functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -159,6 +171,13 @@ namespace op
                 upImpl->spCaffeNetOutputBlob = upImpl->spNetCaffe->getOutputBlobArray();
                 upImpl->spHeatMapsBlob = {std::make_shared<ArrayCpuGpu<float>>(1,1,1,1)};
                 upImpl->spPeaksBlob = {std::make_shared<ArrayCpuGpu<float>>(1,1,1,1)};
+                // CPU: Heat maps only resized if they must be returned, otherwise the peaks are directly found (with
+                // subpixel accuracy) on the net output
+                #ifdef USE_CUDA
+                    upImpl->resizeHeatMaps = true;
+                #else
+                    upImpl->resizeHeatMaps = !mHeatMapTypes.empty();
+                #endif
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
@@ -178,6 +197,10 @@ namespace op
         try
         {
             #ifdef USE_CAFFE
+                // Keypoint re-use: new frame
+                if (spKeypointStabilityCache != nullptr)
+                    spKeypointStabilityCache->newFrame();
+
                 if (mEnabled && !faceRectangles.empty())
                 {
                     const cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
@@ -245,6 +268,14 @@ namespace op
                             // cv::Mat -> float*
                             uCharCvMatToFloatPtr(mFaceImageCrop.getPtr(), OP_CV2OPMAT(faceImage), true);
 
+                            // Still face: re-use its previous keypoints rather than running the network
+                            auto* const faceKeypointsPtr = mFaceKeypoints.getPtr()
+                                                         + person * mFaceKeypoints.getVolume(1,2);
+                            if (spKeypointStabilityCache != nullptr
+                                && spKeypointStabilityCache->reuse(
+                                    faceKeypointsPtr, mFaceKeypoints.getSize(1), faceRectangle, mFaceImageCrop))
+                                continue;
+
                             // // Debugging
                             // if (person < 5)
                             // cv::imshow("faceImage" + std::to_string(person), faceImage);
@@ -259,16 +290,23 @@ namespace op
                                 reshapeFaceExtractorCaffe(
                                     upImpl->spResizeAndMergeCaffe, upImpl->spMaximumCaffe,
                                     upImpl->spCaffeNetOutputBlob, upImpl->spHeatMapsBlob,
-                                    upImpl->spPeaksBlob, upImpl->mGpuId);
+                                    upImpl->spPeaksBlob, upImpl->resizeHeatMaps, upImpl->mGpuId);
                             }
 
-                            // 2. Resize heat maps + merge different scales
-                            upImpl->spResizeAndMergeCaffe->Forward(
-                                {upImpl->spCaffeNetOutputBlob.get()}, {upImpl->spHeatMapsBlob.get()});
+                            if (upImpl->resizeHeatMaps)
+                            {
+                                // 2. Resize heat maps + merge different scales
+                                upImpl->spResizeAndMergeCaffe->Forward(
+                                    {upImpl->spCaffeNetOutputBlob.get()}, {upImpl->spHeatMapsBlob.get()});
 
-                            // 3. Get peaks by Non-Maximum Suppression
-                            upImpl->spMaximumCaffe->Forward(
-                                {upImpl->spHeatMapsBlob.get()}, {upImpl->spPeaksBlob.get()});
+                                // 3. Get peaks by Non-Maximum Suppression
+                                upImpl->spMaximumCaffe->Forward(
+                                    {upImpl->spHeatMapsBlob.get()}, {upImpl->spPeaksBlob.get()});
+                            }
+                            // 2-3. Get peaks from the net output
+                            else
+                                upImpl->spMaximumCaffe->Forward(
+                                    {upImpl->spCaffeNetOutputBlob.get()}, {upImpl->spPeaksBlob.get()});
 
                             const auto* facePeaksPtr = upImpl->spPeaksBlob->mutable_cpu_data();
                             for (auto part = 0 ; part < mFaceKeypoints.getSize(1) ; part++)
@@ -287,6 +325,10 @@ namespace op
                                     + Mscaling.at<double>(1,2));
                                 mFaceKeypoints[baseIndex+2] = score;
                             }
+                            // Keypoint re-use: cache new keypoints
+                            if (spKeypointStabilityCache != nullptr)
+                                spKeypointStabilityCache->update(
+                                    faceKeypointsPtr, mFaceKeypoints.getSize(1), faceRectangle, mFaceImageCrop);
                             // HeatMaps: storing
                             if (!mHeatMapTypes.empty())
                             {
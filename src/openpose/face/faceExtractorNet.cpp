@@ -5,7 +5,7 @@ namespace op
 {
     FaceExtractorNet::FaceExtractorNet(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                        const std::vector<HeatMapType>& heatMapTypes,
-                                       const ScaleMode heatMapScaleMode) :
+                                       const ScaleMode heatMapScaleMode, const int reuseFrames) :
         mNetOutputSize{netOutputSize},
         mFaceImageCrop{{1, 3, mNetOutputSize.y, mNetOutputSize.x}},
         mHeatMapScaleMode{heatMapScaleMode},
@@ -35,6 +35,14 @@ namespace op
             if (!mHeatMapTypes.empty())
                 opLog("Note that only the keypoint heatmaps are available with face heatmaps (no background nor PAFs).",
                     Priority::High);
+            // Keypoint re-use (heat maps are not cached, so they require the network on every frame)
+            if (reuseFrames > 0)
+            {
+                if (mHeatMapTypes.empty())
+                    spKeypointStabilityCache = std::make_shared<KeypointStabilityCache>(reuseFrames);
+                else
+                    opLog("Face keypoint re-use is disabled when face heat maps are enabled.", Priority::High);
+            }
         }
         catch (const std::exception& e)
         {
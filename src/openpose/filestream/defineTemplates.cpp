@@ -10,8 +10,10 @@ namespace op
     DEFINE_TEMPLATE_DATUM(WHandSaver);
     DEFINE_TEMPLATE_DATUM(WHeatMapSaver);
     DEFINE_TEMPLATE_DATUM(WImageSaver);
+    DEFINE_TEMPLATE_DATUM(WNetOutputSaver);
     DEFINE_TEMPLATE_DATUM(WPeopleJsonSaver);
     DEFINE_TEMPLATE_DATUM(WPoseSaver);
+    DEFINE_TEMPLATE_DATUM(WSharedMemorySender);
     DEFINE_TEMPLATE_DATUM(WUdpSender);
     DEFINE_TEMPLATE_DATUM(WVideoSaver);
     DEFINE_TEMPLATE_DATUM(WVideoSaver3D);
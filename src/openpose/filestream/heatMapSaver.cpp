@@ -4,9 +4,12 @@
 
 namespace op
 {
-    HeatMapSaver::HeatMapSaver(const std::string& directoryPath, const std::string& imageFormat) :
+    HeatMapSaver::HeatMapSaver(
+        const std::string& directoryPath, const std::string& imageFormat,
+        const std::shared_ptr<ImageWriterPool>& imageWriterPool) :
         FileSaver{directoryPath},
-        mImageFormat{imageFormat}
+        mImageFormat{imageFormat},
+        spImageWriterPool{imageWriterPool}
     {
         try
         {
@@ -57,8 +60,16 @@ namespace op
                     for (auto i = 0u; i < cvOutputDatas.size(); i++)
                         unrollArrayToUCharCvMat(cvOutputDatas[i], heatMaps[i]);
                     // Save each heatMap
-                    for (auto i = 0u; i < cvOutputDatas.size(); i++)
-                        saveImage(cvOutputDatas[i], fileNames[i]);
+                    // Image writer pool: no copy required, cvOutputDatas are not used after this function
+                    if (spImageWriterPool != nullptr)
+                    {
+                        const auto copyMatrix = false;
+                        for (auto i = 0u; i < cvOutputDatas.size(); i++)
+                            spImageWriterPool->write(cvOutputDatas[i], fileNames[i], copyMatrix);
+                    }
+                    else
+                        for (auto i = 0u; i < cvOutputDatas.size(); i++)
+                            saveImage(cvOutputDatas[i], fileNames[i]);
                 }
             }
         }
@@ -3,9 +3,12 @@
 
 namespace op
 {
-    ImageSaver::ImageSaver(const std::string& directoryPath, const std::string& imageFormat) :
+    ImageSaver::ImageSaver(
+        const std::string& directoryPath, const std::string& imageFormat,
+        const std::shared_ptr<ImageWriterPool>& imageWriterPool) :
         FileSaver{directoryPath},
-        mImageFormat{imageFormat}
+        mImageFormat{imageFormat},
+        spImageWriterPool{imageWriterPool}
     {
         try
         {
@@ -50,8 +53,13 @@ namespace op
                     fileNames[i] = {fileNameNoExtension + (i != 0 ? "_" + std::to_string(i) : "") + "." + mImageFormat};
 
                 // Save each image
-                for (auto i = 0u; i < matOutputDatas.size(); i++)
-                    saveImage(matOutputDatas[i], fileNames[i]);
+                // Image writer pool: the images are copied, since the Datum memory might be re-used later
+                if (spImageWriterPool != nullptr)
+                    for (auto i = 0u; i < matOutputDatas.size(); i++)
+                        spImageWriterPool->write(matOutputDatas[i], fileNames[i]);
+                else
+                    for (auto i = 0u; i < matOutputDatas.size(); i++)
+                        saveImage(matOutputDatas[i], fileNames[i]);
             }
         }
         catch (const std::exception& e)
@@ -0,0 +1,284 @@
+#include <openpose/filestream/imageWriterPool.hpp>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <openpose/filestream/fileStream.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/fileSystem.hpp>
+#include <openpose/utilities/openCv.hpp>
+#include <openpose/utilities/profiler.hpp>
+#include <openpose/utilities/string.hpp>
+
+namespace op
+{
+    struct ImageWriterJob
+    {
+        unsigned long long index;
+        Matrix matrix;
+        std::string fullFilePath;
+        size_t bytes;
+    };
+
+    struct ImageFormatStats
+    {
+        unsigned long long images;
+        unsigned long long bytes;
+        double seconds;
+    };
+
+    struct ImageWriterPool::ImplImageWriterPool
+    {
+        const size_t mMaxMemoryBytes;
+        const std::vector<int> mCompressionParams;
+        std::vector<std::thread> mThreads;
+        mutable std::mutex mMutex;
+        std::condition_variable mConditionJobAdded;
+        std::condition_variable mConditionJobDone;
+        std::deque<ImageWriterJob> mJobs;
+        size_t mInFlightBytes;
+        unsigned long long mNextIndex;
+        // Ordered completion tracking
+        unsigned long long mWrittenCount;
+        std::set<unsigned long long> mWrittenOutOfOrder;
+        bool mCloseThreads;
+        std::string mError;
+        // Throughput stats (per file extension)
+        std::map<std::string, ImageFormatStats> mFormatStats;
+
+        ImplImageWriterPool(const int maxMemoryMB, const int pngCompression, const int jpgQuality) :
+            mMaxMemoryBytes{(size_t)fastMax(0, maxMemoryMB) * 1024u * 1024u},
+            mCompressionParams{getCvImwriteJpegQuality(), jpgQuality, getCvImwritePngCompression(), pngCompression},
+            mInFlightBytes{0u},
+            mNextIndex{0ull},
+            mWrittenCount{0ull},
+            mCloseThreads{false}
+        {
+        }
+
+        // Saves the image and updates the stats (mMutex must not be locked by the caller)
+        void saveAndRecord(const ImageWriterJob& job)
+        {
+            std::string errorMessage;
+            const auto timerInit = getTimerInit();
+            try
+            {
+                saveImage(job.matrix, job.fullFilePath, mCompressionParams);
+            }
+            catch (const std::exception& e)
+            {
+                errorMessage = e.what();
+            }
+            const auto seconds = getTimeSeconds(timerInit);
+            // Stats and ordered completion
+            std::lock_guard<std::mutex> lock{mMutex};
+            auto& formatStats = mFormatStats[toLower(getFileExtension(job.fullFilePath))];
+            formatStats.images++;
+            formatStats.bytes += job.bytes;
+            formatStats.seconds += seconds;
+            if (!errorMessage.empty() && mError.empty())
+                mError = errorMessage;
+            mWrittenOutOfOrder.emplace(job.index);
+            while (!mWrittenOutOfOrder.empty() && *mWrittenOutOfOrder.begin() == mWrittenCount)
+            {
+                mWrittenOutOfOrder.erase(mWrittenOutOfOrder.begin());
+                mWrittenCount++;
+            }
+        }
+
+        void encoderThread()
+        {
+            // No error() calls in here: errors are saved and re-thrown in the next write() or flush()
+            while (true)
+            {
+                ImageWriterJob job;
+                {
+                    std::unique_lock<std::mutex> lock{mMutex};
+                    mConditionJobAdded.wait(lock, [this]{ return mCloseThreads || !mJobs.empty(); });
+                    // Closing and all the remaining images already saved
+                    if (mJobs.empty())
+                        break;
+                    job = std::move(mJobs.front());
+                    mJobs.pop_front();
+                }
+                saveAndRecord(job);
+                {
+                    std::lock_guard<std::mutex> lock{mMutex};
+                    mInFlightBytes -= job.bytes;
+                }
+                mConditionJobDone.notify_all();
+            }
+        }
+
+        void logStats() const
+        {
+            try
+            {
+                std::lock_guard<std::mutex> lock{mMutex};
+                for (const auto& formatStats : mFormatStats)
+                {
+                    const auto& stats = formatStats.second;
+                    const auto images = fastMax(1ull, stats.images);
+                    opLog("Image writer (" + formatStats.first + "): " + std::to_string(stats.images) + " images ("
+                          + std::to_string(stats.bytes / (1024ull*1024ull)) + " MB raw) at "
+                          + std::to_string(1e3*stats.seconds/images) + " ms/image ("
+                          + std::to_string(stats.seconds > 0. ? stats.images/stats.seconds : 0.)
+                          + " images/second per thread, " + std::to_string(fastMax(1, (int)mThreads.size()))
+                          + " threads).", Priority::High);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        void throwIfError() const
+        {
+            try
+            {
+                std::lock_guard<std::mutex> lock{mMutex};
+                if (!mError.empty())
+                    error("Image writer thread failed: " + mError, __LINE__, __FUNCTION__, __FILE__);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+    };
+
+    ImageWriterPool::ImageWriterPool(
+        const int numberThreads, const int maxMemoryMB, const int pngCompression, const int jpgQuality) :
+        upImpl{new ImplImageWriterPool{maxMemoryMB, pngCompression, jpgQuality}}
+    {
+        try
+        {
+            // Sanity checks
+            if (maxMemoryMB <= 0)
+                error("The maximum image writer memory must be > 0 MB.", __LINE__, __FUNCTION__, __FILE__);
+            if (pngCompression < 0 || pngCompression > 9)
+                error("The PNG compression level must be in the range [0, 9].", __LINE__, __FUNCTION__, __FILE__);
+            if (jpgQuality < 0 || jpgQuality > 100)
+                error("The JPG quality must be in the range [0, 100].", __LINE__, __FUNCTION__, __FILE__);
+            // Start encoder threads
+            const auto finalNumberThreads = (numberThreads < 0
+                ? fastMax(1, (int)std::thread::hardware_concurrency()) : numberThreads);
+            for (auto i = 0 ; i < finalNumberThreads ; i++)
+                upImpl->mThreads.emplace_back(&ImplImageWriterPool::encoderThread, upImpl.get());
+            if (finalNumberThreads > 0)
+                opLog("Saving images with " + std::to_string(finalNumberThreads) + " encoder threads.",
+                      Priority::High);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    ImageWriterPool::~ImageWriterPool()
+    {
+        try
+        {
+            // Save the remaining queued images and close the encoder threads
+            {
+                std::lock_guard<std::mutex> lock{upImpl->mMutex};
+                upImpl->mCloseThreads = true;
+            }
+            upImpl->mConditionJobAdded.notify_all();
+            for (auto& thread : upImpl->mThreads)
+                if (thread.joinable())
+                    thread.join();
+            // Stats
+            upImpl->logStats();
+            if (!upImpl->mError.empty())
+                opLog("Image writer thread failed: " + upImpl->mError, Priority::High);
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    unsigned long long ImageWriterPool::write(
+        const Matrix& matrix, const std::string& fullFilePath, const bool copyMatrix)
+    {
+        try
+        {
+            upImpl->throwIfError();
+            // Sanity check
+            if (matrix.empty())
+                error("The image to be saved cannot be empty.", __LINE__, __FUNCTION__, __FILE__);
+            ImageWriterJob job;
+            job.bytes = matrix.total() * matrix.elemSize();
+            job.fullFilePath = fullFilePath;
+            {
+                std::lock_guard<std::mutex> lock{upImpl->mMutex};
+                job.index = upImpl->mNextIndex++;
+            }
+            const auto index = job.index;
+            // Synchronous mode
+            if (upImpl->mThreads.empty())
+            {
+                job.matrix = matrix;
+                upImpl->saveAndRecord(job);
+                upImpl->throwIfError();
+            }
+            // Asynchronous mode
+            else
+            {
+                // The copy is done before waiting, so it overlaps with the encoding of the previous images
+                job.matrix = (copyMatrix ? matrix.clone() : matrix);
+                std::unique_lock<std::mutex> lock{upImpl->mMutex};
+                // Bounded in-flight memory (1 image is always allowed, even if bigger than the limit)
+                upImpl->mConditionJobDone.wait(
+                    lock, [this, &job]{
+                        return upImpl->mInFlightBytes == 0u
+                            || upImpl->mInFlightBytes + job.bytes <= upImpl->mMaxMemoryBytes; });
+                upImpl->mInFlightBytes += job.bytes;
+                upImpl->mJobs.emplace_back(std::move(job));
+                lock.unlock();
+                upImpl->mConditionJobAdded.notify_one();
+            }
+            return index;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    unsigned long long ImageWriterPool::getWrittenCount() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mWrittenCount;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    void ImageWriterPool::flush()
+    {
+        try
+        {
+            {
+                std::unique_lock<std::mutex> lock{upImpl->mMutex};
+                upImpl->mConditionJobDone.wait(
+                    lock, [this]{ return upImpl->mWrittenCount == upImpl->mNextIndex; });
+            }
+            upImpl->throwIfError();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
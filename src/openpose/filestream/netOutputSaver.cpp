@@ -0,0 +1,84 @@
+#include <openpose/filestream/netOutputSaver.hpp>
+#include <cstdint> // uint32_t, int32_t, uint64_t
+#include <fstream> // std::ofstream
+
+namespace op
+{
+    struct NetOutputSaver::ImplNetOutputSaver
+    {
+        const std::string mFilePath;
+        std::ofstream mOfstream;
+
+        explicit ImplNetOutputSaver(const std::string& filePath) :
+            mFilePath{filePath},
+            mOfstream{filePath, std::ios::out | std::ios::binary}
+        {
+        }
+    };
+
+    template<typename T>
+    void writeNetOutputBinary(std::ofstream& ofstream, const T value)
+    {
+        ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void writeNetOutputSize(std::ofstream& ofstream, const std::vector<int>& size)
+    {
+        writeNetOutputBinary(ofstream, (uint32_t)size.size());
+        for (const auto& sizeI : size)
+            writeNetOutputBinary(ofstream, (int32_t)sizeI);
+    }
+
+    NetOutputSaver::NetOutputSaver(const std::string& filePath) :
+        upImpl{new ImplNetOutputSaver{filePath}}
+    {
+        try
+        {
+            if (!upImpl->mOfstream.is_open())
+                error("Net output file could not be opened as `" + filePath + "`. Please, check that the parent"
+                      " folder exists and it is not a protected folder.", __LINE__, __FUNCTION__, __FILE__);
+            // Header
+            upImpl->mOfstream.write(NET_OUTPUT_FILE_MAGIC, sizeof(NET_OUTPUT_FILE_MAGIC) - 1);
+            writeNetOutputBinary(upImpl->mOfstream, (uint32_t)NET_OUTPUT_FILE_VERSION);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    NetOutputSaver::~NetOutputSaver()
+    {
+    }
+
+    void NetOutputSaver::write(const NetOutputRecord& netOutputRecord)
+    {
+        try
+        {
+            // Sanity check
+            if (netOutputRecord.netOutput.empty())
+                error("Empty net output for frame " + std::to_string(netOutputRecord.frameNumber) + ".",
+                      __LINE__, __FUNCTION__, __FILE__);
+            // Record
+            auto& ofstream = upImpl->mOfstream;
+            writeNetOutputBinary(ofstream, (uint64_t)netOutputRecord.frameNumber);
+            writeNetOutputBinary(ofstream, (uint32_t)netOutputRecord.name.size());
+            ofstream.write(netOutputRecord.name.data(), netOutputRecord.name.size());
+            writeNetOutputBinary(ofstream, (int32_t)netOutputRecord.inputResolution.x);
+            writeNetOutputBinary(ofstream, (int32_t)netOutputRecord.inputResolution.y);
+            writeNetOutputSize(ofstream, netOutputRecord.netInputSize);
+            writeNetOutputBinary(ofstream, netOutputRecord.scaleInputToNetInput);
+            writeNetOutputSize(ofstream, netOutputRecord.netOutput.getSize());
+            ofstream.write(reinterpret_cast<const char*>(netOutputRecord.netOutput.getConstPtr()),
+                           netOutputRecord.netOutput.getVolume() * sizeof(float));
+            // Sanity check
+            if (!ofstream.good())
+                error("Net output could not be written into `" + upImpl->mFilePath + "` (e.g., disk full).",
+                      __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
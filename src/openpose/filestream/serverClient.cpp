@@ -0,0 +1,203 @@
+#include <openpose/filestream/serverClient.hpp>
+#include <cerrno>
+#include <cstring> // std::strerror, std::memset
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace op
+{
+    namespace
+    {
+        #ifdef MSG_NOSIGNAL
+            const int SEND_FLAGS = MSG_NOSIGNAL;
+        #else
+            const int SEND_FLAGS = 0; // Apple: SO_NOSIGPIPE is set on the socket instead
+        #endif
+
+        std::runtime_error socketError(const std::string& message)
+        {
+            return std::runtime_error{"ServerClient: " + message + " (" + std::strerror(errno) + ")."};
+        }
+
+        void sendAll(const int socketFd, const unsigned char* data, unsigned long long size)
+        {
+            while (size > 0)
+            {
+                const auto sent = ::send(socketFd, data, size, SEND_FLAGS);
+                if (sent < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw socketError("send failed");
+                }
+                data += sent;
+                size -= (unsigned long long)sent;
+            }
+        }
+
+        // It returns false if the connection was closed before reading anything
+        bool receiveAll(const int socketFd, unsigned char* data, unsigned long long size)
+        {
+            const auto totalSize = size;
+            while (size > 0)
+            {
+                const auto received = ::recv(socketFd, data, size, 0);
+                if (received < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw socketError("recv failed");
+                }
+                if (received == 0)
+                {
+                    if (size == totalSize)
+                        return false;
+                    throw std::runtime_error{"ServerClient: connection closed in the middle of a response."};
+                }
+                data += received;
+                size -= (unsigned long long)received;
+            }
+            return true;
+        }
+    }
+
+    ServerClient::ServerClient(const std::string& socketPath) :
+        mSocket{-1},
+        mNextRequestId{0ull}
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+            throw std::runtime_error{"ServerClient: invalid socket path `" + socketPath + "`."};
+        std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        mSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (mSocket < 0)
+            throw socketError("socket failed");
+        #ifdef SO_NOSIGPIPE
+            const int enable = 1;
+            ::setsockopt(mSocket, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+        #endif
+        if (::connect(mSocket, (const sockaddr*)&address, sizeof(address)) != 0)
+        {
+            const auto exception = socketError("could not connect to `" + socketPath + "`, is openpose_server running");
+            ::close(mSocket);
+            mSocket = -1;
+            throw exception;
+        }
+    }
+
+    ServerClient::~ServerClient()
+    {
+        if (mSocket >= 0)
+            ::close(mSocket);
+    }
+
+    unsigned long long ServerClient::sendRaw(
+        const unsigned char* const bgr, const unsigned int rows, const unsigned int cols,
+        const unsigned long long step)
+    {
+        if (bgr == nullptr || rows == 0 || cols == 0)
+            throw std::runtime_error{"ServerClient: empty image given to sendRaw."};
+        OpServerRequestHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.format = OP_SERVER_FORMAT_BGR;
+        header.rows = rows;
+        header.cols = cols;
+        header.payloadSize = (unsigned long long)rows * cols * 3ull;
+        sendHeaderAndPayload(header, bgr, header.payloadSize, rows, (step > 0ull ? step : cols * 3ull));
+        return header.requestId;
+    }
+
+    unsigned long long ServerClient::sendEncoded(const unsigned char* const data, const unsigned long long size)
+    {
+        if (data == nullptr || size == 0)
+            throw std::runtime_error{"ServerClient: empty image given to sendEncoded."};
+        OpServerRequestHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.format = OP_SERVER_FORMAT_ENCODED;
+        header.payloadSize = size;
+        sendHeaderAndPayload(header, data, size, 1u, size);
+        return header.requestId;
+    }
+
+    bool ServerClient::receive(ServerResult& result)
+    {
+        if (mSocket < 0)
+            throw std::runtime_error{"ServerClient: not connected."};
+        OpServerResponseHeader header;
+        if (!receiveAll(mSocket, (unsigned char*)&header, sizeof(header)))
+            return false;
+        if (header.magic != OP_SERVER_RESPONSE_MAGIC || header.version != OP_SERVER_VERSION)
+            throw std::runtime_error{"ServerClient: unexpected response header (different server version?)."};
+        // Expected payload
+        const auto numberKeypoints = (unsigned long long)header.numberPeople * header.numberBodyParts * 3ull;
+        const auto hasIds = (header.flags & OP_SERVER_FLAG_POSE_IDS) != 0u;
+        const auto hasScores = (header.flags & OP_SERVER_FLAG_POSE_SCORES) != 0u;
+        const auto expectedSize = (header.status == OP_SERVER_OK
+            ? numberKeypoints * sizeof(float) + (hasIds ? header.numberPeople * sizeof(int64_t) : 0ull)
+                + (hasScores ? header.numberPeople * sizeof(float) : 0ull)
+            : 0ull);
+        if (header.payloadSize != expectedSize)
+            throw std::runtime_error{"ServerClient: response payload size does not match its header."};
+        // Fill result
+        result.requestId = header.requestId;
+        result.status = header.status;
+        result.numberPeople = (header.status == OP_SERVER_OK ? header.numberPeople : 0u);
+        result.numberBodyParts = (header.status == OP_SERVER_OK ? header.numberBodyParts : 0u);
+        result.serverNanoseconds = header.serverNanoseconds;
+        result.poseKeypoints.resize(header.status == OP_SERVER_OK ? numberKeypoints : 0ull);
+        result.poseIds.resize(header.status == OP_SERVER_OK && hasIds ? header.numberPeople : 0u);
+        result.poseScores.resize(header.status == OP_SERVER_OK && hasScores ? header.numberPeople : 0u);
+        auto receiveVector = [&](unsigned char* data, const unsigned long long size)
+        {
+            if (size > 0 && !receiveAll(mSocket, data, size))
+                throw std::runtime_error{"ServerClient: connection closed in the middle of a response."};
+        };
+        receiveVector((unsigned char*)result.poseKeypoints.data(), result.poseKeypoints.size() * sizeof(float));
+        if (!result.poseIds.empty())
+        {
+            std::vector<int64_t> poseIds(result.poseIds.size());
+            receiveVector((unsigned char*)poseIds.data(), poseIds.size() * sizeof(int64_t));
+            for (auto i = 0u ; i < poseIds.size() ; i++)
+                result.poseIds[i] = (long long)poseIds[i];
+        }
+        receiveVector((unsigned char*)result.poseScores.data(), result.poseScores.size() * sizeof(float));
+        return true;
+    }
+
+    void ServerClient::shutdownSend()
+    {
+        if (mSocket >= 0)
+            ::shutdown(mSocket, SHUT_WR);
+    }
+
+    bool ServerClient::isConnected() const
+    {
+        return mSocket >= 0;
+    }
+
+    void ServerClient::sendHeaderAndPayload(
+        OpServerRequestHeader& header, const unsigned char* const payload, const unsigned long long payloadSize,
+        const unsigned int rows, const unsigned long long step)
+    {
+        if (mSocket < 0)
+            throw std::runtime_error{"ServerClient: not connected."};
+        // Requests (header + payload) must not be interleaved between threads
+        const std::lock_guard<std::mutex> lock{mSendMutex};
+        header.magic = OP_SERVER_REQUEST_MAGIC;
+        header.version = OP_SERVER_VERSION;
+        header.requestId = mNextRequestId++;
+        sendAll(mSocket, (const unsigned char*)&header, sizeof(header));
+        // Contiguous payload
+        const auto rowSize = payloadSize / rows;
+        if (step == rowSize)
+            sendAll(mSocket, payload, payloadSize);
+        // Padded rows (e.g., a cv::Mat ROI)
+        else
+            for (auto row = 0u ; row < rows ; row++)
+                sendAll(mSocket, payload + row * step, rowSize);
+    }
+}
@@ -0,0 +1,226 @@
+#include <openpose/filestream/sharedMemoryReader.h>
+#include <errno.h>
+#include <fcntl.h> /* O_RDONLY */
+#include <sched.h> /* sched_yield */
+#include <stdlib.h> /* malloc, free */
+#include <string.h> /* memcpy */
+#include <sys/mman.h> /* shm_open, mmap, munmap */
+#include <sys/stat.h> /* fstat */
+#include <unistd.h> /* close */
+
+/* Maximum number of attempts to get a consistent copy of a slot */
+#define OP_SHM_MAX_READ_ATTEMPTS 1000
+
+struct OpShmReader
+{
+    const unsigned char* segment;
+    size_t segmentSize;
+    const OpShmHeader* header;
+    unsigned char* buffer; /* Slot copy returned to the user */
+    uint64_t nextCounter;
+};
+
+static void setStatus(int* status, const int value)
+{
+    if (status != NULL)
+        *status = value;
+}
+
+OpShmReader* op_shm_reader_open(const char* name, int* status)
+{
+    int fd;
+    struct stat fileStat;
+    void* segment;
+    const OpShmHeader* header;
+    OpShmReader* reader;
+    if (name == NULL)
+    {
+        setStatus(status, OP_SHM_ERROR);
+        return NULL;
+    }
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        setStatus(status, (errno == ENOENT ? OP_SHM_ERROR_NOT_FOUND : OP_SHM_ERROR));
+        return NULL;
+    }
+    if (fstat(fd, &fileStat) != 0 || (size_t)fileStat.st_size < sizeof(OpShmHeader))
+    {
+        close(fd);
+        setStatus(status, OP_SHM_ERROR_VERSION);
+        return NULL;
+    }
+    segment = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        setStatus(status, OP_SHM_ERROR);
+        return NULL;
+    }
+    /* Sanity checks (state first, so the rest of the header is visible) */
+    header = (const OpShmHeader*)segment;
+    if (__atomic_load_n(&header->state, __ATOMIC_ACQUIRE) == OP_SHM_STATE_INITIALIZING)
+    {
+        munmap(segment, (size_t)fileStat.st_size);
+        setStatus(status, OP_SHM_ERROR_NOT_FOUND);
+        return NULL;
+    }
+    if (header->magic != OP_SHM_MAGIC || header->version != OP_SHM_VERSION
+        || header->headerSize != sizeof(OpShmHeader) || header->slotHeaderSize != sizeof(OpShmSlotHeader)
+        || header->numberSlots == 0 || header->slotSize < sizeof(OpShmSlotHeader)
+        || header->slotsOffset + header->numberSlots * header->slotSize > (uint64_t)fileStat.st_size)
+    {
+        munmap(segment, (size_t)fileStat.st_size);
+        setStatus(status, OP_SHM_ERROR_VERSION);
+        return NULL;
+    }
+    /* Reader */
+    reader = (OpShmReader*)malloc(sizeof(OpShmReader));
+    if (reader != NULL)
+        reader->buffer = (unsigned char*)malloc((size_t)header->slotSize);
+    if (reader == NULL || reader->buffer == NULL)
+    {
+        free(reader);
+        munmap(segment, (size_t)fileStat.st_size);
+        setStatus(status, OP_SHM_ERROR);
+        return NULL;
+    }
+    reader->segment = (const unsigned char*)segment;
+    reader->segmentSize = (size_t)fileStat.st_size;
+    reader->header = header;
+    /* Only frames published after opening it */
+    reader->nextCounter = __atomic_load_n(&header->writeCounter, __ATOMIC_ACQUIRE);
+    setStatus(status, OP_SHM_OK);
+    return reader;
+}
+
+void op_shm_reader_close(OpShmReader* reader)
+{
+    if (reader != NULL)
+    {
+        munmap((void*)reader->segment, reader->segmentSize);
+        free(reader->buffer);
+        free(reader);
+    }
+}
+
+const OpShmHeader* op_shm_reader_header(const OpShmReader* reader)
+{
+    return (reader != NULL ? reader->header : NULL);
+}
+
+/* Copy slot of frame `counter` into reader->buffer. Returns OP_SHM_NO_FRAME if it was already overwritten */
+static int copySlot(OpShmReader* reader, const uint64_t counter)
+{
+    const OpShmHeader* header = reader->header;
+    const unsigned char* slot = reader->segment + header->slotsOffset
+                              + (counter % header->numberSlots) * header->slotSize;
+    const OpShmSlotHeader* slotHeader = (const OpShmSlotHeader*)slot;
+    const OpShmSlotHeader* copiedHeader = (const OpShmSlotHeader*)reader->buffer;
+    int attempt;
+    for (attempt = 0 ; attempt < OP_SHM_MAX_READ_ATTEMPTS ; attempt++)
+    {
+        uint64_t payloadSize;
+        const uint64_t sequenceBefore = __atomic_load_n(&slotHeader->sequence, __ATOMIC_ACQUIRE);
+        /* Being written */
+        if (sequenceBefore & 1u)
+        {
+            sched_yield();
+            continue;
+        }
+        memcpy(reader->buffer, slot, sizeof(OpShmSlotHeader));
+        payloadSize = copiedHeader->payloadSize;
+        if (payloadSize > header->slotSize - sizeof(OpShmSlotHeader))
+            payloadSize = header->slotSize - sizeof(OpShmSlotHeader);
+        memcpy(reader->buffer + sizeof(OpShmSlotHeader), slot + sizeof(OpShmSlotHeader), (size_t)payloadSize);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        /* Consistent copy */
+        if (__atomic_load_n(&slotHeader->sequence, __ATOMIC_RELAXED) == sequenceBefore)
+            return (copiedHeader->frameCounter == counter ? OP_SHM_OK : OP_SHM_NO_FRAME);
+    }
+    return OP_SHM_ERROR_BUSY;
+}
+
+static void fillFrame(const OpShmReader* reader, OpShmFrame* frame)
+{
+    const unsigned char* buffer = reader->buffer;
+    const OpShmSlotHeader* slotHeader = (const OpShmSlotHeader*)buffer;
+    const uint64_t handElements = (uint64_t)slotHeader->numberPeople * slotHeader->numberHandParts * 3u;
+    frame->frameCounter = slotHeader->frameCounter;
+    frame->id = slotHeader->id;
+    frame->subId = slotHeader->subId;
+    frame->subIdMax = slotHeader->subIdMax;
+    frame->frameNumber = slotHeader->frameNumber;
+    frame->timestampNs = slotHeader->timestampNs;
+    frame->flags = slotHeader->flags;
+    frame->numberPeople = slotHeader->numberPeople;
+    frame->numberBodyParts = slotHeader->numberBodyParts;
+    frame->numberFaceParts = slotHeader->numberFaceParts;
+    frame->numberHandParts = slotHeader->numberHandParts;
+    frame->imageRows = slotHeader->imageRows;
+    frame->imageCols = slotHeader->imageCols;
+    frame->imageChannels = slotHeader->imageChannels;
+    frame->poseKeypoints = (slotHeader->numberBodyParts > 0
+        ? (const float*)(buffer + slotHeader->poseKeypointsOffset) : NULL);
+    frame->poseIds = ((slotHeader->flags & OP_SHM_FLAG_POSE_IDS)
+        ? (const int64_t*)(buffer + slotHeader->poseIdsOffset) : NULL);
+    frame->poseScores = ((slotHeader->flags & OP_SHM_FLAG_POSE_SCORES)
+        ? (const float*)(buffer + slotHeader->poseScoresOffset) : NULL);
+    frame->faceKeypoints = (slotHeader->numberFaceParts > 0
+        ? (const float*)(buffer + slotHeader->faceKeypointsOffset) : NULL);
+    frame->leftHandKeypoints = (slotHeader->numberHandParts > 0
+        ? (const float*)(buffer + slotHeader->handKeypointsOffset) : NULL);
+    frame->rightHandKeypoints = (slotHeader->numberHandParts > 0
+        ? frame->leftHandKeypoints + handElements : NULL);
+    frame->image = ((slotHeader->flags & OP_SHM_FLAG_IMAGE)
+        ? (const uint8_t*)(buffer + slotHeader->imageOffset) : NULL);
+}
+
+static int readFrame(OpShmReader* reader, OpShmFrame* frame, const int latest)
+{
+    const OpShmHeader* header;
+    uint64_t expectedCounter;
+    if (reader == NULL || frame == NULL)
+        return OP_SHM_ERROR;
+    header = reader->header;
+    expectedCounter = reader->nextCounter;
+    for (;;)
+    {
+        /* State before counter: if closed, writeCounter is already final */
+        const uint32_t state = __atomic_load_n(&header->state, __ATOMIC_ACQUIRE);
+        const uint64_t writeCounter = __atomic_load_n(&header->writeCounter, __ATOMIC_ACQUIRE);
+        uint64_t counter = reader->nextCounter;
+        int status;
+        if (counter >= writeCounter)
+            return (state == OP_SHM_STATE_CLOSED ? OP_SHM_CLOSED : OP_SHM_NO_FRAME);
+        if (latest)
+            counter = writeCounter - 1u;
+        /* Frames older than the ring were already overwritten, skip them. The oldest frame of the ring might be
+           being overwritten right now, in which case copySlot() waits for it and reports it as overwritten */
+        else if (writeCounter - counter > header->numberSlots)
+            counter = writeCounter - header->numberSlots;
+        status = copySlot(reader, counter);
+        /* Overwritten while reading it: the writer lapped this reader, retry with the next frame */
+        if (status == OP_SHM_NO_FRAME)
+        {
+            reader->nextCounter = counter + 1u;
+            continue;
+        }
+        if (status != OP_SHM_OK)
+            return status;
+        fillFrame(reader, frame);
+        frame->droppedFrames = counter - expectedCounter;
+        reader->nextCounter = counter + 1u;
+        return OP_SHM_OK;
+    }
+}
+
+int op_shm_reader_read_next(OpShmReader* reader, OpShmFrame* frame)
+{
+    return readFrame(reader, frame, 0);
+}
+
+int op_shm_reader_read_latest(OpShmReader* reader, OpShmFrame* frame)
+{
+    return readFrame(reader, frame, 1);
+}
@@ -0,0 +1,349 @@
+#include <openpose/filestream/sharedMemorySender.hpp>
+#ifndef _WIN32
+    #include <cerrno>
+    #include <chrono>
+    #include <cstring> // std::memcpy, std::strerror
+    #include <csignal> // kill
+    #include <fcntl.h> // O_CREAT, O_EXCL, O_RDONLY, O_RDWR
+    #include <sys/mman.h> // shm_open, shm_unlink, mmap, munmap
+    #include <sys/stat.h> // fstat
+    #include <unistd.h> // close, ftruncate, getpid
+#endif
+#include <openpose/filestream/sharedMemoryProtocol.h>
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    #ifndef _WIN32
+        // Upper bounds used to size each slot (BODY_135 is the model with the most body parts)
+        const auto SHM_MAX_BODY_PARTS = 135ull;
+        const auto SHM_MAX_FACE_PARTS = 70ull;
+        const auto SHM_MAX_HAND_PARTS = 21ull;
+
+        inline unsigned long long alignTo8(const unsigned long long bytes)
+        {
+            return (bytes + 7ull) & ~7ull;
+        }
+
+        unsigned long long getKeypointsPayloadSize(
+            const unsigned long long numberPeople, const unsigned long long numberBodyParts,
+            const unsigned long long numberFaceParts, const unsigned long long numberHandParts)
+        {
+            // Body keypoints + IDs + scores + face keypoints + left & right hand keypoints
+            return alignTo8(numberPeople * numberBodyParts * 3 * sizeof(float))
+                + alignTo8(numberPeople * sizeof(int64_t))
+                + alignTo8(numberPeople * sizeof(float))
+                + alignTo8(numberPeople * numberFaceParts * 3 * sizeof(float))
+                + alignTo8(2 * numberPeople * numberHandParts * 3 * sizeof(float));
+        }
+
+        template<typename T>
+        inline bool hasPeople(const Array<T>& array, const unsigned long long numberPeople)
+        {
+            return !array.empty() && (unsigned long long)array.getSize(0) == numberPeople;
+        }
+
+        // Copy the first numberPeople people of a [people x ...] array, return the aligned number of bytes used
+        template<typename T>
+        unsigned long long copyPeople(
+            unsigned char* const dstPtr, const Array<T>& array, const unsigned long long numberPeople)
+        {
+            if (numberPeople == 0 || array.empty())
+                return 0ull;
+            const auto bytes = numberPeople * (array.getVolume() / array.getSize(0)) * sizeof(T);
+            std::memcpy(dstPtr, array.getConstPtr(), bytes);
+            return alignTo8(bytes);
+        }
+
+        // Whether an existing segment can be replaced: only if it was left by an OpenPose writer that already closed
+        // it or that is no longer running (e.g., it crashed). Otherwise, it returns the reason why it cannot be
+        // replaced.
+        std::string getStaleSegmentError(const std::string& name)
+        {
+            const auto fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0)
+                return (errno == ENOENT ? "" : std::string{"it could not be opened: "} + std::strerror(errno));
+            struct stat fileStat;
+            const auto validSize = (fstat(fd, &fileStat) == 0 && (size_t)fileStat.st_size >= sizeof(OpShmHeader));
+            auto* segmentPtr = (validSize
+                ? mmap(nullptr, sizeof(OpShmHeader), PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED);
+            close(fd);
+            if (segmentPtr == MAP_FAILED)
+                return "it is not an OpenPose shared memory output";
+            const auto* headerPtr = reinterpret_cast<const OpShmHeader*>(segmentPtr);
+            const auto isOpenPose = (headerPtr->magic == OP_SHM_MAGIC);
+            const auto state = __atomic_load_n(&headerPtr->state, __ATOMIC_ACQUIRE);
+            const auto writerPid = (pid_t)headerPtr->writerPid;
+            munmap(segmentPtr, sizeof(OpShmHeader));
+            if (!isOpenPose)
+                return "it is not an OpenPose shared memory output";
+            if (state == OP_SHM_STATE_CLOSED || writerPid <= 0 || (kill(writerPid, 0) != 0 && errno == ESRCH))
+                return "";
+            return "it is being written by another running OpenPose process (pid " + std::to_string(writerPid)
+                + ")";
+        }
+    #endif
+
+    struct SharedMemorySender::ImplSharedMemorySender
+    {
+        const std::string mName;
+        const bool mSendImage;
+        const unsigned long long mNumberSlots;
+        const unsigned long long mMaximumPeople;
+        unsigned long long mFrameCounter;
+        unsigned long long mSlotSize;
+        size_t mSegmentSize;
+        unsigned char* pSegment;
+
+        ImplSharedMemorySender(
+            const std::string& sharedMemoryName, const bool sendImage, const int numberSlots,
+            const int maximumPeople) :
+            mName{(!sharedMemoryName.empty() && sharedMemoryName[0] == '/' ? "" : "/") + sharedMemoryName},
+            mSendImage{sendImage},
+            mNumberSlots{(unsigned long long)numberSlots},
+            mMaximumPeople{(unsigned long long)maximumPeople},
+            mFrameCounter{0ull},
+            mSlotSize{0ull},
+            mSegmentSize{0},
+            pSegment{nullptr}
+        {
+        }
+
+        ~ImplSharedMemorySender()
+        {
+            try
+            {
+                #ifndef _WIN32
+                    if (pSegment != nullptr)
+                    {
+                        // Let readers know no more frames will come
+                        auto* headerPtr = reinterpret_cast<OpShmHeader*>(pSegment);
+                        __atomic_store_n(&headerPtr->state, OP_SHM_STATE_CLOSED, __ATOMIC_RELEASE);
+                        munmap(pSegment, mSegmentSize);
+                        // Already-mapped readers keep their mapping until they close it
+                        shm_unlink(mName.c_str());
+                    }
+                #endif
+            }
+            catch (const std::exception& e)
+            {
+                errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        #ifndef _WIN32
+            void createSegment(const unsigned long long imageBytes)
+            {
+                try
+                {
+                    mSlotSize = alignTo8(sizeof(OpShmSlotHeader) + getKeypointsPayloadSize(
+                        mMaximumPeople, SHM_MAX_BODY_PARTS, SHM_MAX_FACE_PARTS, SHM_MAX_HAND_PARTS) + imageBytes);
+                    const auto slotsOffset = alignTo8(sizeof(OpShmHeader));
+                    mSegmentSize = size_t(slotsOffset + mNumberSlots * mSlotSize);
+                    auto fd = shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+                    // Existing segment: only replaced if it is a leftover (e.g., from a crashed previous run)
+                    if (fd < 0 && errno == EEXIST)
+                    {
+                        const auto staleSegmentError = getStaleSegmentError(mName);
+                        if (!staleSegmentError.empty())
+                            error("Shared memory `" + mName + "` already exists and " + staleSegmentError + ". Choose"
+                                  " a different `--write_shared_memory` name (or remove `/dev/shm" + mName + "` if"
+                                  " it is not in use).", __LINE__, __FUNCTION__, __FILE__);
+                        shm_unlink(mName.c_str());
+                        fd = shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+                    }
+                    if (fd < 0)
+                        error("Shared memory `" + mName + "` could not be created: " + std::strerror(errno),
+                              __LINE__, __FUNCTION__, __FILE__);
+                    if (ftruncate(fd, (off_t)mSegmentSize) != 0)
+                    {
+                        const std::string errorMessage = std::strerror(errno);
+                        close(fd);
+                        shm_unlink(mName.c_str());
+                        error("Shared memory `" + mName + "` could not be resized to " + std::to_string(mSegmentSize)
+                              + " bytes: " + errorMessage, __LINE__, __FUNCTION__, __FILE__);
+                    }
+                    auto* segmentPtr = mmap(nullptr, mSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    close(fd);
+                    if (segmentPtr == MAP_FAILED)
+                    {
+                        shm_unlink(mName.c_str());
+                        error("Shared memory `" + mName + "` could not be mapped: " + std::strerror(errno),
+                              __LINE__, __FUNCTION__, __FILE__);
+                    }
+                    pSegment = (unsigned char*)segmentPtr;
+                    // Fill header (ftruncate zero-initializes the segment, so all slot sequences start at 0)
+                    auto* headerPtr = reinterpret_cast<OpShmHeader*>(pSegment);
+                    headerPtr->magic = OP_SHM_MAGIC;
+                    headerPtr->version = OP_SHM_VERSION;
+                    headerPtr->headerSize = (uint32_t)sizeof(OpShmHeader);
+                    headerPtr->slotHeaderSize = (uint32_t)sizeof(OpShmSlotHeader);
+                    headerPtr->numberSlots = (uint32_t)mNumberSlots;
+                    headerPtr->slotSize = mSlotSize;
+                    headerPtr->slotsOffset = slotsOffset;
+                    headerPtr->writeCounter = 0ull;
+                    headerPtr->writerPid = (int64_t)getpid();
+                    __atomic_store_n(&headerPtr->state, OP_SHM_STATE_RUNNING, __ATOMIC_RELEASE);
+                    opLog("Shared memory `" + mName + "` created (" + std::to_string(mNumberSlots) + " slots of "
+                          + std::to_string(mSlotSize) + " bytes).", Priority::High);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+        #endif
+    };
+
+    SharedMemorySender::SharedMemorySender(
+        const std::string& sharedMemoryName, const bool sendImage, const int numberSlots, const int maximumPeople) :
+        spImpl{new ImplSharedMemorySender{sharedMemoryName, sendImage, numberSlots, maximumPeople}}
+    {
+        try
+        {
+            #ifdef _WIN32
+                error("Shared memory output (`--write_shared_memory`) is only available on POSIX systems (Ubuntu"
+                      " and Mac OSX).", __LINE__, __FUNCTION__, __FILE__);
+            #endif
+            // Sanity checks
+            if (sharedMemoryName.empty() || sharedMemoryName == "/")
+                error("The shared memory name cannot be empty.", __LINE__, __FUNCTION__, __FILE__);
+            // 1 slot would always be the one being overwritten, so readers could never read the latest frame safely
+            if (numberSlots < 2)
+                error("The number of shared memory slots must be at least 2.", __LINE__, __FUNCTION__, __FILE__);
+            if (maximumPeople < 1)
+                error("The maximum number of people must be at least 1.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    SharedMemorySender::~SharedMemorySender()
+    {
+    }
+
+    void SharedMemorySender::send(const Datum& datum)
+    {
+        #ifndef _WIN32
+            try
+            {
+                // Image to send (only 8-bit images)
+                const auto& image = datum.cvOutputData;
+                const auto sendImage = spImpl->mSendImage && !image.empty() && image.elemSize1() == 1;
+                const auto imageBytes = (sendImage
+                    ? (unsigned long long)image.rows() * image.cols() * image.channels() : 0ull);
+                // Lazy initialization (so the slot size can include the output image)
+                if (spImpl->pSegment == nullptr)
+                    spImpl->createSegment(alignTo8(imageBytes));
+                // Array sizes
+                const auto& poseKeypoints = datum.poseKeypoints;
+                const auto& faceKeypoints = datum.faceKeypoints;
+                const auto& handKeypoints = datum.handKeypoints;
+                const auto numberPeople = (unsigned long long)fastMax(fastMax(
+                    (poseKeypoints.empty() ? 0 : poseKeypoints.getSize(0)),
+                    (faceKeypoints.empty() ? 0 : faceKeypoints.getSize(0))),
+                    (handKeypoints[0].empty() ? 0 : handKeypoints[0].getSize(0)));
+                // Arrays with a different number of people than the rest are not sent
+                const auto sendPose = hasPeople(poseKeypoints, numberPeople);
+                const auto sendIds = sendPose && hasPeople(datum.poseIds, numberPeople);
+                const auto sendScores = sendPose && hasPeople(datum.poseScores, numberPeople);
+                const auto sendFace = hasPeople(faceKeypoints, numberPeople);
+                const auto sendHands = hasPeople(handKeypoints[0], numberPeople)
+                    && hasPeople(handKeypoints[1], numberPeople)
+                    && handKeypoints[0].getSize(1) == handKeypoints[1].getSize(1);
+                const auto numberBodyParts = (sendPose ? (unsigned long long)poseKeypoints.getSize(1) : 0ull);
+                const auto numberFaceParts = (sendFace ? (unsigned long long)faceKeypoints.getSize(1) : 0ull);
+                const auto numberHandParts = (sendHands ? (unsigned long long)handKeypoints[0].getSize(1) : 0ull);
+                // Fit frame into slot: drop image first, and then people if still needed
+                const auto capacity = spImpl->mSlotSize - sizeof(OpShmSlotHeader);
+                auto truncated = false;
+                auto sendImageFits = sendImage;
+                auto numberPeopleSent = numberPeople;
+                if (getKeypointsPayloadSize(numberPeople, numberBodyParts, numberFaceParts, numberHandParts)
+                    + alignTo8(imageBytes) > capacity)
+                {
+                    truncated = true;
+                    sendImageFits = false;
+                    while (numberPeopleSent > 0 && getKeypointsPayloadSize(
+                        numberPeopleSent, numberBodyParts, numberFaceParts, numberHandParts) > capacity)
+                        numberPeopleSent--;
+                }
+                // Get slot
+                auto* headerPtr = reinterpret_cast<OpShmHeader*>(spImpl->pSegment);
+                auto* slotPtr = spImpl->pSegment + headerPtr->slotsOffset
+                    + (spImpl->mFrameCounter % spImpl->mNumberSlots) * spImpl->mSlotSize;
+                auto* slotHeaderPtr = reinterpret_cast<OpShmSlotHeader*>(slotPtr);
+                // Sequence lock: odd while writing
+                const auto sequence = __atomic_load_n(&slotHeaderPtr->sequence, __ATOMIC_RELAXED);
+                __atomic_store_n(&slotHeaderPtr->sequence, sequence + 1, __ATOMIC_RELAXED);
+                __atomic_thread_fence(__ATOMIC_RELEASE);
+                // Slot header
+                slotHeaderPtr->frameCounter = spImpl->mFrameCounter;
+                slotHeaderPtr->id = datum.id;
+                slotHeaderPtr->subId = datum.subId;
+                slotHeaderPtr->subIdMax = datum.subIdMax;
+                slotHeaderPtr->frameNumber = datum.frameNumber;
+                slotHeaderPtr->timestampNs = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+                slotHeaderPtr->flags = (sendIds ? OP_SHM_FLAG_POSE_IDS : 0u)
+                                     | (sendScores ? OP_SHM_FLAG_POSE_SCORES : 0u)
+                                     | (sendImageFits ? OP_SHM_FLAG_IMAGE : 0u)
+                                     | (truncated ? OP_SHM_FLAG_TRUNCATED : 0u);
+                slotHeaderPtr->numberPeople = (uint32_t)numberPeopleSent;
+                slotHeaderPtr->numberBodyParts = (uint32_t)numberBodyParts;
+                slotHeaderPtr->numberFaceParts = (uint32_t)numberFaceParts;
+                slotHeaderPtr->numberHandParts = (uint32_t)numberHandParts;
+                slotHeaderPtr->imageRows = (uint32_t)(sendImageFits ? image.rows() : 0);
+                slotHeaderPtr->imageCols = (uint32_t)(sendImageFits ? image.cols() : 0);
+                slotHeaderPtr->imageChannels = (uint32_t)(sendImageFits ? image.channels() : 0);
+                // Payload
+                auto offset = (unsigned long long)sizeof(OpShmSlotHeader);
+                slotHeaderPtr->poseKeypointsOffset = offset;
+                if (sendPose)
+                    offset += copyPeople(slotPtr + offset, poseKeypoints, numberPeopleSent);
+                slotHeaderPtr->poseIdsOffset = offset;
+                if (sendIds)
+                    offset += copyPeople(slotPtr + offset, datum.poseIds, numberPeopleSent);
+                slotHeaderPtr->poseScoresOffset = offset;
+                if (sendScores)
+                    offset += copyPeople(slotPtr + offset, datum.poseScores, numberPeopleSent);
+                slotHeaderPtr->faceKeypointsOffset = offset;
+                if (sendFace)
+                    offset += copyPeople(slotPtr + offset, faceKeypoints, numberPeopleSent);
+                slotHeaderPtr->handKeypointsOffset = offset;
+                if (sendHands)
+                {
+                    // Left and right hands contiguous
+                    const auto handBytes = numberPeopleSent * numberHandParts * 3 * sizeof(float);
+                    std::memcpy(slotPtr + offset, handKeypoints[0].getConstPtr(), handBytes);
+                    std::memcpy(slotPtr + offset + handBytes, handKeypoints[1].getConstPtr(), handBytes);
+                    offset += alignTo8(2 * handBytes);
+                }
+                slotHeaderPtr->imageOffset = offset;
+                if (sendImageFits)
+                {
+                    // Row by row in case it is not continuous
+                    const auto rowBytes = (size_t)image.cols() * image.channels();
+                    const auto stepBytes = image.step1() * image.elemSize1();
+                    const auto* imagePtr = image.dataConst();
+                    for (auto row = 0 ; row < image.rows() ; row++)
+                        std::memcpy(slotPtr + offset + row * rowBytes, imagePtr + row * stepBytes, rowBytes);
+                    offset += alignTo8(imageBytes);
+                }
+                slotHeaderPtr->payloadSize = offset - sizeof(OpShmSlotHeader);
+                // Sequence lock: even once the slot is stable, then publish it
+                __atomic_store_n(&slotHeaderPtr->sequence, sequence + 2, __ATOMIC_RELEASE);
+                spImpl->mFrameCounter++;
+                __atomic_store_n(&headerPtr->writeCounter, spImpl->mFrameCounter, __ATOMIC_RELEASE);
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        #else
+            UNUSED(datum);
+        #endif
+    }
+}
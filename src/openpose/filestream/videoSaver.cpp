@@ -1,13 +1,49 @@
 #include <openpose/filestream/videoSaver.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
 #include <opencv2/highgui/highgui.hpp> // cv::VideoWriter
 #include <openpose/filestream/imageSaver.hpp>
+#include <openpose/utilities/fastMath.hpp>
 #include <openpose/utilities/fileSystem.hpp>
+#include <openpose/utilities/profiler.hpp>
 #include <openpose/utilities/string.hpp>
+#include <openpose_private/utilities/openCvPrivate.hpp>
 
 namespace op
 {
     const auto RANDOM_TEXT = "_r8904530ijyiopf9034jiop4g90j0yh795640h38j";
 
+    cv::VideoWriter openVideo(const std::string& videoSaverPath, const int cvFourcc, const double fps,
+                              const Point<int>& cvSize)
+    {
+        try
+        {
+            // Open video
+            const cv::VideoWriter videoWriter{
+                videoSaverPath, cvFourcc, fps, cv::Size{cvSize.x, cvSize.y}};
+            // Check it was successfully opened
+            if (!videoWriter.isOpened())
+            {
+                const std::string errorMessage{
+                    "Video to write frames could not be opened as `" + videoSaverPath + "`. Please, check that:"
+                    "\n\t1. The path ends in `.avi`.\n\t2. The parent folder exists.\n\t3. OpenCV is properly"
+                    " compiled with the FFmpeg codecs in order to save video."
+                    "\n\t4. You are not saving in a protected folder. If you desire to save a video in a"
+                    " protected folder, use sudo (Ubuntu) or execute the binary file as administrator (Windows)."};
+                error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+            }
+            // Return video
+            return videoWriter;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return cv::VideoWriter{};
+        }
+    }
+
     struct VideoSaver::ImplVideoSaver
     {
         const std::string mVideoSaverPath;
@@ -15,22 +51,45 @@ namespace op
         const double mFps;
         const std::string mAddAudioFromThisVideo;
         const bool mUseFfmpeg;
+        const int mAsyncQueueSize;
+        const bool mAsyncDropFrames;
         Point<int> mCvSize;
         bool mVideoStarted;
         unsigned long long mImageSaverCounter;
         cv::VideoWriter mVideoWriter;
         std::unique_ptr<ImageSaver> upImageSaver;
         std::string mTempImageFolder;
+        // Asynchronous encoding
+        std::queue<cv::Mat> mFrameQueue;
+        std::mutex mQueueMutex;
+        std::condition_variable mConditionFrameAdded;
+        std::condition_variable mConditionFrameRemoved;
+        bool mCloseThread;
+        std::thread mEncoderThread;
+        std::string mEncoderError;
+        // Encoder stats
+        unsigned long long mEncodedFrames;
+        unsigned long long mDroppedFrames;
+        unsigned long long mQueueHighWater;
+        double mEncodingSeconds;
 
         ImplVideoSaver(const std::string& videoSaverPath, const int cvFourcc, const double fps,
-                       const std::string& addAudioFromThisVideo) :
+                       const std::string& addAudioFromThisVideo, const int asyncQueueSize,
+                       const bool asyncDropFrames) :
             mVideoSaverPath{videoSaverPath},
             mCvFourcc{cvFourcc},
             mFps{fps},
             mAddAudioFromThisVideo{addAudioFromThisVideo},
             mUseFfmpeg{toLower(getFileExtension(videoSaverPath)) == "mp4"},
+            mAsyncQueueSize{asyncQueueSize},
+            mAsyncDropFrames{asyncDropFrames},
             mVideoStarted{false},
-            mImageSaverCounter{0ull}
+            mImageSaverCounter{0ull},
+            mCloseThread{false},
+            mEncodedFrames{0ull},
+            mDroppedFrames{0ull},
+            mQueueHighWater{0ull},
+            mEncodingSeconds{0.}
         {
             try
             {
@@ -42,40 +101,180 @@ namespace op
                 error(e.what(), __LINE__, __FUNCTION__, __FILE__);
             }
         }
-    };
 
-    cv::VideoWriter openVideo(const std::string& videoSaverPath, const int cvFourcc, const double fps,
-                              const Point<int>& cvSize)
-    {
-        try
+        bool isOpened() const
         {
-            // Open video
-            const cv::VideoWriter videoWriter{
-                videoSaverPath, cvFourcc, fps, cv::Size{cvSize.x, cvSize.y}};
-            // Check it was successfully opened
-            if (!videoWriter.isOpened())
+            try
             {
-                const std::string errorMessage{
-                    "Video to write frames could not be opened as `" + videoSaverPath + "`. Please, check that:"
-                    "\n\t1. The path ends in `.avi`.\n\t2. The parent folder exists.\n\t3. OpenCV is properly"
-                    " compiled with the FFmpeg codecs in order to save video."
-                    "\n\t4. You are not saving in a protected folder. If you desire to save a video in a"
-                    " protected folder, use sudo (Ubuntu) or execute the binary file as administrator (Windows)."};
-                error(errorMessage, __LINE__, __FUNCTION__, __FILE__);
+                // FFmpeg video
+                if (mUseFfmpeg)
+                    return (upImageSaver != nullptr);
+                // OpenCV video
+                else
+                    return mVideoWriter.isOpened();
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return false;
             }
-            // Return video
-            return videoWriter;
         }
-        catch (const std::exception& e)
+
+        // Called from write() (synchronous mode) or from the encoder thread (asynchronous mode)
+        void encodeFrame(const cv::Mat& cvOutputData)
         {
-            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
-            return cv::VideoWriter{};
+            try
+            {
+                const auto timerInit = getTimerInit();
+                // Open video (1st frame)
+                // Done here and not in the constructor to handle cases where the resolution is not known (e.g.,
+                // reading images or multiple cameras)
+                if (!mVideoStarted)
+                {
+                    mVideoStarted = true;
+                    mCvSize = Point<int>{cvOutputData.cols, cvOutputData.rows};
+                    // FFmpeg video
+                    if (mUseFfmpeg)
+                    {
+                        opLog("Temporarily saving video frames as JPG images in: " + mTempImageFolder,
+                            op::Priority::High);
+                        upImageSaver.reset(new ImageSaver{mTempImageFolder, "jpg"});
+                    }
+                    // OpenCV video
+                    else
+                        mVideoWriter = openVideo(mVideoSaverPath, mCvFourcc, mFps, mCvSize);
+                }
+                // Sanity check
+                if (!isOpened())
+                    error("Video to write frames is not opened.", __LINE__, __FUNCTION__, __FILE__);
+                // Sanity check
+                if (mCvSize.x != cvOutputData.cols || mCvSize.y != cvOutputData.rows)
+                    error("You selected to write video (`--write_video`), but the frames to be saved have different"
+                          " resolution. You can only save frames with the same resolution.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Save concatenated image
+                // FFmpeg video
+                if (mUseFfmpeg)
+                {
+                    const auto opMat = OP_CV2OPMAT(cvOutputData);
+                    upImageSaver->saveImages(opMat, toFixedLengthString(mImageSaverCounter, 12u));
+                    mImageSaverCounter++;
+                }
+                // OpenCV video
+                else
+                    mVideoWriter.write(cvOutputData);
+                // Stats
+                mEncodingSeconds += getTimeSeconds(timerInit);
+                mEncodedFrames++;
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        void encoderThread()
+        {
+            // No error() calls in here: an exception thrown on this thread would terminate the program, so it is
+            // saved and re-thrown in the next write() (or logged by the destructor)
+            try
+            {
+                while (true)
+                {
+                    cv::Mat cvOutputData;
+                    {
+                        std::unique_lock<std::mutex> lock{mQueueMutex};
+                        mConditionFrameAdded.wait(lock, [this]{ return mCloseThread || !mFrameQueue.empty(); });
+                        // Closing and all the remaining frames already encoded
+                        if (mFrameQueue.empty())
+                            break;
+                        cvOutputData = mFrameQueue.front();
+                        mFrameQueue.pop();
+                    }
+                    mConditionFrameRemoved.notify_one();
+                    encodeFrame(cvOutputData);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                std::lock_guard<std::mutex> lock{mQueueMutex};
+                mEncoderError = e.what();
+                // Release any frame waiting for (or in) the queue
+                mFrameQueue = std::queue<cv::Mat>{};
+                mConditionFrameRemoved.notify_all();
+            }
+        }
+
+        void pushFrame(const cv::Mat& cvOutputData)
+        {
+            try
+            {
+                std::unique_lock<std::mutex> lock{mQueueMutex};
+                if (!mEncoderError.empty())
+                    error("Video encoder thread failed: " + mEncoderError, __LINE__, __FUNCTION__, __FILE__);
+                // Queue full
+                if (mFrameQueue.size() >= (size_t)mAsyncQueueSize)
+                {
+                    // Drop frame
+                    if (mAsyncDropFrames)
+                    {
+                        mDroppedFrames++;
+                        return;
+                    }
+                    // Or block until the encoder releases a slot
+                    mConditionFrameRemoved.wait(
+                        lock, [this]{ return mFrameQueue.size() < (size_t)mAsyncQueueSize || !mEncoderError.empty(); });
+                    if (!mEncoderError.empty())
+                        error("Video encoder thread failed: " + mEncoderError, __LINE__, __FUNCTION__, __FILE__);
+                }
+                mFrameQueue.push(cvOutputData);
+                mQueueHighWater = fastMax(mQueueHighWater, (unsigned long long)mFrameQueue.size());
+                lock.unlock();
+                mConditionFrameAdded.notify_one();
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
         }
-    }
+
+        void closeEncoderThread()
+        {
+            try
+            {
+                if (mEncoderThread.joinable())
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{mQueueMutex};
+                        mCloseThread = true;
+                    }
+                    mConditionFrameAdded.notify_one();
+                    // Remaining queued frames are encoded before the thread finishes
+                    mEncoderThread.join();
+                    // Stats
+                    const auto encodedFrames = fastMax(1ull, mEncodedFrames);
+                    opLog("Video " + mVideoSaverPath + " asynchronously encoded " + std::to_string(mEncodedFrames)
+                          + " frames (" + std::to_string(mDroppedFrames) + " dropped) at "
+                          + std::to_string(1e3*mEncodingSeconds/encodedFrames) + " ms/frame ("
+                          + std::to_string(mEncodingSeconds > 0. ? mEncodedFrames/mEncodingSeconds : 0.)
+                          + " encoder FPS), maximum queue size " + std::to_string(mQueueHighWater) + "/"
+                          + std::to_string(mAsyncQueueSize) + ".", Priority::High);
+                    if (!mEncoderError.empty())
+                        opLog("Video encoder thread failed: " + mEncoderError, Priority::High);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+    };
 
     VideoSaver::VideoSaver(const std::string& videoSaverPath, const int cvFourcc, const double fps,
-                           const std::string& addAudioFromThisVideo) :
-        upImpl{new ImplVideoSaver{videoSaverPath, cvFourcc, fps, addAudioFromThisVideo}}
+                           const std::string& addAudioFromThisVideo, const int asyncQueueSize,
+                           const bool asyncDropFrames) :
+        upImpl{new ImplVideoSaver{videoSaverPath, cvFourcc, fps, addAudioFromThisVideo, asyncQueueSize,
+                                  asyncDropFrames}}
     {
         try
         {
@@ -95,6 +294,11 @@ namespace op
                 error("In order to save the video with audio, it must be in MP4 format. So either 1) do not set"
                       " `--write_video_audio` or 2) make sure `--write_video` finishes in `.mp4`.",
                       __LINE__, __FUNCTION__, __FILE__);
+            if (asyncQueueSize < 0)
+                error("The asynchronous video encoding queue size must be >= 0.", __LINE__, __FUNCTION__, __FILE__);
+            // Start encoder thread
+            if (asyncQueueSize > 0)
+                upImpl->mEncoderThread = std::thread{&ImplVideoSaver::encoderThread, upImpl.get()};
         }
         catch (const std::exception& e)
         {
@@ -106,6 +310,8 @@ namespace op
     {
         try
         {
+            // Encode the remaining queued frames and close the encoder thread
+            upImpl->closeEncoderThread();
             // Images --> Video
             if (upImpl->mUseFfmpeg)
             {
@@ -162,12 +368,13 @@ namespace op
     {
         try
         {
-            // FFmpeg video
-            if (upImpl->mUseFfmpeg)
-                return (upImpl->upImageSaver != nullptr);
-            // OpenCV video
-            else
-                return upImpl->mVideoWriter.isOpened();
+            // Asynchronous mode: the video is opened by the encoder thread with the 1st frame
+            if (upImpl->mAsyncQueueSize > 0)
+            {
+                std::lock_guard<std::mutex> lock{upImpl->mQueueMutex};
+                return upImpl->mEncoderError.empty();
+            }
+            return upImpl->isOpened();
         }
         catch (const std::exception& e)
         {
@@ -199,51 +406,21 @@ namespace op
             for (const auto& cvMat : cvMats)
                 if (cvMat.empty())
                     error("The image(s) to be saved cannot be empty.", __LINE__, __FUNCTION__, __FILE__);
-            // Open video (1st frame)
-            // Done here and not in the constructor to handle cases where the resolution is not known (e.g.,
-            // reading images or multiple cameras)
-            if (!upImpl->mVideoStarted)
-            {
-                upImpl->mVideoStarted = true;
-                const auto cvSize = cvMats.at(0).size();
-                upImpl->mCvSize = Point<int>{(int)cvMats.size()*cvSize.width, cvSize.height};
-                // FFmpeg video
-                if (upImpl->mUseFfmpeg)
-                {
-                    opLog("Temporarily saving video frames as JPG images in: " + upImpl->mTempImageFolder,
-                        op::Priority::High);
-                    upImpl->upImageSaver.reset(new ImageSaver{upImpl->mTempImageFolder, "jpg"});
-                }
-                // OpenCV video
-                else
-                    upImpl->mVideoWriter = openVideo(
-                        upImpl->mVideoSaverPath, upImpl->mCvFourcc, upImpl->mFps, upImpl->mCvSize);
-            }
-            // Sanity check
-            if (!isOpened())
-                error("Video to write frames is not opened.", __LINE__, __FUNCTION__, __FILE__);
-            // Concat images
+            // Concat images (views with a different height, e.g., streams of different resolution, are resized)
             cv::Mat cvOutputData;
             if (cvMats.size() > 1)
-                cv::hconcat(cvMats.data(), cvMats.size(), cvOutputData);
+                hconcatViews(cvOutputData, cvMats);
+            // Asynchronous mode: The frame memory must not be shared with the Datum (it might be modified after
+            // this call), so single images are cloned (the concatenation above already copies them)
+            else if (upImpl->mAsyncQueueSize > 0)
+                cvOutputData = cvMats.at(0).clone();
             else
                 cvOutputData = cvMats.at(0);
-            // Sanity check
-            if (upImpl->mCvSize.x != cvOutputData.cols || upImpl->mCvSize.y != cvOutputData.rows)
-                error("You selected to write video (`--write_video`), but the frames to be saved have different"
-                      " resolution. You can only save frames with the same resolution.",
-                      __LINE__, __FUNCTION__, __FILE__);
             // Save concatenated image
-            // FFmpeg video
-            if (upImpl->mUseFfmpeg)
-            {
-                const auto opMat = OP_CV2OPMAT(cvOutputData);
-                upImpl->upImageSaver->saveImages(opMat, toFixedLengthString(upImpl->mImageSaverCounter, 12u));
-                upImpl->mImageSaverCounter++;
-            }
-            // OpenCV video
+            if (upImpl->mAsyncQueueSize > 0)
+                upImpl->pushFrame(cvOutputData);
             else
-                upImpl->mVideoWriter.write(cvOutputData);
+                upImpl->encodeFrame(cvOutputData);
         }
         catch (const std::exception& e)
         {
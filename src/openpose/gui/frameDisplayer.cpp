@@ -1,5 +1,6 @@
 #include <openpose/gui/frameDisplayer.hpp>
  #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+#include <openpose_private/utilities/openCvPrivate.hpp>
 
 namespace op
 {
@@ -133,16 +134,11 @@ namespace op
             else
             {
                 // Prepare final cvMat
-                // Concat (0)
-                Matrix opMat = frames[0].clone();
-                cv::Mat cvMat = OP_OP2CVMAT(opMat);
-                // Concat (1,size()-1)
-                for (auto i = 1u; i < frames.size(); i++)
-                {
-                    const cv::Mat framesI = OP_OP2CVCONSTMAT(frames[i]);
-                    cv::hconcat(cvMat, framesI, cvMat);
-                }
-                opMat = OP_CV2OPMAT(cvMat);
+                // Concat (views with a different height, e.g., streams of different resolution, are resized)
+                OP_OP2CVVECTORMAT(cvMats, frames);
+                cv::Mat cvMat;
+                hconcatViews(cvMat, cvMats);
+                Matrix opMat = OP_CV2OPMAT(cvMat);
                 // Display it
                 displayFrame(opMat, waitKeyValue);
             }
@@ -18,6 +18,7 @@ namespace op
     {
         #ifdef USE_CAFFE
             bool mNetInitialized;
+            bool mResizeHeatMaps;
             const int mGpuId;
             std::shared_ptr<NetCaffe> spNetCaffe;
             std::shared_ptr<ResizeAndMergeCaffe<float>> spResizeAndMergeCaffe;
@@ -28,11 +29,13 @@ namespace op
             std::shared_ptr<ArrayCpuGpu<float>> spPeaksBlob;
 
             ImplHandExtractorCaffe(const std::string& modelFolder, const int gpuId,
-                                   const bool enableGoogleLogging) :
+                                   const bool enableGoogleLogging, const std::string& weightCacheFolder) :
                 mNetInitialized{false},
+                mResizeHeatMaps{true},
                 mGpuId{gpuId},
                 spNetCaffe{std::make_shared<NetCaffe>(modelFolder + HAND_PROTOTXT, modelFolder + HAND_TRAINED_MODEL,
-                                                      gpuId, enableGoogleLogging)},
+                                                      gpuId, enableGoogleLogging, "net_output", 1u,
+                                                      weightCacheFolder)},
                 spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
                 spMaximumCaffe{std::make_shared<MaximumCaffe<float>>()}
             {
@@ -166,18 +169,24 @@ namespace op
                                               std::shared_ptr<ArrayCpuGpu<float>>& caffeNetOutputBlob,
                                               std::shared_ptr<ArrayCpuGpu<float>>& heatMapsBlob,
                                               std::shared_ptr<ArrayCpuGpu<float>>& peaksBlob,
-                                              const int gpuID)
+                                              const bool resizeHeatMaps, const int gpuID)
         {
             try
             {
-                // HeatMaps extractor blob and layer
-                const bool mergeFirstDimension = true;
-                resizeAndMergeCaffe->Reshape(
-                    std::vector<ArrayCpuGpu<float>*>{caffeNetOutputBlob.get()},
-                    std::vector<ArrayCpuGpu<float>*>{heatMapsBlob.get()},
-                    HAND_CCN_DECREASE_FACTOR, 1.f, mergeFirstDimension, gpuID);
-                // Pose extractor blob and layer
-                maximumCaffe->Reshape({heatMapsBlob.get()}, {peaksBlob.get()});
+                if (resizeHeatMaps)
+                {
+                    // HeatMaps extractor blob and layer
+                    const bool mergeFirstDimension = true;
+                    resizeAndMergeCaffe->Reshape(
+                        std::vector<ArrayCpuGpu<float>*>{caffeNetOutputBlob.get()},
+                        std::vector<ArrayCpuGpu<float>*>{heatMapsBlob.get()},
+                        HAND_CCN_DECREASE_FACTOR, 1.f, mergeFirstDimension, gpuID);
+                    // Pose extractor blob and layer
+                    maximumCaffe->Reshape({heatMapsBlob.get()}, {peaksBlob.get()});
+                }
+                // Peaks directly from the net output (no heat maps resize)
+                else
+                    maximumCaffe->Reshape({caffeNetOutputBlob.get()}, {peaksBlob.get()}, HAND_CCN_DECREASE_FACTOR);
                 // Cuda check
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
@@ -193,7 +202,8 @@ namespace op
             Array<float>& handCurrent, std::shared_ptr<NetCaffe>& netCaffe, std::shared_ptr<ResizeAndMergeCaffe<float>>& resizeAndMergeCaffe,
             std::shared_ptr<MaximumCaffe<float>>& maximumCaffe, std::shared_ptr<ArrayCpuGpu<float>>& caffeNetOutputBlob,
             std::shared_ptr<ArrayCpuGpu<float>>& heatMapsBlob, std::shared_ptr<ArrayCpuGpu<float>>& peaksBlob, bool& netInitialized,
-            Array<float>& handImageCrop, const int person, const cv::Mat& affineMatrix, const int gpuId)
+            Array<float>& handImageCrop, const int person, const cv::Mat& affineMatrix, const bool resizeHeatMaps,
+            const int gpuId)
         {
             try
             {
@@ -206,14 +216,21 @@ namespace op
                     {
                         netInitialized = true;
                         reshapeHandExtractorCaffe(
-                            resizeAndMergeCaffe, maximumCaffe, caffeNetOutputBlob, heatMapsBlob, peaksBlob, gpuId);
+                            resizeAndMergeCaffe, maximumCaffe, caffeNetOutputBlob, heatMapsBlob, peaksBlob,
+                            resizeHeatMaps, gpuId);
                     }
 
-                    // 2. Resize heat maps + merge different scales
-                    resizeAndMergeCaffe->Forward({caffeNetOutputBlob.get()}, {heatMapsBlob.get()});
+                    if (resizeHeatMaps)
+                    {
+                        // 2. Resize heat maps + merge different scales
+                        resizeAndMergeCaffe->Forward({caffeNetOutputBlob.get()}, {heatMapsBlob.get()});
 
-                    // 3. Get peaks by Non-Maximum Suppression
-                    maximumCaffe->Forward({heatMapsBlob.get()}, {peaksBlob.get()});
+                        // 3. Get peaks by Non-Maximum Suppression
+                        maximumCaffe->Forward({heatMapsBlob.get()}, {peaksBlob.get()});
+                    }
+                    // 2-3. Get peaks from the net output
+                    else
+                        maximumCaffe->Forward({caffeNetOutputBlob.get()}, {peaksBlob.get()});
 
                     // Estimate keypoint locations
                     connectKeypoints(
@@ -227,6 +244,7 @@ namespace op
                     UNUSED(handCurrent);
                     UNUSED(person);
                     UNUSED(affineMatrix);
+                    UNUSED(resizeHeatMaps);
                 #endif
             }
             catch (const std::exception& e)
@@ -241,10 +259,12 @@ namespace op
                                            const int numberScales,
                                            const float rangeScales, const std::vector<HeatMapType>& heatMapTypes,
                                            const ScaleMode heatMapScaleMode,
-                                           const bool enableGoogleLogging) :
-        HandExtractorNet{netInputSize, netOutputSize, numberScales, rangeScales, heatMapTypes, heatMapScaleMode}
+                                           const bool enableGoogleLogging, const int reuseFrames,
+                                           const std::string& weightCacheFolder) :
+        HandExtractorNet{netInputSize, netOutputSize, numberScales, rangeScales, heatMapTypes, heatMapScaleMode,
+                         reuseFrames}
         #ifdef USE_CAFFE
-        , upImpl{new ImplHandExtractorCaffe{modelFolder, gpuId, enableGoogleLogging}}
+        , upImpl{new ImplHandExtractorCaffe{modelFolder, gpuId, enableGoogleLogging, weightCacheFolder}}
         #endif
     {
         try
@@ -259,6 +279,7 @@ namespace op
                 UNUSED(heatMapTypes);
                 UNUSED(heatMapScaleMode);
                 UNUSED(enableGoogleLogging);
+                UNUSED(weightCacheFolder);
                 error("OpenPose must be compiled with the `USE_CAFFE` & `USE_CUDA` macro definitions in order to run"
                       " this functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -289,6 +310,13 @@ namespace op
                 upImpl->spCaffeNetOutputBlob = upImpl->spNetCaffe->getOutputBlobArray();
                 upImpl->spHeatMapsBlob = {std::make_shared<ArrayCpuGpu<float>>(1,1,1,1)};
                 upImpl->spPeaksBlob = {std::make_shared<ArrayCpuGpu<float>>(1,1,1,1)};
+                // CPU: Heat maps only resized if they must be returned, otherwise the peaks are directly found (with
+                // subpixel accuracy) on the net output
+                #ifdef USE_CUDA
+                    upImpl->mResizeHeatMaps = true;
+                #else
+                    upImpl->mResizeHeatMaps = !mHeatMapTypes.empty();
+                #endif
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
@@ -308,6 +336,11 @@ namespace op
         try
         {
             #ifdef USE_CAFFE
+                // Keypoint re-use: new frame
+                for (auto& spKeypointStabilityCache : spKeypointStabilityCaches)
+                    if (spKeypointStabilityCache != nullptr)
+                        spKeypointStabilityCache->newFrame();
+
                 if (mEnabled && !handRectangles.empty())
                 {
                     const cv::Mat cvInputData = OP_OP2CVCONSTMAT(inputData);
@@ -378,12 +411,25 @@ namespace op
                                     // Resize image to hands positions + cv::Mat -> float*
                                     cropFrame(mHandImageCrop, affineMatrix, cvInputData, handRectangle, netInputSide,
                                               mNetOutputSize, mirrorImage);
+                                    // Still hand: re-use its previous keypoints rather than running the network
+                                    const auto& spKeypointStabilityCache = spKeypointStabilityCaches[hand];
+                                    auto* const handKeypointsPtr = handCurrent.getPtr()
+                                                                 + person * handCurrent.getVolume(1,2);
+                                    if (spKeypointStabilityCache != nullptr
+                                        && spKeypointStabilityCache->reuse(
+                                            handKeypointsPtr, handCurrent.getSize(1), handRectangle, mHandImageCrop))
+                                        continue;
                                     // Deep net + Estimate keypoint locations
                                     detectHandKeypoints(
                                         handCurrent, upImpl->spNetCaffe, upImpl->spResizeAndMergeCaffe,
                                         upImpl->spMaximumCaffe, upImpl->spCaffeNetOutputBlob,
                                         upImpl->spHeatMapsBlob, upImpl->spPeaksBlob, upImpl->mNetInitialized,
-                                        mHandImageCrop, person, affineMatrix, upImpl->mGpuId);
+                                        mHandImageCrop, person, affineMatrix,
+                                        upImpl->mResizeHeatMaps, upImpl->mGpuId);
+                                    // Keypoint re-use: cache new keypoints
+                                    if (spKeypointStabilityCache != nullptr)
+                                        spKeypointStabilityCache->update(
+                                            handKeypointsPtr, handCurrent.getSize(1), handRectangle, mHandImageCrop);
                                 }
                                 // Multi-scale detection
                                 else
@@ -424,7 +470,8 @@ namespace op
                                             handEstimated, upImpl->spNetCaffe, upImpl->spResizeAndMergeCaffe,
                                             upImpl->spMaximumCaffe, upImpl->spCaffeNetOutputBlob,
                                             upImpl->spHeatMapsBlob, upImpl->spPeaksBlob, upImpl->mNetInitialized,
-                                            mHandImageCrop, 0, affineMatrix, upImpl->mGpuId);
+                                            mHandImageCrop, 0, affineMatrix,
+                                            upImpl->mResizeHeatMaps, upImpl->mGpuId);
                                         if (i == 0
                                             || getAverageScore(handEstimated,0) > getAverageScore(handCurrent,person))
                                             std::copy(handEstimated.getConstPtr(),
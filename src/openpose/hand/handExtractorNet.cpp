@@ -6,7 +6,7 @@ namespace op
     HandExtractorNet::HandExtractorNet(const Point<int>& netInputSize, const Point<int>& netOutputSize,
                                        const int numberScales, const float rangeScales,
                                        const std::vector<HeatMapType>& heatMapTypes,
-                                       const ScaleMode heatMapScaleMode) :
+                                       const ScaleMode heatMapScaleMode, const int reuseFrames) :
         mMultiScaleNumberAndRange{std::make_pair(numberScales, rangeScales)},
         mNetOutputSize{netOutputSize},
         mHandImageCrop{{1, 3, mNetOutputSize.y, mNetOutputSize.x}},
@@ -36,6 +36,17 @@ namespace op
             if (!mHeatMapTypes.empty())
                 opLog("Note that only the keypoint heatmaps are available with hand heatmaps (no background nor PAFs).",
                     Priority::High);
+            // Keypoint re-use (heat maps are not cached, so they require the network on every frame)
+            if (reuseFrames > 0)
+            {
+                if (!mHeatMapTypes.empty())
+                    opLog("Hand keypoint re-use is disabled when hand heat maps are enabled.", Priority::High);
+                else if (numberScales > 1)
+                    opLog("Hand keypoint re-use is disabled when several hand scales are used.", Priority::High);
+                else
+                    for (auto& spKeypointStabilityCache : spKeypointStabilityCaches)
+                        spKeypointStabilityCache = std::make_shared<KeypointStabilityCache>(reuseFrames);
+            }
         }
         catch (const std::exception& e)
         {
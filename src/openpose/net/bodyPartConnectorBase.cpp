@@ -153,12 +153,98 @@ namespace op
         }
     }
 
+    template <typename T>
+    bool getPreviousLimbsNearPeaks(
+        std::vector<std::vector<int>>& previousLimbsA, std::vector<std::vector<int>>& previousLimbsB,
+        const Array<T>& previousPoseKeypoints, const unsigned int bodyPartA, const unsigned int bodyPartB,
+        const T* const candidateAPtr, const T* const candidateBPtr, const int numberPeaksA, const int numberPeaksB,
+        const Point<int>& heatMapSize)
+    {
+        try
+        {
+            // previousLimbsA[i-1]: Previous-frame limbs (people) whose part A is close to the peak A i
+            // (same for previousLimbsB)
+            if (previousPoseKeypoints.empty() || previousPoseKeypoints.getNumberDimensions() != 3
+                || (int)fastMax(bodyPartA, bodyPartB) >= previousPoseKeypoints.getSize(1))
+                return false;
+            previousLimbsA.assign(numberPeaksA, std::vector<int>{});
+            previousLimbsB.assign(numberPeaksB, std::vector<int>{});
+            const auto numberPeople = previousPoseKeypoints.getSize(0);
+            const auto personOffset = previousPoseKeypoints.getSize(1) * previousPoseKeypoints.getSize(2);
+            // Minimum motion margin (~12 pixels for 656x368 heat maps), for short or foreshortened limbs
+            const auto minimumRadius = T(std::sqrt(heatMapSize.area()))/40;
+            auto numberPreviousLimbs = 0;
+            for (auto person = 0 ; person < numberPeople ; person++)
+            {
+                const auto* const keypointAPtr = previousPoseKeypoints.getConstPtr() + person*personOffset
+                                               + 3*bodyPartA;
+                const auto* const keypointBPtr = previousPoseKeypoints.getConstPtr() + person*personOffset
+                                               + 3*bodyPartB;
+                if (keypointAPtr[2] > 0 && keypointBPtr[2] > 0)
+                {
+                    numberPreviousLimbs++;
+                    // Each part can move up to half the limb length between consecutive frames
+                    const auto limbX = keypointBPtr[0] - keypointAPtr[0];
+                    const auto limbY = keypointBPtr[1] - keypointAPtr[1];
+                    const auto radius = fastMax(T(0.5)*T(std::sqrt(limbX*limbX + limbY*limbY)), minimumRadius);
+                    const auto radiusSquared = radius*radius;
+                    for (auto i = 1; i <= numberPeaksA; i++)
+                    {
+                        const auto distanceX = candidateAPtr[3*i] - keypointAPtr[0];
+                        const auto distanceY = candidateAPtr[3*i+1] - keypointAPtr[1];
+                        if (distanceX*distanceX + distanceY*distanceY < radiusSquared)
+                            previousLimbsA[i-1].emplace_back(person);
+                    }
+                    for (auto j = 1; j <= numberPeaksB; j++)
+                    {
+                        const auto distanceX = candidateBPtr[3*j] - keypointBPtr[0];
+                        const auto distanceY = candidateBPtr[3*j+1] - keypointBPtr[1];
+                        if (distanceX*distanceX + distanceY*distanceY < radiusSquared)
+                            previousLimbsB[j-1].emplace_back(person);
+                    }
+                }
+            }
+            return numberPreviousLimbs > 0;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    inline bool sharePreviousLimb(const std::vector<int>& previousLimbsA, const std::vector<int>& previousLimbsB)
+    {
+        try
+        {
+            // Both lists are small and sorted (by person index)
+            auto indexA = 0u;
+            auto indexB = 0u;
+            while (indexA < previousLimbsA.size() && indexB < previousLimbsB.size())
+            {
+                if (previousLimbsA[indexA] == previousLimbsB[indexB])
+                    return true;
+                else if (previousLimbsA[indexA] < previousLimbsB[indexB])
+                    indexA++;
+                else
+                    indexB++;
+            }
+            return false;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
     template <typename T>
     std::vector<std::pair<std::vector<int>, T>> createPeopleVector(
         const T* const heatMapPtr, const T* const peaksPtr, const PoseModel poseModel, const Point<int>& heatMapSize,
         const int maxPeaks, const T interThreshold, const T interMinAboveThreshold,
         const std::vector<unsigned int>& bodyPartPairs, const unsigned int numberBodyParts,
-        const unsigned int numberBodyPartPairs, const T defaultNmsThreshold, const Array<T>& pairScores)
+        const unsigned int numberBodyPartPairs, const T defaultNmsThreshold, const Array<T>& pairScores,
+        const Array<T>& previousPoseKeypoints)
     {
         try
         {
@@ -300,22 +386,66 @@ namespace op
                                          + (numberBodyPartsAndBkg + mapIdx[2*pairIndex]) * heatMapOffset;
                         const auto* mapY = heatMapPtr
                                          + (numberBodyPartsAndBkg + mapIdx[2*pairIndex+1]) * heatMapOffset;
-                        // E.g., neck-nose connection. For each neck
-                        for (auto i = 1; i <= numberPeaksA; i++)
+                        const auto addConnectionAB = [&](const int i, const int j) -> T
                         {
-                            // E.g., neck-nose connection. For each nose
-                            for (auto j = 1; j <= numberPeaksB; j++)
-                            {
-                                // Initial PAF
-                                auto scoreAB = getScoreAB(
-                                    i, j, candidateAPtr, candidateBPtr, mapX, mapY, heatMapSize, interThreshold,
-                                    interMinAboveThreshold, defaultNmsThreshold);
+                            // Initial PAF
+                            const auto scoreAB = getScoreAB(
+                                i, j, candidateAPtr, candidateBPtr, mapX, mapY, heatMapSize, interThreshold,
+                                interMinAboveThreshold, defaultNmsThreshold);
 
-                                // E.g., neck-nose connection. If possible PAF between neck i, nose j --> add
-                                // parts score + connection score
-                                if (scoreAB > 1e-6)
-                                    allABConnections.emplace_back(std::make_tuple(scoreAB, i, j));
+                            // E.g., neck-nose connection. If possible PAF between neck i, nose j --> add
+                            // parts score + connection score
+                            if (scoreAB > 1e-6)
+                                allABConnections.emplace_back(std::make_tuple(scoreAB, i, j));
+                            return scoreAB;
+                        };
+                        // Temporal warm-start: Previous-frame limbs close to each peak
+                        std::vector<std::vector<int>> previousLimbsA;
+                        std::vector<std::vector<int>> previousLimbsB;
+                        const auto useTemporalPrior = getPreviousLimbsNearPeaks(
+                            previousLimbsA, previousLimbsB, previousPoseKeypoints, bodyPartA, bodyPartB,
+                            candidateAPtr, candidateBPtr, numberPeaksA, numberPeaksB, heatMapSize);
+                        // Full scoring
+                        if (!useTemporalPrior)
+                        {
+                            // E.g., neck-nose connection. For each neck
+                            for (auto i = 1; i <= numberPeaksA; i++)
+                                // E.g., neck-nose connection. For each nose
+                                for (auto j = 1; j <= numberPeaksB; j++)
+                                    addConnectionAB(i, j);
+                        }
+                        // Temporal warm-start scoring
+                        else
+                        {
+                            // Below this PAF score, a previous pairing is no longer considered reliable
+                            const auto minimumPreviousPairingScore = T(0.5);
+                            std::vector<std::pair<int, int>> prunedPairs;
+                            auto previousPairingsReliable = true;
+                            for (auto i = 1; i <= numberPeaksA; i++)
+                            {
+                                for (auto j = 1; j <= numberPeaksB; j++)
+                                {
+                                    const auto& previousLimbsAI = previousLimbsA[i-1];
+                                    const auto& previousLimbsBJ = previousLimbsB[j-1];
+                                    // New or fast-moving peak (no close previous limb) --> no prior, scored
+                                    if (previousLimbsAI.empty() || previousLimbsBJ.empty())
+                                        addConnectionAB(i, j);
+                                    // Previous pairing --> scored, and it must be confirmed by the current PAF
+                                    else if (sharePreviousLimb(previousLimbsAI, previousLimbsBJ))
+                                    {
+                                        if (addConnectionAB(i, j) < minimumPreviousPairingScore)
+                                            previousPairingsReliable = false;
+                                    }
+                                    // Peaks following 2 different previous limbs (e.g., neck of person 1 and
+                                    // nose of person 2) --> pruned
+                                    else
+                                        prunedPairs.emplace_back(std::make_pair(i, j));
+                                }
                             }
+                            // Confidence drop (e.g., occlusion or people crossing) --> fall back to full scoring
+                            if (!previousPairingsReliable)
+                                for (const auto& prunedPair : prunedPairs)
+                                    addConnectionAB(prunedPair.first, prunedPair.second);
                         }
                     }
                     else if (!pairScores.empty())
@@ -1329,7 +1459,7 @@ namespace op
         Array<T>& poseKeypoints, Array<T>& poseScores, const T* const heatMapPtr, const T* const peaksPtr,
         const PoseModel poseModel, const Point<int>& heatMapSize, const int maxPeaks, const T interMinAboveThreshold,
         const T interThreshold, const int minSubsetCnt, const T minSubsetScore, const T defaultNmsThreshold,
-        const T scaleFactor, const bool maximizePositives)
+        const T scaleFactor, const bool maximizePositives, const Array<T>& previousPoseKeypoints)
     {
         try
         {
@@ -1346,7 +1476,8 @@ namespace op
 
             auto peopleVector = createPeopleVector(
                 heatMapPtr, peaksPtr, poseModel, heatMapSize, maxPeaks, interThreshold, interMinAboveThreshold,
-                bodyPartPairs, numberBodyParts, numberBodyPartPairs, defaultNmsThreshold);
+                bodyPartPairs, numberBodyParts, numberBodyPartPairs, defaultNmsThreshold, Array<T>{},
+                previousPoseKeypoints);
             // Delete people below the following thresholds:
                 // a) minSubsetCnt: removed if less than minSubsetCnt body parts
                 // b) minSubsetScore: removed if global score smaller than this
@@ -1381,26 +1512,28 @@ namespace op
         const float* const peaksPtr, const PoseModel poseModel, const Point<int>& heatMapSize, const int maxPeaks,
         const float interMinAboveThreshold, const float interThreshold, const int minSubsetCnt,
         const float minSubsetScore, const float defaultNmsThreshold, const float scaleFactor,
-        const bool maximizePositives);
+        const bool maximizePositives, const Array<float>& previousPoseKeypoints);
     template OP_API void connectBodyPartsCpu(
         Array<double>& poseKeypoints, Array<double>& poseScores, const double* const heatMapPtr,
         const double* const peaksPtr, const PoseModel poseModel, const Point<int>& heatMapSize, const int maxPeaks,
         const double interMinAboveThreshold, const double interThreshold, const int minSubsetCnt,
         const double minSubsetScore, const double defaultNmsThreshold, const double scaleFactor,
-        const bool maximizePositives);
+        const bool maximizePositives, const Array<double>& previousPoseKeypoints);
 
     template OP_API std::vector<std::pair<std::vector<int>, float>> createPeopleVector(
         const float* const heatMapPtr, const float* const peaksPtr, const PoseModel poseModel,
         const Point<int>& heatMapSize, const int maxPeaks, const float interThreshold,
         const float interMinAboveThreshold, const std::vector<unsigned int>& bodyPartPairs,
         const unsigned int numberBodyParts, const unsigned int numberBodyPartPairs,
-        const float defaultNmsThreshold, const Array<float>& precomputedPAFs);
+        const float defaultNmsThreshold, const Array<float>& precomputedPAFs,
+        const Array<float>& previousPoseKeypoints);
     template OP_API std::vector<std::pair<std::vector<int>, double>> createPeopleVector(
         const double* const heatMapPtr, const double* const peaksPtr, const PoseModel poseModel,
         const Point<int>& heatMapSize, const int maxPeaks, const double interThreshold,
         const double interMinAboveThreshold, const std::vector<unsigned int>& bodyPartPairs,
         const unsigned int numberBodyParts, const unsigned int numberBodyPartPairs,
-        const double defaultNmsThreshold, const Array<double>& precomputedPAFs);
+        const double defaultNmsThreshold, const Array<double>& precomputedPAFs,
+        const Array<double>& previousPoseKeypoints);
 
     template OP_API void removePeopleBelowThresholdsAndFillFaces(
         std::vector<int>& validSubsetIndexes, int& numberPeople,
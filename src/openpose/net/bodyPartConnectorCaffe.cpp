@@ -8,6 +8,7 @@
 #endif
 #include <openpose/net/bodyPartConnectorBase.hpp>
 #include <openpose/pose/poseParameters.hpp>
+#include <openpose/utilities/keypoint.hpp>
 #ifdef USE_OPENCL
     #include <openpose_private/gpu/opencl.hcl>
     #include <openpose_private/gpu/cl2.hpp>
@@ -19,6 +20,7 @@ namespace op
     BodyPartConnectorCaffe<T>::BodyPartConnectorCaffe() :
         mPoseModel{PoseModel::Size},
         mMaximizePositives{false},
+        mTemporalWarmStart{false},
         pBodyPartPairsGpuPtr{nullptr},
         pMapIdxGpuPtr{nullptr},
         pFinalOutputGpuPtr{nullptr}
@@ -86,6 +88,8 @@ namespace op
                     peaksBlob->shape(0), peaksBlob->shape(1), peaksBlob->shape(2), peaksBlob->shape(3)};
                 // GPU ID
                 mGpuID = gpuID;
+                // Temporal prior (heat map coordinates) no longer valid
+                mPreviousPoseKeypoints.reset();
             #else
                 UNUSED(bottom);
                 UNUSED(gpuID);
@@ -201,6 +205,19 @@ namespace op
         }
     }
 
+    template <typename T>
+    void BodyPartConnectorCaffe<T>::setTemporalWarmStart(const bool temporalWarmStart)
+    {
+        try
+        {
+            mTemporalWarmStart = {temporalWarmStart};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template <typename T>
     void BodyPartConnectorCaffe<T>::Forward(const std::vector<ArrayCpuGpu<T>*>& bottom, Array<T>& poseKeypoints,
                                             Array<T>& poseScores)
@@ -239,7 +256,14 @@ namespace op
                     poseKeypoints, poseScores, heatMapsPtr, peaksPtr, mPoseModel,
                     Point<int>{heatMapsBlob->shape(3), heatMapsBlob->shape(2)}, maxPeaks, mInterMinAboveThreshold,
                     mInterThreshold, mMinSubsetCnt, mMinSubsetScore, mDefaultNmsThreshold, mScaleNetToOutput,
-                    mMaximizePositives);
+                    mMaximizePositives, (mTemporalWarmStart ? mPreviousPoseKeypoints : Array<T>{}));
+                // Temporal prior for the next frame (back to heat map coordinates)
+                if (mTemporalWarmStart)
+                {
+                    poseKeypoints.copyTo(mPreviousPoseKeypoints);
+                    if (!mPreviousPoseKeypoints.empty() && mScaleNetToOutput != T(1))
+                        scaleKeypoints(mPreviousPoseKeypoints, T(1)/mScaleNetToOutput);
+                }
             #else
                 UNUSED(bottom);
                 UNUSED(poseKeypoints);
@@ -1,6 +1,9 @@
 #include <openpose/net/maximumBase.hpp>
 // #include <thrust/extrema.h>
+#include <cmath> // std::ceil, std::floor
+#include <limits> // std::numeric_limits
 #include <opencv2/core/core.hpp> // cv::Mat
+#include <openpose/utilities/fastMath.hpp>
 
 namespace op
 {
@@ -39,7 +42,8 @@ namespace op
                     {
                         auto* targetPtrOffsetted = targetPtr + (offsetChannel + part) * numberSubparts;
                         const auto* const sourcePtrOffsetted = sourcePtr + (offsetChannel + part) * imageOffset;
-                        cv::Mat source(cv::Size(width, height), CV_32FC1, const_cast<T*>(sourcePtrOffsetted));
+                        cv::Mat source(
+                            cv::Size(width, height), cv::DataType<T>::type, const_cast<T*>(sourcePtrOffsetted));
                         double minVal, maxVal;
                         cv::Point minLoc, maxLoc;
                         cv::minMaxLoc(source, &minVal, &maxVal, &minLoc, &maxLoc);
@@ -56,10 +60,147 @@ namespace op
         }
     }
 
+    // Same coefficients than cv::resize(..., CV_INTER_CUBIC)
+    template <typename T>
+    inline void getCubicCoefficients(T* coefficients, const T d)
+    {
+        const auto A = T(-0.75);
+        coefficients[0] = ((A*(d + 1) - 5*A)*(d + 1) + 8*A)*(d + 1) - 4*A;
+        coefficients[1] = ((A + 2)*d - (A + 3))*d*d + 1;
+        coefficients[2] = ((A + 2)*(1 - d) - (A + 3))*(1 - d)*(1 - d) + 1;
+        coefficients[3] = 1 - coefficients[0] - coefficients[1] - coefficients[2];
+    }
+
+    // Value of the bicubically upsampled sourcePtr at the integer target location (xTarget, yTarget)
+    template <typename T>
+    inline T bicubicUpsampledValue(
+        const T* const sourcePtr, const int width, const int height, const T scaleX, const T scaleY,
+        const int xTarget, const int yTarget)
+    {
+        // Source coordinates (cv::resize pixel-center convention)
+        const auto xSource = (xTarget + T(0.5)) / scaleX - T(0.5);
+        const auto ySource = (yTarget + T(0.5)) / scaleY - T(0.5);
+        const auto xInt = (int)std::floor(xSource);
+        const auto yInt = (int)std::floor(ySource);
+        T xCoefficients[4];
+        T yCoefficients[4];
+        getCubicCoefficients(xCoefficients, xSource - xInt);
+        getCubicCoefficients(yCoefficients, ySource - yInt);
+        // Border replicated
+        auto value = T(0);
+        for (auto i = 0 ; i < 4 ; i++)
+        {
+            const auto* const sourceRow = sourcePtr + fastTruncate(yInt - 1 + i, 0, height - 1) * width;
+            auto rowValue = T(0);
+            for (auto j = 0 ; j < 4 ; j++)
+                rowValue += xCoefficients[j] * sourceRow[fastTruncate(xInt - 1 + j, 0, width - 1)];
+            value += yCoefficients[i] * rowValue;
+        }
+        return value;
+    }
+
+    // Vertex of the parabola going through (-1, left), (0, center), (1, right)
+    template <typename T>
+    inline T getQuadraticPeakOffset(const T left, const T center, const T right)
+    {
+        const auto denominator = left - 2 * center + right;
+        return (denominator < 0 ? fastTruncate(T(0.5) * (left - right) / denominator, T(-0.5), T(0.5)) : T(0));
+    }
+
+    template <typename T>
+    void maximumSubpixelCpu(T* targetPtr, const T* const sourcePtr, const std::array<int, 4>& targetSize,
+                            const std::array<int, 4>& sourceSize, const T netFactor)
+    {
+        try
+        {
+            const auto height = sourceSize[2];
+            const auto width = sourceSize[3];
+            const auto imageOffset = height * width;
+            const auto num = targetSize[0];
+            const auto channels = targetSize[1];
+            const auto numberParts = targetSize[2];
+            const auto numberSubparts = targetSize[3];
+            // Upsampled size (as in ResizeAndMergeCaffe::Reshape) and real scale (as in cv::resize)
+            const auto upsampledWidth = positiveIntRound(width * netFactor - 1) + 1;
+            const auto upsampledHeight = positiveIntRound(height * netFactor - 1) + 1;
+            const auto scaleX = upsampledWidth / T(width);
+            const auto scaleY = upsampledHeight / T(height);
+            // The bicubic maximum is at most 1 source pixel away from the source one
+            const auto radiusX = (int)std::ceil(scaleX);
+            const auto radiusY = (int)std::ceil(scaleY);
+
+            for (auto n = 0; n < num; n++)
+            {
+                for (auto c = 0; c < channels; c++)
+                {
+                    // Parameters
+                    const auto offsetChannel = (n * channels + c);
+                    for (auto part = 0; part < numberParts; part++)
+                    {
+                        auto* targetPtrOffsetted = targetPtr + (offsetChannel + part) * numberSubparts;
+                        const auto* const sourcePtrOffsetted = sourcePtr + (offsetChannel + part) * imageOffset;
+                        // 1. Maximum at source resolution
+                        cv::Mat source(
+                            cv::Size(width, height), cv::DataType<T>::type, const_cast<T*>(sourcePtrOffsetted));
+                        double minVal, maxVal;
+                        cv::Point minLoc, maxLoc;
+                        cv::minMaxLoc(source, &minVal, &maxVal, &minLoc, &maxLoc);
+                        // 2. Maximum of the upsampled window around it
+                        const auto xCenter = positiveIntRound((maxLoc.x + T(0.5)) * scaleX - T(0.5));
+                        const auto yCenter = positiveIntRound((maxLoc.y + T(0.5)) * scaleY - T(0.5));
+                        auto xBest = xCenter;
+                        auto yBest = yCenter;
+                        auto valueBest = std::numeric_limits<T>::lowest();
+                        for (auto y = fastMax(0, yCenter - radiusY);
+                             y <= fastMin(upsampledHeight - 1, yCenter + radiusY) ; y++)
+                        {
+                            for (auto x = fastMax(0, xCenter - radiusX);
+                                 x <= fastMin(upsampledWidth - 1, xCenter + radiusX) ; x++)
+                            {
+                                const auto value = bicubicUpsampledValue(
+                                    sourcePtrOffsetted, width, height, scaleX, scaleY, x, y);
+                                if (valueBest < value)
+                                {
+                                    valueBest = value;
+                                    xBest = x;
+                                    yBest = y;
+                                }
+                            }
+                        }
+                        // 3. Subpixel refinement
+                        const auto getValue = [&](const int x, const int y)
+                        {
+                            return bicubicUpsampledValue(
+                                sourcePtrOffsetted, width, height, scaleX, scaleY,
+                                fastTruncate(x, 0, upsampledWidth - 1), fastTruncate(y, 0, upsampledHeight - 1));
+                        };
+                        const auto dx = getQuadraticPeakOffset(
+                            getValue(xBest - 1, yBest), valueBest, getValue(xBest + 1, yBest));
+                        const auto dy = getQuadraticPeakOffset(
+                            getValue(xBest, yBest - 1), valueBest, getValue(xBest, yBest + 1));
+                        targetPtrOffsetted[0] = xBest + dx;
+                        targetPtrOffsetted[1] = yBest + dy;
+                        targetPtrOffsetted[2] = valueBest;
+                    }
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
     template OP_API void maximumCpu(
         float* targetPtr, const float* const sourcePtr, const std::array<int, 4>& targetSize,
         const std::array<int, 4>& sourceSize);
     template OP_API void maximumCpu(
         double* targetPtr, const double* const sourcePtr, const std::array<int, 4>& targetSize,
         const std::array<int, 4>& sourceSize);
+    template OP_API void maximumSubpixelCpu(
+        float* targetPtr, const float* const sourcePtr, const std::array<int, 4>& targetSize,
+        const std::array<int, 4>& sourceSize, const float netFactor);
+    template OP_API void maximumSubpixelCpu(
+        double* targetPtr, const double* const sourcePtr, const std::array<int, 4>& targetSize,
+        const std::array<int, 4>& sourceSize, const double netFactor);
 }
@@ -7,7 +7,8 @@
 namespace op
 {
     template <typename T>
-    MaximumCaffe<T>::MaximumCaffe()
+    MaximumCaffe<T>::MaximumCaffe() :
+        mNetFactor{T(1)}
     {
         try
         {
@@ -51,11 +52,12 @@ namespace op
 
     template <typename T>
     void MaximumCaffe<T>::Reshape(const std::vector<ArrayCpuGpu<T>*>& bottom,
-                                  const std::vector<ArrayCpuGpu<T>*>& top)
+                                  const std::vector<ArrayCpuGpu<T>*>& top, const T netFactor)
     {
         try
         {
             #ifdef USE_CAFFE
+                mNetFactor = netFactor;
                 auto bottomBlob = bottom.at(0);
                 auto topBlob = top.at(0);
 
@@ -77,6 +79,7 @@ namespace op
             #else
                 UNUSED(bottom);
                 UNUSED(top);
+                UNUSED(netFactor);
             #endif
         }
         catch (const std::exception& e)
@@ -93,7 +96,11 @@ namespace op
         {
             // CUDA
             #ifdef USE_CUDA
-                Forward_gpu(bottom, top);
+                // Subpixel maximum only implemented on CPU
+                if (mNetFactor != T(1))
+                    Forward_cpu(bottom, top);
+                else
+                    Forward_gpu(bottom, top);
             // OpenCL or CPU
             #else
                 // CPU Version is already very fast (4ms)
@@ -114,7 +121,11 @@ namespace op
         try
         {
             #ifdef USE_CAFFE
-                maximumCpu(top.at(0)->mutable_cpu_data(), bottom.at(0)->cpu_data(), mTopSize, mBottomSize);
+                if (mNetFactor != T(1))
+                    maximumSubpixelCpu(
+                        top.at(0)->mutable_cpu_data(), bottom.at(0)->cpu_data(), mTopSize, mBottomSize, mNetFactor);
+                else
+                    maximumCpu(top.at(0)->mutable_cpu_data(), bottom.at(0)->cpu_data(), mTopSize, mBottomSize);
             #else
                 UNUSED(bottom);
                 UNUSED(top);
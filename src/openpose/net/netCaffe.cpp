@@ -2,9 +2,21 @@
 #include <numeric> // std::accumulate
 #ifdef USE_CAFFE
     #include <atomic>
+    #include <chrono>
+    #include <cstdint> // uint32_t, uint64_t
+    #include <cstdio> // std::remove, std::rename, std::snprintf
+    #include <cstring> // std::memcmp, std::memcpy
+    #include <fstream>
+    #include <map>
     #include <mutex>
     #include <caffe/net.hpp>
     #include <glog/logging.h> // google::InitGoogleLogging
+    #include <sys/stat.h> // stat, fstat
+    #ifndef _WIN32
+        #include <fcntl.h> // open, O_RDONLY
+        #include <sys/mman.h> // mmap, munmap
+        #include <unistd.h> // close
+    #endif
 #endif
 #ifdef USE_CUDA
     #include <openpose/gpu/cuda.hpp>
@@ -24,6 +36,467 @@ namespace op
         std::atomic<bool> sOpenCLInitialized{false};
     #endif
 
+    #ifdef USE_CAFFE
+        #ifdef NV_CAFFE
+            typedef caffe::Net CaffeNet;
+            typedef caffe::TBlob<float> CaffeBlob;
+        #else
+            typedef caffe::Net<float> CaffeNet;
+            typedef caffe::Blob<float> CaffeBlob;
+        #endif
+
+        // Shape bucketing - Idle Caffe net, already reshaped for a particular input size
+        struct NetCaffeWorkspace
+        {
+            std::vector<int> netInputSize4D;
+            std::unique_ptr<CaffeNet> upCaffeNet;
+            boost::shared_ptr<CaffeBlob> spOutputBlob;
+            std::shared_ptr<ArrayCpuGpu<float>> spOutputBlobArray;
+            unsigned long long lastUsed;
+        };
+
+        inline void reshapeNetCaffe(CaffeNet* caffeNet, const std::vector<int>& dimensions)
+        {
+            try
+            {
+                caffeNet->blobs()[0]->Reshape(dimensions);
+                caffeNet->Reshape();
+                #ifdef USE_CUDA
+                    cudaCheck(__LINE__, __FUNCTION__, __FILE__);
+                #endif
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+
+        #ifndef NV_CAFFE
+            // Weight cache - Flat file with the already parsed trained weights of each layer (64-byte aligned), so
+            // that the nets memory-map it rather than deserializing the protobuf caffemodel. It is mapped
+            // copy-on-write, so its pages are shared among the nets of this process and among processes.
+            // Layout: WeightCacheHeader, layer directory (for each layer with weights: name, number of blobs, and
+            // for each blob: number of axes, axes, and data offset), and the float data of each blob.
+            // Validity: The header keeps the size, modification time, and full content hash of the caffemodel. If
+            // its size and modification time still match, the cache is used right away. Otherwise, the whole model is
+            // hashed, and the cache is only used if its content did not change (e.g., the model was just copied).
+            const char WEIGHT_CACHE_MAGIC[8] = {'O', 'P', 'W', 'C', 'A', 'C', 'H', 'E'};
+            const uint32_t WEIGHT_CACHE_VERSION = 2u;
+            const uint64_t WEIGHT_CACHE_ALIGNMENT = 64ull;
+
+            struct WeightCacheHeader
+            {
+                char magic[8];
+                uint32_t version;
+                uint32_t numberLayers;
+                uint64_t modelSize;
+                int64_t modelModificationTime;
+                uint64_t modelHash;
+                uint64_t fileSize;
+            };
+
+            struct ModelFingerprint
+            {
+                uint64_t size;
+                int64_t modificationTime;
+            };
+
+            struct WeightCacheBlob
+            {
+                std::vector<int> shape;
+                uint64_t offset;
+            };
+
+            struct WeightCacheLayer
+            {
+                std::string name;
+                std::vector<WeightCacheBlob> blobs;
+            };
+
+            struct NetCaffeWeightCache
+            {
+                std::string path;
+                ModelFingerprint modelFingerprint;
+                std::vector<WeightCacheLayer> layers;
+                char* pData;
+                uint64_t size;
+                #ifdef _WIN32
+                    // No memory mapping, the file is read into memory
+                    std::vector<char> buffer;
+                #endif
+
+                NetCaffeWeightCache() :
+                    modelFingerprint{0ull, 0ll},
+                    pData{nullptr},
+                    size{0ull}
+                {
+                }
+
+                ~NetCaffeWeightCache()
+                {
+                    #ifndef _WIN32
+                        if (pData != nullptr)
+                            munmap(pData, size);
+                    #endif
+                }
+
+                DELETE_COPY(NetCaffeWeightCache);
+            };
+
+            // Shared by all the nets of this process using the same cache file
+            std::map<std::string, std::weak_ptr<NetCaffeWeightCache>> sWeightCaches;
+
+            inline uint64_t alignWeightCacheOffset(const uint64_t offset)
+            {
+                return (offset + WEIGHT_CACHE_ALIGNMENT - 1ull) / WEIGHT_CACHE_ALIGNMENT * WEIGHT_CACHE_ALIGNMENT;
+            }
+
+            inline uint64_t hashFnv1a(uint64_t hash, const char* const data, const size_t size)
+            {
+                for (auto i = 0u ; i < size ; i++)
+                {
+                    hash ^= (unsigned char)data[i];
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+
+            // Size and modification time of the caffemodel (fast check of whether it changed)
+            ModelFingerprint getModelFingerprint(const std::string& caffeTrainedModel)
+            {
+                try
+                {
+                    struct stat fileStatus;
+                    if (stat(caffeTrainedModel.c_str(), &fileStatus) != 0)
+                        error("Caffe trained model file could not be opened: " + caffeTrainedModel + ".",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    return ModelFingerprint{(uint64_t)fileStatus.st_size, (int64_t)fileStatus.st_mtime};
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return ModelFingerprint{0ull, 0ll};
+                }
+            }
+
+            // Hash of the whole content of the caffemodel
+            uint64_t getModelHash(const std::string& caffeTrainedModel)
+            {
+                try
+                {
+                    std::ifstream file{caffeTrainedModel, std::ios::binary};
+                    if (!file.is_open())
+                        error("Caffe trained model file could not be opened: " + caffeTrainedModel + ".",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    auto hash = 14695981039346656037ull;
+                    std::vector<char> chunk(1 << 20);
+                    while (file)
+                    {
+                        file.read(chunk.data(), (std::streamsize)chunk.size());
+                        hash = hashFnv1a(hash, chunk.data(), (size_t)file.gcount());
+                    }
+                    return hash;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return 0ull;
+                }
+            }
+
+            // Cache file of each model. Its name includes a hash of the model path, so different models with the same
+            // file name (e.g., `pose_iter_584000.caffemodel` of different folders) do not share the same cache
+            std::string getWeightCachePath(const std::string& weightCacheFolder, const std::string& caffeTrainedModel)
+            {
+                try
+                {
+                    const auto pathHash = hashFnv1a(
+                        14695981039346656037ull, caffeTrainedModel.data(), caffeTrainedModel.size());
+                    char pathHashString[17];
+                    std::snprintf(pathHashString, sizeof(pathHashString), "%016llx", (unsigned long long)pathHash);
+                    return weightCacheFolder + getFileNameNoExtension(caffeTrainedModel) + "_" + pathHashString
+                        + ".opcache";
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return "";
+                }
+            }
+
+            // Layers with trained weights, in net order
+            std::vector<std::pair<std::string, std::vector<boost::shared_ptr<CaffeBlob>>*>> getLayersWithWeights(
+                CaffeNet* caffeNet)
+            {
+                try
+                {
+                    std::vector<std::pair<std::string, std::vector<boost::shared_ptr<CaffeBlob>>*>> layers;
+                    const auto& caffeLayers = caffeNet->layers();
+                    const auto& layerNames = caffeNet->layer_names();
+                    for (auto i = 0u ; i < caffeLayers.size() ; i++)
+                        if (!caffeLayers[i]->blobs().empty())
+                            layers.emplace_back(layerNames.at(i), &caffeLayers[i]->blobs());
+                    return layers;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return {};
+                }
+            }
+
+            // It returns false if the file is truncated
+            template <typename T>
+            inline bool readWeightCacheValue(T& value, uint64_t& cursor, const char* const data, const uint64_t end)
+            {
+                if (cursor + sizeof(T) > end)
+                    return false;
+                std::memcpy(&value, data + cursor, sizeof(T));
+                cursor += sizeof(T);
+                return true;
+            }
+
+            // nullptr if the cache file does not exist, it is corrupted, or it belongs to a different model
+            std::shared_ptr<NetCaffeWeightCache> loadWeightCache(
+                const std::string& cachePath, const std::string& caffeTrainedModel,
+                const ModelFingerprint& modelFingerprint)
+            {
+                try
+                {
+                    std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                    // Already mapped by another net of this process
+                    auto& spCacheWeak = sWeightCaches[cachePath];
+                    auto spCache = spCacheWeak.lock();
+                    if (spCache != nullptr && spCache->modelFingerprint.size == modelFingerprint.size
+                        && spCache->modelFingerprint.modificationTime == modelFingerprint.modificationTime)
+                        return spCache;
+                    if (!existFile(cachePath))
+                        return nullptr;
+                    // Memory-map (or read) the cache file
+                    spCache = std::make_shared<NetCaffeWeightCache>();
+                    spCache->path = cachePath;
+                    #ifdef _WIN32
+                        std::ifstream file{cachePath, std::ios::binary | std::ios::ate};
+                        if (!file.is_open())
+                            return nullptr;
+                        spCache->size = (uint64_t)file.tellg();
+                        spCache->buffer.resize(spCache->size);
+                        file.seekg(0);
+                        file.read(spCache->buffer.data(), (std::streamsize)spCache->size);
+                        spCache->pData = spCache->buffer.data();
+                    #else
+                        const auto fileDescriptor = open(cachePath.c_str(), O_RDONLY);
+                        if (fileDescriptor < 0)
+                            return nullptr;
+                        struct stat fileStatus;
+                        if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+                        {
+                            close(fileDescriptor);
+                            return nullptr;
+                        }
+                        spCache->size = (uint64_t)fileStatus.st_size;
+                        // Copy-on-write: Caffe never writes trained weights during inference, so the pages remain
+                        // shared, but an unexpected write would only modify this process copy
+                        auto* mappedPtr = mmap(
+                            nullptr, spCache->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+                        close(fileDescriptor);
+                        if (mappedPtr == MAP_FAILED)
+                            return nullptr;
+                        spCache->pData = (char*)mappedPtr;
+                    #endif
+                    // Header
+                    WeightCacheHeader header;
+                    uint64_t cursor = 0ull;
+                    if (!readWeightCacheValue(header, cursor, spCache->pData, spCache->size)
+                        || std::memcmp(header.magic, WEIGHT_CACHE_MAGIC, sizeof(WEIGHT_CACHE_MAGIC)) != 0
+                        || header.version != WEIGHT_CACHE_VERSION || header.modelSize != modelFingerprint.size
+                        || header.fileSize != spCache->size)
+                        return nullptr;
+                    // Model modified since the cache was written: only valid if its content is still the same
+                    if (header.modelModificationTime != modelFingerprint.modificationTime
+                        && header.modelHash != getModelHash(caffeTrainedModel))
+                        return nullptr;
+                    spCache->modelFingerprint = modelFingerprint;
+                    // Layer directory
+                    spCache->layers.resize(header.numberLayers);
+                    for (auto& layer : spCache->layers)
+                    {
+                        uint32_t nameLength;
+                        if (!readWeightCacheValue(nameLength, cursor, spCache->pData, spCache->size)
+                            || cursor + nameLength > spCache->size)
+                            return nullptr;
+                        layer.name = std::string(spCache->pData + cursor, nameLength);
+                        cursor += nameLength;
+                        uint32_t numberBlobs;
+                        if (!readWeightCacheValue(numberBlobs, cursor, spCache->pData, spCache->size))
+                            return nullptr;
+                        layer.blobs.resize(numberBlobs);
+                        for (auto& blob : layer.blobs)
+                        {
+                            uint32_t numberAxes;
+                            if (!readWeightCacheValue(numberAxes, cursor, spCache->pData, spCache->size))
+                                return nullptr;
+                            blob.shape.resize(numberAxes);
+                            for (auto& axis : blob.shape)
+                                if (!readWeightCacheValue(axis, cursor, spCache->pData, spCache->size))
+                                    return nullptr;
+                            if (!readWeightCacheValue(blob.offset, cursor, spCache->pData, spCache->size))
+                                return nullptr;
+                            auto count = 1ull;
+                            for (const auto axis : blob.shape)
+                                count *= (uint64_t)axis;
+                            if (blob.offset % sizeof(float) != 0ull
+                                || blob.offset + count * sizeof(float) > spCache->size)
+                                return nullptr;
+                        }
+                    }
+                    spCacheWeak = spCache;
+                    return spCache;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return nullptr;
+                }
+            }
+
+            // It points the trained weights of caffeNet to the cache memory (no copy). It returns false (without
+            // modifying caffeNet) if the cache does not match the net layers (e.g., different prototxt)
+            bool assignWeightCache(const NetCaffeWeightCache& weightCache, CaffeNet* caffeNet)
+            {
+                try
+                {
+                    const auto layers = getLayersWithWeights(caffeNet);
+                    if (layers.size() != weightCache.layers.size())
+                        return false;
+                    for (auto i = 0u ; i < layers.size() ; i++)
+                    {
+                        const auto& cachedLayer = weightCache.layers[i];
+                        if (layers[i].first != cachedLayer.name
+                            || layers[i].second->size() != cachedLayer.blobs.size())
+                            return false;
+                        for (auto j = 0u ; j < cachedLayer.blobs.size() ; j++)
+                            if (layers[i].second->at(j)->shape() != cachedLayer.blobs[j].shape)
+                                return false;
+                    }
+                    for (auto i = 0u ; i < layers.size() ; i++)
+                        for (auto j = 0u ; j < layers[i].second->size() ; j++)
+                            layers[i].second->at(j)->set_cpu_data(
+                                (float*)(weightCache.pData + weightCache.layers[i].blobs[j].offset));
+                    return true;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return false;
+                }
+            }
+
+            template <typename T>
+            inline void appendWeightCacheValue(std::string& bytes, const T& value)
+            {
+                bytes.append((const char*)&value, sizeof(T));
+            }
+
+            // Written into a temporary file and then renamed, so other processes never read a partial cache
+            void writeWeightCache(
+                const std::string& cachePath, const std::string& caffeTrainedModel,
+                const ModelFingerprint& modelFingerprint, CaffeNet* caffeNet)
+            {
+                try
+                {
+                    const auto layers = getLayersWithWeights(caffeNet);
+                    // Directory size (needed to know where the data starts)
+                    auto directorySize = 0ull;
+                    for (const auto& layer : layers)
+                    {
+                        directorySize += sizeof(uint32_t) + layer.first.size() + sizeof(uint32_t);
+                        for (const auto& spBlob : *layer.second)
+                            directorySize += sizeof(uint32_t) + spBlob->shape().size()*sizeof(int) + sizeof(uint64_t);
+                    }
+                    // Directory
+                    std::string directory;
+                    directory.reserve(directorySize);
+                    auto offset = alignWeightCacheOffset(sizeof(WeightCacheHeader) + directorySize);
+                    std::vector<uint64_t> offsets;
+                    for (const auto& layer : layers)
+                    {
+                        appendWeightCacheValue(directory, (uint32_t)layer.first.size());
+                        directory.append(layer.first);
+                        appendWeightCacheValue(directory, (uint32_t)layer.second->size());
+                        for (const auto& spBlob : *layer.second)
+                        {
+                            appendWeightCacheValue(directory, (uint32_t)spBlob->shape().size());
+                            for (const auto axis : spBlob->shape())
+                                appendWeightCacheValue(directory, axis);
+                            appendWeightCacheValue(directory, offset);
+                            offsets.emplace_back(offset);
+                            offset = alignWeightCacheOffset(offset + spBlob->count()*sizeof(float));
+                        }
+                    }
+                    // Header
+                    WeightCacheHeader header;
+                    std::memcpy(header.magic, WEIGHT_CACHE_MAGIC, sizeof(WEIGHT_CACHE_MAGIC));
+                    header.version = WEIGHT_CACHE_VERSION;
+                    header.numberLayers = (uint32_t)layers.size();
+                    header.modelSize = modelFingerprint.size;
+                    header.modelModificationTime = modelFingerprint.modificationTime;
+                    header.modelHash = getModelHash(caffeTrainedModel);
+                    header.fileSize = offset;
+                    // Write file
+                    const auto temporaryPath = cachePath + ".tmp"
+                        + std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+                    {
+                        std::ofstream file{temporaryPath, std::ios::binary | std::ios::trunc};
+                        if (!file.is_open())
+                        {
+                            opLog("Weight cache could not be written into " + cachePath + " (no write access?).",
+                                  Priority::High);
+                            return;
+                        }
+                        file.write((const char*)&header, sizeof(header));
+                        file.write(directory.data(), (std::streamsize)directory.size());
+                        auto blobIndex = 0u;
+                        for (const auto& layer : layers)
+                        {
+                            for (const auto& spBlob : *layer.second)
+                            {
+                                const std::string padding(offsets[blobIndex++] - (uint64_t)file.tellp(), '\0');
+                                file.write(padding.data(), (std::streamsize)padding.size());
+                                file.write((const char*)spBlob->cpu_data(),
+                                           (std::streamsize)(spBlob->count()*sizeof(float)));
+                            }
+                        }
+                        const std::string padding(header.fileSize - (uint64_t)file.tellp(), '\0');
+                        file.write(padding.data(), (std::streamsize)padding.size());
+                        if (!file.good())
+                        {
+                            file.close();
+                            std::remove(temporaryPath.c_str());
+                            opLog("Weight cache could not be written into " + cachePath + ".", Priority::High);
+                            return;
+                        }
+                    }
+                    // Windows: std::rename fails if the target exists
+                    #ifdef _WIN32
+                        std::remove(cachePath.c_str());
+                    #endif
+                    if (std::rename(temporaryPath.c_str(), cachePath.c_str()) != 0)
+                    {
+                        std::remove(temporaryPath.c_str());
+                        opLog("Weight cache could not be renamed into " + cachePath + ".", Priority::High);
+                        return;
+                    }
+                    opLog("Weight cache written into " + cachePath + ".", Priority::High);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+        #endif
+    #endif
+
     struct NetCaffe::ImplNetCaffe
     {
         #ifdef USE_CAFFE
@@ -32,22 +505,33 @@ namespace op
             const std::string mCaffeProto;
             const std::string mCaffeTrainedModel;
             const std::string mLastBlobName;
+            const unsigned int mMaxWorkspaces;
+            const std::string mWeightCacheFolder;
             std::vector<int> mNetInputSize4D;
             // Init with thread
-            #ifdef NV_CAFFE
-                std::unique_ptr<caffe::Net> upCaffeNet;
-                boost::shared_ptr<caffe::TBlob<float>> spOutputBlob;
-            #else
-                std::unique_ptr<caffe::Net<float>> upCaffeNet;
-                boost::shared_ptr<caffe::Blob<float>> spOutputBlob;
+            #ifndef NV_CAFFE
+                // Weight cache - Declared before the nets, so it is released after them
+                std::shared_ptr<NetCaffeWeightCache> spWeightCache;
             #endif
+            std::unique_ptr<CaffeNet> upCaffeNet;
+            boost::shared_ptr<CaffeBlob> spOutputBlob;
+            std::shared_ptr<ArrayCpuGpu<float>> spOutputBlobArray;
+            // Shape bucketing - Other workspaces (sharing the trained weights of upCaffeNet)
+            std::vector<NetCaffeWorkspace> mIdleWorkspaces;
+            unsigned long long mNumberWorkspaceSwitches;
+            unsigned long long mNumberReshapes;
 
             ImplNetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
-                         const bool enableGoogleLogging, const std::string& lastBlobName) :
+                         const bool enableGoogleLogging, const std::string& lastBlobName,
+                         const unsigned int maxWorkspaces, const std::string& weightCacheFolder) :
                 mGpuId{gpuId},
                 mCaffeProto{caffeProto},
                 mCaffeTrainedModel{caffeTrainedModel},
-                mLastBlobName{lastBlobName}
+                mLastBlobName{lastBlobName},
+                mMaxWorkspaces{maxWorkspaces},
+                mWeightCacheFolder{weightCacheFolder.empty() ? "" : formatAsDirectory(weightCacheFolder)},
+                mNumberWorkspaceSwitches{0ull},
+                mNumberReshapes{0ull}
             {
                 try
                 {
@@ -57,11 +541,24 @@ namespace op
                         "\t\tRight example for the Windows portable binary: `cd {OpenPose_root_path}; bin/openpose.exe`\n"
                         "\t\tWrong example for the Windows portable binary: `cd {OpenPose_root_path}/bin; openpose.exe`\n"
                         "\t3. Using paths with spaces."};
+                    if (mMaxWorkspaces < 1u)
+                        error("There must be at least 1 network workspace.", __LINE__, __FUNCTION__, __FILE__);
                     if (!existFile(mCaffeProto))
                         error("Prototxt file not found: " + mCaffeProto + message, __LINE__, __FUNCTION__, __FILE__);
                     if (!existFile(mCaffeTrainedModel))
                         error("Caffe trained model file not found: " + mCaffeTrainedModel + message,
                               __LINE__, __FUNCTION__, __FILE__);
+                    // Weight cache folder
+                    if (!mWeightCacheFolder.empty())
+                    {
+                        #ifdef NV_CAFFE
+                            opLog("The weight cache is not implemented for NVCaffe, so it will be ignored.",
+                                  Priority::High);
+                        #else
+                            std::lock_guard<std::mutex> lock{sMutexNetCaffe};
+                            makeDirectory(mWeightCacheFolder);
+                        #endif
+                    }
                     // Double if condition in order to speed up the program if it is called several times
                     if (enableGoogleLogging && !sGoogleLoggingInitialized)
                     {
@@ -97,36 +594,168 @@ namespace op
                     error(e.what(), __LINE__, __FUNCTION__, __FILE__);
                 }
             }
-        #endif
-    };
 
-    #ifdef USE_CAFFE
-        #ifdef NV_CAFFE
-        inline void reshapeNetCaffe(caffe::Net* caffeNet, const std::vector<int>& dimensions)
-        #else
-        inline void reshapeNetCaffe(caffe::Net<float>* caffeNet, const std::vector<int>& dimensions)
-        #endif
-        {
-            try
+            // Caffe mode and device must have been already set on this thread
+            std::unique_ptr<CaffeNet> createCaffeNet() const
             {
-                caffeNet->blobs()[0]->Reshape(dimensions);
-                caffeNet->Reshape();
-                #ifdef USE_CUDA
-                    cudaCheck(__LINE__, __FUNCTION__, __FILE__);
-                #endif
+                try
+                {
+                    #ifdef USE_OPENCL
+                        return std::unique_ptr<CaffeNet>{
+                            new caffe::Net<float>{mCaffeProto, caffe::TEST, caffe::Caffe::GetDefaultDevice()}};
+                    #elif defined USE_CUDA
+                        #ifdef NV_CAFFE
+                            return std::unique_ptr<CaffeNet>{new caffe::Net{mCaffeProto, caffe::TEST}};
+                        #else
+                            return std::unique_ptr<CaffeNet>{new caffe::Net<float>{mCaffeProto, caffe::TEST}};
+                        #endif
+                    #elif defined _WIN32
+                        return std::unique_ptr<CaffeNet>{
+                            new caffe::Net<float>{mCaffeProto, caffe::TEST, caffe::Caffe::GetCPUDevice()}};
+                    #else
+                        return std::unique_ptr<CaffeNet>{new caffe::Net<float>{mCaffeProto, caffe::TEST}};
+                    #endif
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return nullptr;
+                }
             }
-            catch (const std::exception& e)
+
+            // Weight cache - It points the trained weights to the memory-mapped weight cache if it is valid for this
+            // model, or it deserializes the caffemodel otherwise (writing the cache for the next runs)
+            void copyTrainedLayers()
             {
-                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                try
+                {
+                    #ifndef NV_CAFFE
+                        if (!mWeightCacheFolder.empty())
+                        {
+                            const auto cachePath = getWeightCachePath(mWeightCacheFolder, mCaffeTrainedModel);
+                            const auto modelFingerprint = getModelFingerprint(mCaffeTrainedModel);
+                            spWeightCache = loadWeightCache(cachePath, mCaffeTrainedModel, modelFingerprint);
+                            if (spWeightCache != nullptr && assignWeightCache(*spWeightCache, upCaffeNet.get()))
+                            {
+                                opLog("Trained weights memory-mapped from " + cachePath + ".", Priority::Low);
+                                return;
+                            }
+                            spWeightCache.reset();
+                            upCaffeNet->CopyTrainedLayersFrom(mCaffeTrainedModel);
+                            writeWeightCache(cachePath, mCaffeTrainedModel, modelFingerprint, upCaffeNet.get());
+                            return;
+                        }
+                    #endif
+                    upCaffeNet->CopyTrainedLayersFrom(mCaffeTrainedModel);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
             }
-        }
-    #endif
+
+            boost::shared_ptr<CaffeBlob> getOutputBlob(CaffeNet* caffeNet) const
+            {
+                try
+                {
+                    #ifdef NV_CAFFE
+                        auto spBlob = boost::static_pointer_cast<caffe::TBlob<float>>(
+                            caffeNet->blob_by_name(mLastBlobName));
+                    #else
+                        auto spBlob = caffeNet->blob_by_name(mLastBlobName);
+                    #endif
+                    // Sanity check
+                    if (spBlob == nullptr)
+                        error("The output blob is a nullptr. Did you use the same name than the prototxt? (Used: "
+                              + mLastBlobName + ").", __LINE__, __FUNCTION__, __FILE__);
+                    return spBlob;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                    return nullptr;
+                }
+            }
+
+            void swapWorkspace(NetCaffeWorkspace& workspace)
+            {
+                try
+                {
+                    std::swap(mNetInputSize4D, workspace.netInputSize4D);
+                    std::swap(upCaffeNet, workspace.upCaffeNet);
+                    std::swap(spOutputBlob, workspace.spOutputBlob);
+                    std::swap(spOutputBlobArray, workspace.spOutputBlobArray);
+                    workspace.lastUsed = ++mNumberWorkspaceSwitches;
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+
+            // Shape bucketing - It makes upCaffeNet match netInputSize4D. Priority: 1) Keep the current workspace,
+            // 2) swap to the idle workspace already reshaped for that size, 3) create a new workspace (if
+            // mMaxWorkspaces allows it), 4) reshape the least recently used workspace
+            void setNetInputSize(const std::vector<int>& netInputSize4D)
+            {
+                try
+                {
+                    if (vectorsAreEqual(mNetInputSize4D, netInputSize4D))
+                        return;
+                    for (auto& workspace : mIdleWorkspaces)
+                    {
+                        if (vectorsAreEqual(workspace.netInputSize4D, netInputSize4D))
+                        {
+                            swapWorkspace(workspace);
+                            return;
+                        }
+                    }
+                    // The first reshape is done on the initial net
+                    if (!mNetInputSize4D.empty())
+                    {
+                        if (1u + mIdleWorkspaces.size() < mMaxWorkspaces)
+                        {
+                            mIdleWorkspaces.emplace_back();
+                            auto& workspace = mIdleWorkspaces.back();
+                            workspace.upCaffeNet = createCaffeNet();
+                            workspace.upCaffeNet->ShareTrainedLayersWith(upCaffeNet.get());
+                            workspace.spOutputBlob = getOutputBlob(workspace.upCaffeNet.get());
+                            swapWorkspace(workspace);
+                        }
+                        else if (!mIdleWorkspaces.empty())
+                        {
+                            auto leastRecentlyUsed = mIdleWorkspaces.begin();
+                            for (auto iterator = mIdleWorkspaces.begin() ; iterator != mIdleWorkspaces.end() ;
+                                 iterator++)
+                                if (iterator->lastUsed < leastRecentlyUsed->lastUsed)
+                                    leastRecentlyUsed = iterator;
+                            swapWorkspace(*leastRecentlyUsed);
+                        }
+                    }
+                    mNetInputSize4D = netInputSize4D;
+                    reshapeNetCaffe(upCaffeNet.get(), netInputSize4D);
+                    mNumberReshapes++;
+                    std::string sizeString;
+                    for (const auto size : netInputSize4D)
+                        sizeString += (sizeString.empty() ? "" : "x") + std::to_string(size);
+                    opLog("Network reshaped to " + sizeString + " (reshape number "
+                          + std::to_string(mNumberReshapes) + ", " + std::to_string(1u + mIdleWorkspaces.size())
+                          + " workspace(s)).", Priority::Low);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
+            }
+        #endif
+    };
 
     NetCaffe::NetCaffe(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
-                       const bool enableGoogleLogging, const std::string& lastBlobName)
+                       const bool enableGoogleLogging, const std::string& lastBlobName,
+                       const unsigned int maxWorkspaces, const std::string& weightCacheFolder)
         #ifdef USE_CAFFE
             : upImpl{new ImplNetCaffe{caffeProto, caffeTrainedModel, gpuId, enableGoogleLogging,
-                                      lastBlobName}}
+                                      lastBlobName, maxWorkspaces, weightCacheFolder}}
         #endif
     {
         try
@@ -137,6 +766,8 @@ namespace op
                 UNUSED(gpuId);
                 UNUSED(enableGoogleLogging);
                 UNUSED(lastBlobName);
+                UNUSED(maxWorkspaces);
+                UNUSED(weightCacheFolder);
                 error("OpenPose must be compiled with the `USE_CAFFE` macro definition in order to use this"
                       " functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -149,6 +780,21 @@ namespace op
 
     NetCaffe::~NetCaffe()
     {
+        try
+        {
+            #ifdef USE_CAFFE
+                // Shape bucketing - Report reshape counts
+                if (upImpl->mMaxWorkspaces > 1u)
+                    opLog("Network input shape bucketing: " + std::to_string(upImpl->mNumberReshapes)
+                          + " network reshapes, " + std::to_string(upImpl->mNumberWorkspaceSwitches)
+                          + " workspace switches (" + std::to_string(1u + upImpl->mIdleWorkspaces.size())
+                          + " workspaces).", Priority::High);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
     }
 
     void NetCaffe::initializationOnThread()
@@ -160,44 +806,24 @@ namespace op
                 #ifdef USE_OPENCL
                     caffe::Caffe::set_mode(caffe::Caffe::GPU);
                     caffe::Caffe::SelectDevice(upImpl->mGpuId, true);
-                    upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
-                                             caffe::Caffe::GetDefaultDevice()});
-                    upImpl->upCaffeNet->CopyTrainedLayersFrom(upImpl->mCaffeTrainedModel);
+                    upImpl->upCaffeNet = upImpl->createCaffeNet();
+                    upImpl->copyTrainedLayers();
                     OpenCL::getInstance(upImpl->mGpuId, CL_DEVICE_TYPE_GPU, true);
                 #else
                     #ifdef USE_CUDA
                         caffe::Caffe::set_mode(caffe::Caffe::GPU);
                         caffe::Caffe::SetDevice(upImpl->mGpuId);
-                        #ifdef NV_CAFFE
-                            upImpl->upCaffeNet.reset(new caffe::Net{upImpl->mCaffeProto, caffe::TEST});
-                        #else
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
-                        #endif
                     #else
                         caffe::Caffe::set_mode(caffe::Caffe::CPU);
-                        #ifdef _WIN32
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST,
-                                                                           caffe::Caffe::GetCPUDevice()});
-                        #else
-                            upImpl->upCaffeNet.reset(new caffe::Net<float>{upImpl->mCaffeProto, caffe::TEST});
-                        #endif
                     #endif
-                    upImpl->upCaffeNet->CopyTrainedLayersFrom(upImpl->mCaffeTrainedModel);
+                    upImpl->upCaffeNet = upImpl->createCaffeNet();
+                    upImpl->copyTrainedLayers();
                     #ifdef USE_CUDA
                         cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                     #endif
                 #endif
                 // Set spOutputBlob
-                #ifdef NV_CAFFE
-                    upImpl->spOutputBlob = boost::static_pointer_cast<caffe::TBlob<float>>(
-                        upImpl->upCaffeNet->blob_by_name(upImpl->mLastBlobName));
-                #else
-                    upImpl->spOutputBlob = upImpl->upCaffeNet->blob_by_name(upImpl->mLastBlobName);
-                #endif
-                // Sanity check
-                if (upImpl->spOutputBlob == nullptr)
-                    error("The output blob is a nullptr. Did you use the same name than the prototxt? (Used: "
-                          + upImpl->mLastBlobName + ").", __LINE__, __FUNCTION__, __FILE__);
+                upImpl->spOutputBlob = upImpl->getOutputBlob(upImpl->upCaffeNet.get());
                 #ifdef USE_CUDA
                     cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                 #endif
@@ -220,12 +846,9 @@ namespace op
                 if (inputData.getNumberDimensions() != 4 || inputData.getSize(1) != 3)
                     error("The Array inputData must have 4 dimensions: [batch size, 3 (RGB), height, width].",
                           __LINE__, __FUNCTION__, __FILE__);
-                // Reshape Caffe net if required
-                if (!vectorsAreEqual(upImpl->mNetInputSize4D, inputData.getSize()))
-                {
-                    upImpl->mNetInputSize4D = inputData.getSize();
-                    reshapeNetCaffe(upImpl->upCaffeNet.get(), inputData.getSize());
-                }
+                // Reshape Caffe net (or switch to its workspace) if required (no-op if inputData comes from
+                // getInputDataArray())
+                upImpl->setNetInputSize(inputData.getSize());
                 // Copy frame data to GPU memory
                 #ifdef USE_CUDA
                     #ifdef NV_CAFFE
@@ -242,7 +865,10 @@ namespace op
                         imageBuffer, true, 0, inputData.getVolume() * sizeof(float), inputData.getConstPtr());
                 #else
                     auto* cpuImagePtr = upImpl->upCaffeNet->blobs().at(0)->mutable_cpu_data();
-                    std::copy(inputData.getConstPtr(), inputData.getConstPtr() + inputData.getVolume(), cpuImagePtr);
+                    // Already in the net input memory if inputData comes from getInputDataArray()
+                    if (inputData.getConstPtr() != cpuImagePtr)
+                        std::copy(
+                            inputData.getConstPtr(), inputData.getConstPtr() + inputData.getVolume(), cpuImagePtr);
                 #endif
                 // Perform deep network forward pass
                 upImpl->upCaffeNet->ForwardFrom(0);
@@ -260,12 +886,40 @@ namespace op
         }
     }
 
+    Array<float> NetCaffe::getInputDataArray(const std::vector<int>& inputSize)
+    {
+        try
+        {
+            // Only CPU version, GPU versions must copy the input into the device memory anyway
+            #if defined USE_CAFFE && !defined USE_CUDA && !defined USE_OPENCL
+                // Sanity check
+                if (inputSize.size() != 4 || inputSize[1] != 3)
+                    error("The input size must have 4 dimensions: [batch size, 3 (RGB), height, width].",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Reshape Caffe net (or switch to its workspace) if required
+                upImpl->setNetInputSize(inputSize);
+                return Array<float>{inputSize, upImpl->upCaffeNet->blobs().at(0)->mutable_cpu_data()};
+            #else
+                UNUSED(inputSize);
+                return Array<float>{};
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
     std::shared_ptr<ArrayCpuGpu<float>> NetCaffe::getOutputBlobArray() const
     {
         try
         {
             #ifdef USE_CAFFE
-                return std::make_shared<ArrayCpuGpu<float>>(upImpl->spOutputBlob.get());
+                // Shared among calls, but different for each workspace
+                if (upImpl->spOutputBlobArray == nullptr)
+                    upImpl->spOutputBlobArray = std::make_shared<ArrayCpuGpu<float>>(upImpl->spOutputBlob.get());
+                return upImpl->spOutputBlobArray;
             #else
                 return nullptr;
             #endif
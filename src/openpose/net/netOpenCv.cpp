@@ -1,22 +1,21 @@
-// TODO: After completely adding the OpenCV DNN module, add this flag to CMake as alternative to USE_CAFFE
-// #define USE_OPEN_CV_DNN
-
 #include <openpose/net/netOpenCv.hpp>
-// Note: OpenCV only uses CPU or OpenCL (for Intel GPUs). Used CUDA for following blobs (Resize + NMS)
-#ifdef USE_CAFFE
-    #include <caffe/net.hpp>
-#endif
-#include <openpose_private/utilities/openCvMultiversionHeaders.hpp> // OPEN_CV_IS_4_OR_HIGHER
+// Note: OpenCV DNN only uses CPU or OpenCL (e.g., for Intel GPUs), so it requires neither Caffe nor CUDA
 #ifdef USE_OPEN_CV_DNN
-    #if defined(USE_CAFFE) && defined(USE_CUDA) && defined(OPEN_CV_IS_4_OR_HIGHER)
-        #include <opencv2/opencv.hpp>
-        #include <openpose/gpu/cuda.hpp>
+    #include <openpose_private/utilities/openCvMultiversionHeaders.hpp> // OPEN_CV_IS_4_OR_HIGHER
+    #ifdef OPEN_CV_IS_4_OR_HIGHER
+        #include <opencv2/dnn.hpp>
     #else
-        #error In order to enable OpenCV DNN module in OpenPose, the CMake flags of Caffe and CUDA must be \
-               enabled, and OpenCV version must be at least 4.0.0.
+        #error In order to enable OpenCV DNN module in OpenPose, OpenCV version must be at least 4.0.0.
+    #endif
+    // INT8 quantization (cv::dnn::Net::quantize) added in OpenCV 4.6.0
+    #if CV_MAJOR_VERSION > 4 || (CV_MAJOR_VERSION == 4 && CV_MINOR_VERSION >= 6)
+        #define OPEN_CV_DNN_INT8
+    #endif
+    // FP16 CPU target (cv::dnn::DNN_TARGET_CPU_FP16) added in OpenCV 4.9.0
+    #if CV_MAJOR_VERSION > 4 || (CV_MAJOR_VERSION == 4 && CV_MINOR_VERSION >= 9)
+        #define OPEN_CV_DNN_CPU_FP16
     #endif
 #endif
-#include <numeric> // std::accumulate
 #include <openpose/utilities/fileSystem.hpp>
 
 namespace op
@@ -28,67 +27,101 @@ namespace op
             const int mGpuId;
             const std::string mCaffeProto;
             const std::string mCaffeTrainedModel;
-            // OpenCV DNN
+            const OpenCvDnnBackend mBackend;
+            const OpenCvDnnTarget mTarget;
+            const OpenCvDnnPrecision mPrecision;
+            const int mNumberThreads;
+            // Init with thread
             cv::dnn::Net mNet;
+            bool mQuantized;
             cv::Mat mNetOutputBlob;
-            boost::shared_ptr<caffe::Blob<float>> spOutputBlob;
 
-            ImplNetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId) :
+            ImplNetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
+                          const OpenCvDnnBackend backend, const OpenCvDnnTarget target,
+                          const OpenCvDnnPrecision precision, const int numberThreads) :
                 mGpuId{gpuId},
                 mCaffeProto{caffeProto},
                 mCaffeTrainedModel{caffeTrainedModel},
-                mNet{cv::dnn::readNetFromCaffe(caffeProto, caffeTrainedModel)},
-                spOutputBlob{new caffe::Blob<float>(1,1,1,1)}
+                mBackend{backend},
+                mTarget{target},
+                mPrecision{precision},
+                mNumberThreads{numberThreads},
+                mQuantized{false}
             {
+                try
+                {
                     const std::string message{".\nPossible causes:\n"
                         "\t1. Not downloading the OpenPose trained models.\n"
                         "\t2. Not running OpenPose from the root directory (i.e., where the `model` folder is located, but do not move the `model` folder!). E.g.,\n"
                         "\t\tRight example for the Windows portable binary: `cd {OpenPose_root_path}; bin/openpose.exe`\n"
                         "\t\tWrong example for the Windows portable binary: `cd {OpenPose_root_path}/bin; openpose.exe`\n"
                         "\t3. Using paths with spaces."};
-                if (!existFile(mCaffeProto))
-                    error("Prototxt file not found: " + mCaffeProto + message, __LINE__, __FUNCTION__, __FILE__);
-                if (!existFile(mCaffeTrainedModel))
-                    error("Caffe trained model file not found: " + mCaffeTrainedModel + message,
-                          __LINE__, __FUNCTION__, __FILE__);
-
-                // Set GPU
-                mNet.setPreferableTarget(cv::dnn::DNN_TARGET_CPU); // 1.7 sec at -1x160
-                // mNet.setPreferableTarget(cv::dnn::DNN_TARGET_OPENCL); // 1.2 sec at -1x160
-                // mNet.setPreferableTarget(cv::dnn::DNN_TARGET_OPENCL_FP16);
-                // mNet.setPreferableTarget(cv::dnn::DNN_TARGET_MYRIAD);
-                // mNet.setPreferableTarget(cv::dnn::DNN_TARGET_VULKAN);
-                // // Set backen
-                // mNet.setPreferableBackend(cv::dnn::DNN_BACKEND_DEFAULT);
-                // mNet.setPreferableBackend(cv::dnn::DNN_BACKEND_HALIDE);
-                // mNet.setPreferableBackend(cv::dnn::DNN_BACKEND_INFERENCE_ENGINE);
-                // mNet.setPreferableBackend(cv::dnn::DNN_BACKEND_OPENCV);
-                // mNet.setPreferableBackend(cv::dnn::DNN_BACKEND_VKCOM);
+                    if (!existFile(mCaffeProto))
+                        error("Prototxt file not found: " + mCaffeProto + message, __LINE__, __FUNCTION__, __FILE__);
+                    if (!existFile(mCaffeTrainedModel))
+                        error("Caffe trained model file not found: " + mCaffeTrainedModel + message,
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // Sanity checks
+                    if (mBackend >= OpenCvDnnBackend::Size || mTarget >= OpenCvDnnTarget::Size
+                        || mPrecision >= OpenCvDnnPrecision::Size)
+                        error("Unknown OpenCV DNN backend, target, or precision.", __LINE__, __FUNCTION__, __FILE__);
+                    if (mPrecision == OpenCvDnnPrecision::Int8)
+                    {
+                        #ifdef OPEN_CV_DNN_INT8
+                            if (mBackend != OpenCvDnnBackend::OpenCv || mTarget != OpenCvDnnTarget::Cpu)
+                                error("OpenCV DNN INT8 precision is only implemented for the OpenCV backend and the"
+                                      " CPU target.", __LINE__, __FUNCTION__, __FILE__);
+                        #else
+                            error("OpenCV DNN INT8 precision requires OpenCV 4.6.0 or higher.",
+                                  __LINE__, __FUNCTION__, __FILE__);
+                        #endif
+                    }
+                    #ifndef OPEN_CV_DNN_CPU_FP16
+                        if (mPrecision == OpenCvDnnPrecision::Fp16 && mTarget == OpenCvDnnTarget::Cpu)
+                            error("OpenCV DNN FP16 precision on CPU requires OpenCV 4.9.0 or higher (or use the"
+                                  " OpenCL target).", __LINE__, __FUNCTION__, __FILE__);
+                    #endif
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
             }
-        #endif
-    };
 
-    #ifdef USE_OPEN_CV_DNN
-        inline void reshapeNetOpenCv(caffe::Net<float>* caffeNet, const std::vector<int>& dimensions)
-        {
-            try
-            {
-                caffeNet->blobs()[0]->Reshape(dimensions);
-                caffeNet->Reshape();
-                #ifdef USE_CUDA
-                    cudaCheck(__LINE__, __FUNCTION__, __FILE__);
-                #endif
-            }
-            catch (const std::exception& e)
+            void setBackendAndTarget()
             {
-                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                try
+                {
+                    // Backend
+                    mNet.setPreferableBackend(
+                        mBackend == OpenCvDnnBackend::InferenceEngine
+                            ? cv::dnn::DNN_BACKEND_INFERENCE_ENGINE : cv::dnn::DNN_BACKEND_OPENCV);
+                    // Target
+                    if (mTarget == OpenCvDnnTarget::OpenCL)
+                        mNet.setPreferableTarget(
+                            mPrecision == OpenCvDnnPrecision::Fp16
+                                ? cv::dnn::DNN_TARGET_OPENCL_FP16 : cv::dnn::DNN_TARGET_OPENCL);
+                    #ifdef OPEN_CV_DNN_CPU_FP16
+                        else if (mPrecision == OpenCvDnnPrecision::Fp16)
+                            mNet.setPreferableTarget(cv::dnn::DNN_TARGET_CPU_FP16);
+                    #endif
+                    else
+                        mNet.setPreferableTarget(cv::dnn::DNN_TARGET_CPU);
+                }
+                catch (const std::exception& e)
+                {
+                    error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                }
             }
-        }
-    #endif
+        #endif
+    };
 
-    NetOpenCv::NetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId)
+    NetOpenCv::NetOpenCv(const std::string& caffeProto, const std::string& caffeTrainedModel, const int gpuId,
+                         const OpenCvDnnBackend backend, const OpenCvDnnTarget target,
+                         const OpenCvDnnPrecision precision, const int numberThreads)
         #ifdef USE_OPEN_CV_DNN
-            : upImpl{new ImplNetOpenCv{caffeProto, caffeTrainedModel, gpuId}}
+            : upImpl{new ImplNetOpenCv{caffeProto, caffeTrainedModel, gpuId, backend, target, precision,
+                                       numberThreads}}
         #endif
     {
         try
@@ -97,7 +130,11 @@ namespace op
                 UNUSED(caffeProto);
                 UNUSED(caffeTrainedModel);
                 UNUSED(gpuId);
-                error("OpenPose must be compiled with the `USE_CAFFE` macro definition in order to use this"
+                UNUSED(backend);
+                UNUSED(target);
+                UNUSED(precision);
+                UNUSED(numberThreads);
+                error("OpenPose must be compiled with the `USE_OPEN_CV_DNN` macro definition in order to use this"
                       " functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
         }
@@ -113,6 +150,24 @@ namespace op
 
     void NetOpenCv::initializationOnThread()
     {
+        try
+        {
+            #ifdef USE_OPEN_CV_DNN
+                // Number of threads
+                if (upImpl->mNumberThreads > 0)
+                    cv::setNumThreads(upImpl->mNumberThreads);
+                // Initialize net
+                upImpl->mNet = cv::dnn::readNetFromCaffe(upImpl->mCaffeProto, upImpl->mCaffeTrainedModel);
+                if (upImpl->mNet.empty())
+                    error("OpenCV DNN could not read the network " + upImpl->mCaffeProto + ".",
+                          __LINE__, __FUNCTION__, __FILE__);
+                upImpl->setBackendAndTarget();
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
     }
 
     void NetOpenCv::forwardPass(const Array<float>& inputData) const
@@ -120,23 +175,58 @@ namespace op
         try
         {
             #ifdef USE_OPEN_CV_DNN
-                upImpl->mNet.setInput(inputData.getConstCvMat());
+                // Sanity checks
+                if (inputData.empty())
+                    error("The Array inputData cannot be empty.", __LINE__, __FUNCTION__, __FILE__);
+                if (inputData.getNumberDimensions() != 4 || inputData.getSize(1) != 3)
+                    error("The Array inputData must have 4 dimensions: [batch size, 3 (RGB), height, width].",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // 4-D blob on the inputData memory (no copy)
+                const auto inputSize = inputData.getSize();
+                const cv::Mat inputBlob(
+                    (int)inputSize.size(), inputSize.data(), CV_32F, (void*)inputData.getConstPtr());
+                // INT8 quantization - First frame used as calibration data
+                #ifdef OPEN_CV_DNN_INT8
+                    if (upImpl->mPrecision == OpenCvDnnPrecision::Int8 && !upImpl->mQuantized)
+                    {
+                        upImpl->mNet = upImpl->mNet.quantize(std::vector<cv::Mat>{inputBlob}, CV_32F, CV_32F);
+                        upImpl->setBackendAndTarget();
+                        upImpl->mQuantized = true;
+                        opLog("OpenCV DNN network quantized to INT8.", Priority::Low);
+                    }
+                #endif
+                // Perform deep network forward pass
+                upImpl->mNet.setInput(inputBlob);
                 upImpl->mNetOutputBlob = upImpl->mNet.forward(); // 99% of the runtime here
-                std::vector<int> outputSize(upImpl->mNetOutputBlob.dims,0);
+            #else
+                UNUSED(inputData);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Array<float> NetOpenCv::getOutputArray() const
+    {
+        try
+        {
+            #ifdef USE_OPEN_CV_DNN
+                if (upImpl->mNetOutputBlob.empty())
+                    return Array<float>{};
+                std::vector<int> outputSize(upImpl->mNetOutputBlob.dims, 0);
                 for (auto i = 0u ; i < outputSize.size() ; i++)
                     outputSize[i] = upImpl->mNetOutputBlob.size[i];
-                upImpl->spOutputBlob->Reshape(outputSize);
-                auto* gpuImagePtr = upImpl->spOutputBlob->mutable_gpu_data();
-                cudaMemcpy(gpuImagePtr, (float*)upImpl->mNetOutputBlob.data,
-                           upImpl->spOutputBlob->count() * sizeof(float),
-                           cudaMemcpyHostToDevice);
+                return Array<float>{outputSize, upImpl->mNetOutputBlob.ptr<float>()};
             #else
-                UNUSED(inputData);
+                return Array<float>{};
             #endif
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
         }
     }
 
@@ -144,8 +234,9 @@ namespace op
     {
         try
         {
-            #ifdef USE_OPEN_CV_DNN
-                return std::make_shared<ArrayCpuGpu<float>>(upImpl->spOutputBlob.get());
+            #if defined USE_OPEN_CV_DNN && defined USE_CAFFE
+                const bool copyFromGpu = false;
+                return std::make_shared<ArrayCpuGpu<float>>(getOutputArray(), copyFromGpu);
             #else
                 return nullptr;
             #endif
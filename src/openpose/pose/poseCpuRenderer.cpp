@@ -1,4 +1,6 @@
 #include <openpose/pose/poseCpuRenderer.hpp>
+#include <algorithm> // std::find
+#include <openpose/pose/poseParameters.hpp>
 #include <openpose/pose/renderPose.hpp>
 #include <openpose/utilities/keypoint.hpp>
 
@@ -6,10 +8,14 @@ namespace op
 {
     PoseCpuRenderer::PoseCpuRenderer(const PoseModel poseModel, const float renderThreshold,
                                      const bool blendOriginalFrame, const float alphaKeypoint,
-                                     const float alphaHeatMap, const unsigned int elementToRender) :
+                                     const float alphaHeatMap, const unsigned int elementToRender,
+                                     const std::vector<HeatMapType>& heatMapTypes,
+                                     const ScaleMode heatMapScaleMode) :
         Renderer{renderThreshold, alphaKeypoint, alphaHeatMap, blendOriginalFrame, elementToRender,
                  getNumberElementsToRender(poseModel)}, // mNumberElementsToRender
-        PoseRenderer{poseModel}
+        PoseRenderer{poseModel},
+        mHeatMapTypes{heatMapTypes},
+        mHeatMapScaleMode{heatMapScaleMode}
     {
     }
 
@@ -20,7 +26,8 @@ namespace op
     std::pair<int, std::string> PoseCpuRenderer::renderPose(Array<float>& outputData,
                                                             const Array<float>& poseKeypoints,
                                                             const float scaleInputToOutput,
-                                                            const float scaleNetToOutput)
+                                                            const float scaleNetToOutput,
+                                                            const Array<float>& poseHeatMaps)
     {
         try
         {
@@ -43,9 +50,84 @@ namespace op
             // Draw heat maps / PAFs
             else
             {
-                UNUSED(scaleNetToOutput);
-                error("CPU rendering only available for drawing keypoints, no heat maps nor PAFs.",
-                      __LINE__, __FUNCTION__, __FILE__);
+                // Sanity check
+                if (scaleNetToOutput == -1.f)
+                    error("Non valid scaleNetToOutput.", __LINE__, __FUNCTION__, __FILE__);
+                if (poseHeatMaps.empty())
+                    error("CPU rendering of heat maps and PAFs requires them in Datum::poseHeatMaps, i.e., enable"
+                          " `--heatmaps_add_parts`, `--heatmaps_add_bkg` and/or `--heatmaps_add_PAFs`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Parameters
+                const auto numberBodyParts = getPoseNumberBodyParts(mPoseModel);
+                const auto hasBkg = addBkgChannel(mPoseModel);
+                const auto numberBodyPartsPlusBkg = numberBodyParts + (hasBkg ? 1 : 0);
+                const auto numberBodyPAFChannels = getPosePartPairs(mPoseModel).size();
+                const Point<int> heatMapSize{poseHeatMaps.getSize(2), poseHeatMaps.getSize(1)};
+                const auto lastPAFChannel = numberBodyPartsPlusBkg+2+numberBodyPAFChannels/2;
+                const auto scaleToKeepRatio = scaleNetToOutput * scaleInputToOutput;
+                const auto alphaHeatMap = (mBlendOriginalFrame ? getAlphaHeatMap() : 1.f);
+                // Datum::poseHeatMaps only contains the enabled heat map types (in order parts, bkg, PAFs)
+                const auto heatMapTypesHas = [&](const HeatMapType heatMapType)
+                {
+                    return std::find(mHeatMapTypes.begin(), mHeatMapTypes.end(), heatMapType) != mHeatMapTypes.end();
+                };
+                const auto hasParts = heatMapTypesHas(HeatMapType::Parts);
+                const auto hasBkgHeatMap = heatMapTypesHas(HeatMapType::Background) && hasBkg;
+                const auto hasPAFs = heatMapTypesHas(HeatMapType::PAFs);
+                const auto bkgChannel = (hasParts ? numberBodyParts : 0u);
+                const auto firstPAFChannel = bkgChannel + (hasBkgHeatMap ? 1u : 0u);
+                const auto getChannelPtr = [&](const unsigned int channel, const bool channelAvailable,
+                                               const std::string& flag)
+                {
+                    if (!channelAvailable)
+                        error("CPU rendering of this element requires flag `--" + flag + "`.",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    return poseHeatMaps.getConstPtr() + channel * heatMapSize.area();
+                };
+                // Add all heatmaps
+                if (elementRendered == 2)
+                {
+                    elementRenderedName = "Heatmaps";
+                    renderPoseHeatMapsCpu(
+                        outputData, mPoseModel, getChannelPtr(0u, hasParts, "heatmaps_add_parts"), heatMapSize,
+                        scaleToKeepRatio, alphaHeatMap, mHeatMapScaleMode);
+                }
+                // Draw PAFs (Part Affinity Fields)
+                else if (elementRendered == 3)
+                {
+                    elementRenderedName = "PAFs (Part Affinity Fields)";
+                    renderPosePAFsCpu(
+                        outputData, mPoseModel, getChannelPtr(firstPAFChannel, hasPAFs, "heatmaps_add_PAFs"),
+                        heatMapSize, scaleToKeepRatio, alphaHeatMap, mHeatMapScaleMode);
+                }
+                // Draw specific body part or background
+                else if (elementRendered <= numberBodyPartsPlusBkg+2)
+                {
+                    const auto realElementRendered = (elementRendered == 1
+                                                        ? (hasBkg ? numberBodyParts : 0)
+                                                        : elementRendered - 3 - (hasBkg ? 1:0));
+                    elementRenderedName = mPartIndexToName.at(realElementRendered);
+                    const auto* const heatMapPtr = (realElementRendered == numberBodyParts
+                        ? getChannelPtr(bkgChannel, hasBkgHeatMap, "heatmaps_add_bkg")
+                        : getChannelPtr(realElementRendered, hasParts, "heatmaps_add_parts"));
+                    renderPoseHeatMapCpu(
+                        outputData, heatMapPtr, heatMapSize, scaleToKeepRatio, alphaHeatMap, mHeatMapScaleMode);
+                }
+                // Draw affinity between 2 body parts
+                else if (elementRendered <= lastPAFChannel)
+                {
+                    const auto affinityPart = (elementRendered-numberBodyPartsPlusBkg-3)*2;
+                    const auto affinityPartMapped = getPoseMapIndex(mPoseModel).at(affinityPart);
+                    elementRenderedName = mPartIndexToName.at(numberBodyPartsPlusBkg + affinityPartMapped);
+                    elementRenderedName = elementRenderedName.substr(0, elementRenderedName.find("("));
+                    renderPosePAFCpu(
+                        outputData, getChannelPtr(firstPAFChannel + affinityPartMapped, hasPAFs, "heatmaps_add_PAFs"),
+                        heatMapSize, scaleToKeepRatio, alphaHeatMap, mHeatMapScaleMode);
+                }
+                // Draw neck-part distance channel
+                else
+                    error("Neck-part distance channels are not part of Datum::poseHeatMaps, they can only be"
+                          " rendered with GPU rendering.", __LINE__, __FUNCTION__, __FILE__);
             }
             // Return result
             return std::make_pair(elementRendered, elementRenderedName);
@@ -9,13 +9,16 @@ namespace op
                                  const std::shared_ptr<KeepTopNPeople>& keepTopNPeople,
                                  const std::shared_ptr<PersonIdExtractor>& personIdExtractor,
                                  const std::shared_ptr<std::vector<std::shared_ptr<PersonTracker>>>& personTrackers,
-                                 const int numberPeopleMax, const int tracking) :
+                                 const int numberPeopleMax, const int tracking,
+                                 const std::shared_ptr<PersonRoiMosaic>& personRoiMosaic) :
         mNumberPeopleMax{numberPeopleMax},
         mTracking{tracking},
         spPoseExtractorNet{poseExtractorNet},
         spKeepTopNPeople{keepTopNPeople},
         spPersonIdExtractor{personIdExtractor},
-        spPersonTrackers{personTrackers}
+        spPersonTrackers{personTrackers},
+        spPersonRoiMosaic{personRoiMosaic},
+        mRoiMosaicUsed{false}
     {
     }
 
@@ -39,18 +42,113 @@ namespace op
                                     const Point<int>& inputDataSize,
                                     const std::vector<double>& scaleInputToNetInputs,
                                     const Array<float>& poseNetOutput,
-                                    const long long frameId)
+                                    const long long frameId,
+                                    const Matrix& cvInputData,
+                                    const unsigned long long imageViewIndex)
     {
         try
         {
-            if (mTracking < 1 || frameId % (mTracking+1) == 0)
-                spPoseExtractorNet->forwardPass(inputNetData, inputDataSize, scaleInputToNetInputs, poseNetOutput);
-            else
+            if (!forwardPassWithoutNetInput(
+                inputDataSize, scaleInputToNetInputs, poseNetOutput, frameId, cvInputData, imageViewIndex))
+                forwardPassNetInput(
+                    inputNetData, inputDataSize, scaleInputToNetInputs, poseNetOutput, frameId, imageViewIndex);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    bool PoseExtractor::forwardPassWithoutNetInput(const Point<int>& inputDataSize,
+                                                   const std::vector<double>& scaleInputToNetInputs,
+                                                   const Array<float>& poseNetOutput,
+                                                   const long long frameId,
+                                                   const Matrix& cvInputData,
+                                                   const unsigned long long imageViewIndex)
+    {
+        try
+        {
+            mRoiMosaicUsed = false;
+            // Frame skipped by the tracker
+            if (mTracking >= 1 && frameId % (mTracking+1) != 0)
+            {
                 spPoseExtractorNet->clear();
+                return true;
+            }
+            // ROI mosaic (static cameras)
+            if (spPersonRoiMosaic && poseNetOutput.empty() && frameId >= 0)
+            {
+                std::vector<Array<float>> mosaicNetInput;
+                std::vector<double> mosaicScaleInputToNetInputs;
+                Point<int> mosaicSize;
+                std::vector<Rectangle<int>> mosaicRegions;
+                std::vector<Point<int>> mosaicOffsets;
+                if (spPersonRoiMosaic->createMosaicNetInput(
+                    mosaicNetInput, mosaicScaleInputToNetInputs, mosaicSize, mosaicRegions, mosaicOffsets,
+                    cvInputData, scaleInputToNetInputs, (unsigned long long)frameId, imageViewIndex))
+                {
+                    mRoiMosaicUsed = true;
+                    // No people - Skip network
+                    if (mosaicNetInput.empty())
+                    {
+                        spPoseExtractorNet->clear();
+                        mRoiMosaicPoseKeypoints.reset();
+                        mRoiMosaicPoseScores.reset();
+                    }
+                    else
+                    {
+                        spPoseExtractorNet->forwardPass(mosaicNetInput, mosaicSize, mosaicScaleInputToNetInputs);
+                        mRoiMosaicPoseKeypoints = spPoseExtractorNet->getPoseKeypoints().clone();
+                        mRoiMosaicPoseScores = spPoseExtractorNet->getPoseScores().clone();
+                        spPersonRoiMosaic->mosaicToFrame(
+                            mRoiMosaicPoseKeypoints, mRoiMosaicPoseScores, mosaicRegions, mosaicOffsets);
+                    }
+                    spPersonRoiMosaic->update(
+                        mRoiMosaicPoseKeypoints, inputDataSize, (unsigned long long)frameId, imageViewIndex);
+                    return true;
+                }
+            }
+            return false;
         }
         catch (const std::exception& e)
         {
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void PoseExtractor::forwardPassNetInput(const std::vector<Array<float>>& inputNetData,
+                                            const Point<int>& inputDataSize,
+                                            const std::vector<double>& scaleInputToNetInputs,
+                                            const Array<float>& poseNetOutput,
+                                            const long long frameId,
+                                            const unsigned long long imageViewIndex)
+    {
+        try
+        {
+            // Full frame
+            spPoseExtractorNet->forwardPass(inputNetData, inputDataSize, scaleInputToNetInputs, poseNetOutput);
+            if (spPersonRoiMosaic && frameId >= 0)
+                spPersonRoiMosaic->update(
+                    spPoseExtractorNet->getPoseKeypoints(), inputDataSize, (unsigned long long)frameId,
+                    imageViewIndex);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::vector<Array<float>> PoseExtractor::getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes)
+    {
+        try
+        {
+            return spPoseExtractorNet->getInputNetDataArrays(netInputSizes);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
         }
     }
 
@@ -67,6 +165,19 @@ namespace op
         }
     }
 
+    Array<float> PoseExtractor::getNetOutputCopy() const
+    {
+        try
+        {
+            return spPoseExtractorNet->getNetOutputCopy();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
     std::vector<std::vector<std::array<float, 3>>> PoseExtractor::getCandidatesCopy() const
     {
         try
@@ -84,6 +195,8 @@ namespace op
     {
         try
         {
+            if (mRoiMosaicUsed)
+                return mRoiMosaicPoseKeypoints;
             return spPoseExtractorNet->getPoseKeypoints();
         }
         catch (const std::exception& e)
@@ -97,6 +210,8 @@ namespace op
     {
         try
         {
+            if (mRoiMosaicUsed)
+                return mRoiMosaicPoseScores;
             return spPoseExtractorNet->getPoseScores();
         }
         catch (const std::exception& e)
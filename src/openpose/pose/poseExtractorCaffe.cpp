@@ -74,7 +74,8 @@ namespace op
             std::vector<std::shared_ptr<Net>>& net,
             std::vector<std::shared_ptr<ArrayCpuGpu<float>>>& caffeNetOutputBlob,
             const PoseModel poseModel, const int gpuId, const std::string& modelFolder,
-            const std::string& protoTxtPath, const std::string& caffeModelPath, const bool enableGoogleLogging)
+            const std::string& protoTxtPath, const std::string& caffeModelPath, const bool enableGoogleLogging,
+            const unsigned int maxNetWorkspaces, const std::string& weightCacheFolder)
         {
             try
             {
@@ -83,7 +84,7 @@ namespace op
                     std::make_shared<NetCaffe>(
                         modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
                         modelFolder + (caffeModelPath.empty() ? getPoseTrainedModel(poseModel) : caffeModelPath),
-                        gpuId, enableGoogleLogging));
+                        gpuId, enableGoogleLogging, "net_output", maxNetWorkspaces, weightCacheFolder));
                 // net.emplace_back(
                 //     std::make_shared<NetOpenCv>(
                 //         modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
@@ -112,7 +113,8 @@ namespace op
         const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
         const std::vector<HeatMapType>& heatMapTypes, const ScaleMode heatMapScaleMode, const bool addPartCandidates,
         const bool maximizePositives, const std::string& protoTxtPath, const std::string& caffeModelPath,
-        const float upsamplingRatio, const bool enableNet, const bool enableGoogleLogging) :
+        const float upsamplingRatio, const bool enableNet, const bool enableGoogleLogging,
+        const bool temporalWarmStart, const unsigned int maxNetWorkspaces, const std::string& weightCacheFolder) :
         PoseExtractorNet{poseModel, heatMapTypes, heatMapScaleMode, addPartCandidates, maximizePositives},
         mPoseModel{poseModel},
         mGpuId{gpuId},
@@ -121,7 +123,9 @@ namespace op
         mCaffeModelPath{caffeModelPath},
         mUpsamplingRatio{upsamplingRatio},
         mEnableNet{enableNet},
-        mEnableGoogleLogging{enableGoogleLogging}
+        mEnableGoogleLogging{enableGoogleLogging},
+        mMaxNetWorkspaces{maxNetWorkspaces},
+        mWeightCacheFolder{weightCacheFolder}
         #ifdef USE_CAFFE
             ,
             spResizeAndMergeCaffe{std::make_shared<ResizeAndMergeCaffe<float>>()},
@@ -136,6 +140,8 @@ namespace op
                 // Layers parameters
                 spBodyPartConnectorCaffe->setPoseModel(mPoseModel);
                 spBodyPartConnectorCaffe->setMaximizePositives(maximizePositives);
+                // The top-down refinement re-runs the connector on each person ROI, overriding the temporal prior
+                spBodyPartConnectorCaffe->setTemporalWarmStart(temporalWarmStart && !TOP_DOWN_REFINEMENT);
             #else
                 UNUSED(poseModel);
                 UNUSED(modelFolder);
@@ -147,6 +153,9 @@ namespace op
                 UNUSED(protoTxtPath);
                 UNUSED(caffeModelPath);
                 UNUSED(enableGoogleLogging);
+                UNUSED(temporalWarmStart);
+                UNUSED(maxNetWorkspaces);
+                UNUSED(weightCacheFolder);
                 error("OpenPose must be compiled with the `USE_CAFFE` macro definition in order to use this"
                       " functionality.", __LINE__, __FUNCTION__, __FILE__);
             #endif
@@ -174,7 +183,7 @@ namespace op
                     addCaffeNetOnThread(
                         spNets, spCaffeNetOutputBlobs, mPoseModel, mGpuId,
                         mModelFolder, mProtoTxtPath, mCaffeModelPath,
-                        mEnableGoogleLogging);
+                        mEnableGoogleLogging, mMaxNetWorkspaces, mWeightCacheFolder);
                     #ifdef USE_CUDA
                         cudaCheck(__LINE__, __FUNCTION__, __FILE__);
                     #endif
@@ -241,10 +250,15 @@ namespace op
                     while (spNets.size() < numberScales)
                         addCaffeNetOnThread(
                             spNets, spCaffeNetOutputBlobs, mPoseModel, mGpuId,
-                            mModelFolder, mProtoTxtPath, mCaffeModelPath, false);
+                            mModelFolder, mProtoTxtPath, mCaffeModelPath, false, mMaxNetWorkspaces,
+                            mWeightCacheFolder);
 
                     for (auto i = 0u ; i < inputNetData.size(); i++)
+                    {
                         spNets.at(i)->forwardPass(inputNetData[i]);
+                        // Shape bucketing - Output blob of the workspace used for this input size
+                        spCaffeNetOutputBlobs[i] = spNets[i]->getOutputBlobArray();
+                    }
                 }
                 // If custom network output
                 else
@@ -430,6 +444,7 @@ namespace op
                             // Re-Process image
                             // 1. Caffe deep network
                             spNets.at(0)->forwardPass(inputNetDataRoi);
+                            spCaffeNetOutputBlobs[0] = spNets[0]->getOutputBlobArray();
                             std::vector<std::shared_ptr<ArrayCpuGpu<float>>> caffeNetOutputBlob{
                                 spCaffeNetOutputBlobs[0]};
                             // Reshape blobs
@@ -633,6 +648,44 @@ namespace op
         }
     }
 
+    std::vector<Array<float>> PoseExtractorCaffe::getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes)
+    {
+        try
+        {
+            #ifdef USE_CAFFE
+                checkThread();
+                // Custom network output (no network input required)
+                if (!mEnableNet || netInputSizes.empty())
+                    return {};
+                // 1 network per scale
+                while (spNets.size() < netInputSizes.size())
+                    addCaffeNetOnThread(
+                        spNets, spCaffeNetOutputBlobs, mPoseModel, mGpuId,
+                        mModelFolder, mProtoTxtPath, mCaffeModelPath, false, mMaxNetWorkspaces,
+                        mWeightCacheFolder);
+                // Network input memory
+                std::vector<Array<float>> inputNetData(netInputSizes.size());
+                for (auto i = 0u ; i < inputNetData.size(); i++)
+                {
+                    inputNetData[i] = spNets[i]->getInputDataArray(
+                        {1, 3, netInputSizes[i].y, netInputSizes[i].x});
+                    // Not accessible from CPU
+                    if (inputNetData[i].empty())
+                        return {};
+                }
+                return inputNetData;
+            #else
+                UNUSED(netInputSizes);
+                return {};
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
     const float* PoseExtractorCaffe::getCandidatesCpuConstPtr() const
     {
         try
@@ -723,6 +776,34 @@ namespace op
         }
     }
 
+    Array<float> PoseExtractorCaffe::getNetOutputCopy() const
+    {
+        try
+        {
+            #ifdef USE_CAFFE
+                checkThread();
+                // Sanity check
+                if (spCaffeNetOutputBlobs.size() != 1u)
+                    error("The raw network output can only be copied when a single scale is used (`--scale_number"
+                          " 1`), current number of scales: " + std::to_string(spCaffeNetOutputBlobs.size()) + ".",
+                          __LINE__, __FUNCTION__, __FILE__);
+                // Copy memory (from GPU if required)
+                const auto& netOutputBlob = spCaffeNetOutputBlobs[0];
+                Array<float> netOutput{netOutputBlob->shape()};
+                const auto* const netOutputCpuPtr = netOutputBlob->cpu_data();
+                std::copy(netOutputCpuPtr, netOutputCpuPtr + netOutput.getVolume(), netOutput.getPtr());
+                return netOutput;
+            #else
+                return Array<float>{};
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
     const float* PoseExtractorCaffe::getPoseGpuConstPtr() const
     {
         try
@@ -243,6 +243,35 @@ namespace op
         }
     }
 
+    std::vector<Array<float>> PoseExtractorNet::getInputNetDataArrays(const std::vector<Point<int>>& netInputSizes)
+    {
+        try
+        {
+            UNUSED(netInputSizes);
+            return {};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    Array<float> PoseExtractorNet::getNetOutputCopy() const
+    {
+        try
+        {
+            error("The raw network output is not available for this PoseExtractorNet class.",
+                  __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
     std::vector<std::vector<std::array<float,3>>> PoseExtractorNet::getCandidatesCopy() const
     {
         try
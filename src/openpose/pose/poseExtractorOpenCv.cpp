@@ -0,0 +1,365 @@
+#include <openpose/pose/poseExtractorOpenCv.hpp>
+#include <openpose/net/bodyPartConnectorBase.hpp>
+#include <openpose/net/nmsBase.hpp>
+#include <openpose/net/resizeAndMergeBase.hpp>
+#include <openpose/pose/poseParameters.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/keypoint.hpp>
+#include <openpose/utilities/openCv.hpp>
+#include <openpose/utilities/standard.hpp>
+
+namespace op
+{
+    #ifdef USE_OPEN_CV_DNN
+        inline std::array<int, 4> getArraySize4D(const Array<float>& array)
+        {
+            try
+            {
+                return std::array<int, 4>{array.getSize(0), array.getSize(1), array.getSize(2), array.getSize(3)};
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+                return std::array<int, 4>{};
+            }
+        }
+
+        void addOpenCvNetOnThread(
+            std::vector<std::shared_ptr<NetOpenCv>>& net, const PoseModel poseModel, const int gpuId,
+            const std::string& modelFolder, const std::string& protoTxtPath, const std::string& caffeModelPath,
+            const OpenCvDnnBackend backend, const OpenCvDnnTarget target, const OpenCvDnnPrecision precision,
+            const int numberThreads)
+        {
+            try
+            {
+                // Add OpenCV DNN Net
+                net.emplace_back(
+                    std::make_shared<NetOpenCv>(
+                        modelFolder + (protoTxtPath.empty() ? getPoseProtoTxt(poseModel) : protoTxtPath),
+                        modelFolder + (caffeModelPath.empty() ? getPoseTrainedModel(poseModel) : caffeModelPath),
+                        gpuId, backend, target, precision, numberThreads));
+                // Initializing them on the thread
+                net.back()->initializationOnThread();
+            }
+            catch (const std::exception& e)
+            {
+                error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            }
+        }
+    #endif
+
+    PoseExtractorOpenCv::PoseExtractorOpenCv(
+        const PoseModel poseModel, const std::string& modelFolder, const int gpuId,
+        const std::vector<HeatMapType>& heatMapTypes, const ScaleMode heatMapScaleMode, const bool addPartCandidates,
+        const bool maximizePositives, const std::string& protoTxtPath, const std::string& caffeModelPath,
+        const float upsamplingRatio, const bool enableNet, const bool temporalWarmStart,
+        const OpenCvDnnBackend backend, const OpenCvDnnTarget target, const OpenCvDnnPrecision precision,
+        const int numberThreads) :
+        PoseExtractorNet{poseModel, heatMapTypes, heatMapScaleMode, addPartCandidates, maximizePositives},
+        mGpuId{gpuId},
+        mModelFolder{modelFolder},
+        mProtoTxtPath{protoTxtPath},
+        mCaffeModelPath{caffeModelPath},
+        mUpsamplingRatio{upsamplingRatio},
+        mEnableNet{enableNet},
+        mMaximizePositives{maximizePositives},
+        mTemporalWarmStart{temporalWarmStart},
+        mBackend{backend},
+        mTarget{target},
+        mPrecision{precision},
+        mNumberThreads{numberThreads}
+    {
+        try
+        {
+            #ifndef USE_OPEN_CV_DNN
+                UNUSED(poseModel);
+                UNUSED(heatMapTypes);
+                UNUSED(heatMapScaleMode);
+                UNUSED(addPartCandidates);
+                error("OpenPose must be compiled with the `USE_OPEN_CV_DNN` macro definition in order to use this"
+                      " functionality.", __LINE__, __FUNCTION__, __FILE__);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    PoseExtractorOpenCv::~PoseExtractorOpenCv()
+    {
+    }
+
+    void PoseExtractorOpenCv::netInitializationOnThread()
+    {
+        try
+        {
+            #ifdef USE_OPEN_CV_DNN
+                if (mEnableNet)
+                {
+                    // Logging
+                    opLog("Starting initialization on thread.", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+                    // Initialize OpenCV DNN net
+                    addOpenCvNetOnThread(
+                        spNets, mPoseModel, mGpuId, mModelFolder, mProtoTxtPath, mCaffeModelPath,
+                        mBackend, mTarget, mPrecision, mNumberThreads);
+                }
+                // Logging
+                opLog("Finished initialization on thread.", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void PoseExtractorOpenCv::forwardPass(
+        const std::vector<Array<float>>& inputNetData, const Point<int>& inputDataSize,
+        const std::vector<double>& scaleInputToNetInputs, const Array<float>& poseNetOutput)
+    {
+        try
+        {
+            #ifdef USE_OPEN_CV_DNN
+                // Sanity checks
+                if (inputNetData.empty())
+                    error("Empty inputNetData.", __LINE__, __FUNCTION__, __FILE__);
+                for (const auto& inputNetDataI : inputNetData)
+                    if (inputNetDataI.empty())
+                        error("Empty inputNetData.", __LINE__, __FUNCTION__, __FILE__);
+                if (inputNetData.size() != scaleInputToNetInputs.size())
+                    error("Size(inputNetData) must be same than size(scaleInputToNetInputs).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (poseNetOutput.empty() != mEnableNet)
+                {
+                    const std::string errorMsg = ". Either use OpenPose default network (`--body 1`) or fill the"
+                        " `poseNetOutput` argument (only 1 of those 2, not both).";
+                    if (poseNetOutput.empty())
+                        error("The argument poseNetOutput cannot be empty if mEnableNet is true" + errorMsg,
+                              __LINE__, __FUNCTION__, __FILE__);
+                    else
+                        error("The argument poseNetOutput is not empty and you have also explicitly chosen to run"
+                              " the OpenPose network" + errorMsg, __LINE__, __FUNCTION__, __FILE__);
+                }
+
+                // 1. OpenCV DNN deep network
+                const auto numberScales = inputNetData.size();
+                if (mEnableNet)
+                {
+                    while (spNets.size() < numberScales)
+                        addOpenCvNetOnThread(
+                            spNets, mPoseModel, mGpuId, mModelFolder, mProtoTxtPath, mCaffeModelPath,
+                            mBackend, mTarget, mPrecision, mNumberThreads);
+                    mNetOutputs.resize(numberScales);
+                    for (auto i = 0u ; i < numberScales ; i++)
+                    {
+                        spNets.at(i)->forwardPass(inputNetData[i]);
+                        mNetOutputs[i] = spNets[i]->getOutputArray();
+                    }
+                }
+                // If custom network output
+                else
+                {
+                    // Sanity check
+                    if (numberScales != 1u)
+                        error("Size(inputNetData) must match the provided heatmaps batch size ("
+                              + std::to_string(numberScales) + " vs. " + std::to_string(1) + ").",
+                              __LINE__, __FUNCTION__, __FILE__);
+                    // Non-owning 4-D view of the heatmap information
+                    auto netOutputSize = poseNetOutput.getSize();
+                    if (netOutputSize.size() == 3)
+                        netOutputSize.insert(netOutputSize.begin(), 1);
+                    mNetOutputs = {Array<float>{netOutputSize, (float*)poseNetOutput.getConstPtr()}};
+                }
+                for (const auto& netOutput : mNetOutputs)
+                    if (netOutput.getNumberDimensions() != 4)
+                        error("The network output must have 4 dimensions: [batch size, channels, height, width].",
+                              __LINE__, __FUNCTION__, __FILE__);
+
+                // 2. Resize heat maps + merge different scales
+                // Same size than ResizeAndMergeCaffe::Reshape() (scaleFactor = 1)
+                const auto netFactor = (
+                    mUpsamplingRatio <= 0.f ? getPoseNetDecreaseFactor(mPoseModel) : mUpsamplingRatio);
+                const auto& netOutput0 = mNetOutputs[0];
+                const std::vector<int> heatMapSize{
+                    1, netOutput0.getSize(1),
+                    positiveIntRound(netOutput0.getSize(2)*netFactor - 1.f) + 1,
+                    positiveIntRound(netOutput0.getSize(3)*netFactor - 1.f) + 1};
+                const auto changedVectors = !vectorsAreEqual(mHeatMaps.getSize(), heatMapSize);
+                if (changedVectors)
+                {
+                    mHeatMaps.reset(heatMapSize);
+                    // Temporal prior (heat map coordinates) no longer valid
+                    mPreviousPoseKeypoints.reset();
+                    // Get scale net to output (i.e., image input)
+                    const auto ratio = (
+                        mUpsamplingRatio <= 0.f
+                            ? 1 : mUpsamplingRatio / getPoseNetDecreaseFactor(mPoseModel));
+                    const auto& inputNetDataSize = inputNetData[0].getSize();
+                    mNetOutputSize = Point<int>{
+                        positiveIntRound(ratio*inputNetDataSize[3]), positiveIntRound(ratio*inputNetDataSize[2])};
+                }
+                std::vector<const float*> sourcePtrs(numberScales);
+                std::vector<std::array<int, 4>> sourceSizes(numberScales);
+                std::vector<float> floatScaleRatios(numberScales);
+                for (auto i = 0u ; i < numberScales ; i++)
+                {
+                    sourcePtrs[i] = mNetOutputs[i].getConstPtr();
+                    sourceSizes[i] = getArraySize4D(mNetOutputs[i]);
+                    floatScaleRatios[i] = float(scaleInputToNetInputs[i]);
+                }
+                resizeAndMergeCpu(
+                    mHeatMaps.getPtr(), sourcePtrs, getArraySize4D(mHeatMaps), sourceSizes, floatScaleRatios);
+                // Get scale net to output (i.e., image input)
+                const auto scaleProducerToNetInput = resizeGetScaleFactor(inputDataSize, mNetOutputSize);
+                const Point<int> netSize{
+                    positiveIntRound(scaleProducerToNetInput*inputDataSize.x),
+                    positiveIntRound(scaleProducerToNetInput*inputDataSize.y)};
+                mScaleNetToOutput = {(float)resizeGetScaleFactor(netSize, inputDataSize)};
+
+                // 3. Get peaks by Non-Maximum Suppression
+                // Same sizes than NmsCaffe::Reshape()
+                const auto numberBodyParts = getPoseNumberBodyParts(mPoseModel);
+                const std::vector<int> peaksSize{1, (int)numberBodyParts, (int)getPoseMaxPeaks()+1, 3};
+                if (!vectorsAreEqual(mPeaks.getSize(), peaksSize))
+                    mPeaks.reset(peaksSize);
+                if (!vectorsAreEqual(mNmsKernel.getSize(), heatMapSize))
+                    mNmsKernel.reset(heatMapSize);
+                const auto nmsOffset = float(0.5/double(mScaleNetToOutput));
+                nmsCpu(
+                    mPeaks.getPtr(), mNmsKernel.getPtr(), mHeatMaps.getConstPtr(),
+                    (float)get(PoseProperty::NMSThreshold), getArraySize4D(mPeaks), getArraySize4D(mHeatMaps),
+                    Point<float>{nmsOffset, nmsOffset});
+
+                // 4. Connecting body parts
+                connectBodyPartsCpu(
+                    mPoseKeypoints, mPoseScores, mHeatMaps.getConstPtr(), mPeaks.getConstPtr(), mPoseModel,
+                    Point<int>{heatMapSize[3], heatMapSize[2]}, (int)getPoseMaxPeaks(),
+                    (float)get(PoseProperty::ConnectInterMinAboveThreshold),
+                    (float)get(PoseProperty::ConnectInterThreshold), (int)get(PoseProperty::ConnectMinSubsetCnt),
+                    (float)get(PoseProperty::ConnectMinSubsetScore), (float)get(PoseProperty::NMSThreshold),
+                    mScaleNetToOutput, mMaximizePositives,
+                    (mTemporalWarmStart ? mPreviousPoseKeypoints : Array<float>{}));
+                // Temporal prior for the next frame (back to heat map coordinates)
+                if (mTemporalWarmStart)
+                {
+                    mPoseKeypoints.copyTo(mPreviousPoseKeypoints);
+                    if (!mPreviousPoseKeypoints.empty() && mScaleNetToOutput != 1.f)
+                        scaleKeypoints(mPreviousPoseKeypoints, 1.f/mScaleNetToOutput);
+                }
+            #else
+                UNUSED(inputNetData);
+                UNUSED(inputDataSize);
+                UNUSED(scaleInputToNetInputs);
+                UNUSED(poseNetOutput);
+            #endif
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    const float* PoseExtractorOpenCv::getCandidatesCpuConstPtr() const
+    {
+        try
+        {
+            checkThread();
+            return mPeaks.getConstPtr();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    const float* PoseExtractorOpenCv::getCandidatesGpuConstPtr() const
+    {
+        try
+        {
+            error("OpenCV DNN results are only available in CPU memory.", __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    const float* PoseExtractorOpenCv::getHeatMapCpuConstPtr() const
+    {
+        try
+        {
+            checkThread();
+            return mHeatMaps.getConstPtr();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    const float* PoseExtractorOpenCv::getHeatMapGpuConstPtr() const
+    {
+        try
+        {
+            error("OpenCV DNN results are only available in CPU memory.", __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+
+    std::vector<int> PoseExtractorOpenCv::getHeatMapSize() const
+    {
+        try
+        {
+            checkThread();
+            return mHeatMaps.getSize();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    Array<float> PoseExtractorOpenCv::getNetOutputCopy() const
+    {
+        try
+        {
+            checkThread();
+            // Sanity check
+            if (mNetOutputs.size() != 1u)
+                error("The raw network output can only be copied when a single scale is used (`--scale_number"
+                      " 1`), current number of scales: " + std::to_string(mNetOutputs.size()) + ".",
+                      __LINE__, __FUNCTION__, __FILE__);
+            return mNetOutputs[0].clone();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
+    const float* PoseExtractorOpenCv::getPoseGpuConstPtr() const
+    {
+        try
+        {
+            error("GPU pointer for people pose data not implemented yet.", __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return nullptr;
+        }
+    }
+}
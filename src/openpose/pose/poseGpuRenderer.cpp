@@ -91,7 +91,7 @@ namespace op
 
     std::pair<int, std::string> PoseGpuRenderer::renderPose(
         Array<float>& outputData, const Array<float>& poseKeypoints, const float scaleInputToOutput,
-        const float scaleNetToOutput)
+        const float scaleNetToOutput, const Array<float>& poseHeatMaps)
     {
         try
         {
@@ -101,6 +101,8 @@ namespace op
             // GPU rendering
             const auto elementRendered = spElementToRender->load();
             std::string elementRenderedName;
+            // Heat maps are directly read from the network GPU memory
+            UNUSED(poseHeatMaps);
             #ifdef USE_CUDA
                 const auto numberPeople = poseKeypoints.getSize(0);
                 if (numberPeople > 0 || elementRendered != 0 || !mBlendOriginalFrame)
@@ -1,10 +1,300 @@
 #include <openpose/pose/renderPose.hpp>
+#include <algorithm> // std::copy, std::fill
+#include <array>
+#include <cmath> // std::atan2, std::floor, std::sqrt
+#include <exception> // std::exception_ptr
+#include <thread>
+#ifdef WITH_AVX
+    #include <immintrin.h>
+#endif
 #include <openpose/pose/poseParameters.hpp>
 #include <openpose/utilities/fastMath.hpp>
 #include <openpose/utilities/keypoint.hpp>
 
 namespace op
 {
+    const auto PI = 3.14159265358979323846f;
+
+    inline void checkAlpha(const float alphaColorToAdd)
+    {
+        if (alphaColorToAdd < 0.f || alphaColorToAdd > 1.f)
+            error("Alpha must be in the range [0, 1].", __LINE__, __FUNCTION__, __FILE__);
+    }
+
+    // It returns the (scale, offset) that maps the heat map values back into their original range, i.e., [0, 1] for
+    // body parts and background and [-1, 1] for PAFs (see PoseExtractorNet::getHeatMapsCopy())
+    inline std::pair<float, float> getHeatMapNormalization(const ScaleMode heatMapScaleMode, const bool isPAF)
+    {
+        try
+        {
+            if (heatMapScaleMode == ScaleMode::UnsignedChar)
+                return (isPAF ? std::make_pair(1.f/128.5f, -1.f) : std::make_pair(1.f/255.f, 0.f));
+            else if (heatMapScaleMode == ScaleMode::PlusMinusOne
+                     || heatMapScaleMode == ScaleMode::PlusMinusOneFixedAspect)
+                return (isPAF ? std::make_pair(1.f, 0.f) : std::make_pair(0.5f, 0.5f));
+            else if (heatMapScaleMode == ScaleMode::ZeroToOne
+                     || heatMapScaleMode == ScaleMode::ZeroToOneFixedAspect)
+                return (isPAF ? std::make_pair(2.f, -1.f) : std::make_pair(1.f, 0.f));
+            else
+                return std::make_pair(1.f, 0.f);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return std::make_pair(1.f, 0.f);
+        }
+    }
+
+    // Source coordinate of each target pixel, as in the GPU kernels
+    inline float getSourceCoordinate(const int target, const float scaleToKeepRatio)
+    {
+        return (target + 0.5f) / scaleToKeepRatio - 0.5f;
+    }
+
+    inline std::vector<int> getNearestTaps(const int targetSize, const int sourceSize, const float scaleToKeepRatio)
+    {
+        try
+        {
+            std::vector<int> indexes(targetSize);
+            for (auto target = 0 ; target < targetSize ; target++)
+                indexes[target] = fastTruncate(
+                    int(std::floor(getSourceCoordinate(target, scaleToKeepRatio) + 1e-5f)), 0, sourceSize-1);
+            return indexes;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    // numberTaps = 2 for bilinear and 4 for bicubic (same coefficients than cubicInterpolate() in gpu/cuda.hu)
+    inline void getInterpolationTaps(
+        std::vector<int>& indexes, std::vector<float>& weights, const int numberTaps, const int targetSize,
+        const int sourceSize, const float scaleToKeepRatio)
+    {
+        try
+        {
+            indexes.resize(numberTaps*targetSize);
+            weights.resize(numberTaps*targetSize);
+            for (auto target = 0 ; target < targetSize ; target++)
+            {
+                const auto source = getSourceCoordinate(target, scaleToKeepRatio);
+                const auto index1 = fastTruncate(int(std::floor(source)), 0, sourceSize-1);
+                const auto index2 = fastMin(sourceSize-1, index1+1);
+                const auto d = source - index1;
+                auto* indexesTarget = &indexes[numberTaps*target];
+                auto* weightsTarget = &weights[numberTaps*target];
+                if (numberTaps == 2)
+                {
+                    indexesTarget[0] = index1;
+                    indexesTarget[1] = index2;
+                    weightsTarget[0] = 1.f - d;
+                    weightsTarget[1] = d;
+                }
+                else
+                {
+                    indexesTarget[0] = fastMax(0, index1-1);
+                    indexesTarget[1] = index1;
+                    indexesTarget[2] = index2;
+                    indexesTarget[3] = fastMin(sourceSize-1, index2+1);
+                    const auto d2 = d*d;
+                    const auto d3 = d2*d;
+                    weightsTarget[0] = -0.5f*d3 + d2 - 0.5f*d;
+                    weightsTarget[1] = 1.5f*d3 - 2.5f*d2 + 1.f;
+                    weightsTarget[2] = -1.5f*d3 + 2.f*d2 + 0.5f*d;
+                    weightsTarget[3] = 0.5f*d3 - 0.5f*d2;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    // It splits the frame rows into blocks, each one rendered by a different thread
+    template <typename TFunction>
+    void parallelForRows(const int numberRows, const TFunction& renderRows)
+    {
+        try
+        {
+            // Not worth a thread for just a few rows
+            const auto minimumRowsPerThread = 32;
+            const auto numberThreads = fastMax(1, fastMin(
+                (int)std::thread::hardware_concurrency(), numberRows / minimumRowsPerThread));
+            const auto rowsPerThread = (numberRows + numberThreads - 1) / numberThreads;
+            std::vector<std::exception_ptr> exceptionPtrs(numberThreads);
+            const auto renderBlock = [&](const int threadIndex)
+            {
+                try
+                {
+                    renderRows(threadIndex * rowsPerThread, fastMin(numberRows, (threadIndex+1) * rowsPerThread));
+                }
+                catch (const std::exception&)
+                {
+                    exceptionPtrs[threadIndex] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            threads.reserve(numberThreads-1);
+            for (auto threadIndex = 1 ; threadIndex < numberThreads ; threadIndex++)
+                threads.emplace_back(renderBlock, threadIndex);
+            renderBlock(0);
+            for (auto& thread : threads)
+                thread.join();
+            for (const auto& exceptionPtr : exceptionPtrs)
+                if (exceptionPtr)
+                    std::rethrow_exception(exceptionPtr);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    // targetRow[x] = sum_i(rowWeights[i] * sourcePtr[rowIndexes[i]*width + x]) (vertical pass of the interpolation)
+    inline void interpolateRows(
+        float* targetRow, const float* const sourcePtr, const int width, const int* const rowIndexes,
+        const float* const rowWeights, const int numberTaps)
+    {
+        auto x = 0;
+        #ifdef WITH_AVX
+            for (; x < width-7 ; x += 8)
+            {
+                __m256 output = _mm256_setzero_ps();
+                for (auto i = 0 ; i < numberTaps ; i++)
+                    output = _mm256_fmadd_ps(
+                        _mm256_set1_ps(rowWeights[i]), _mm256_loadu_ps(&sourcePtr[rowIndexes[i]*width + x]), output);
+                _mm256_storeu_ps(&targetRow[x], output);
+            }
+        #endif
+        for (; x < width ; x++)
+        {
+            targetRow[x] = 0.f;
+            for (auto i = 0 ; i < numberTaps ; i++)
+                targetRow[x] += rowWeights[i] * sourcePtr[rowIndexes[i]*width + x];
+        }
+    }
+
+    // Horizontal pass of the interpolation
+    inline void interpolateColumns(
+        float* targetRow, const float* const sourceRow, const int targetWidth, const std::vector<int>& columnIndexes,
+        const std::vector<float>& columnWeights, const int numberTaps)
+    {
+        for (auto x = 0 ; x < targetWidth ; x++)
+        {
+            const auto* const indexes = &columnIndexes[numberTaps*x];
+            const auto* const weights = &columnWeights[numberTaps*x];
+            auto value = 0.f;
+            for (auto i = 0 ; i < numberTaps ; i++)
+                value += weights[i] * sourceRow[indexes[i]];
+            targetRow[x] = value;
+        }
+    }
+
+    // Branch-less version of getColorHeatMap() in renderPose.cu (output in BGR order)
+    inline void getColorHeatMapRow(
+        float* colorRow, const float* const valueRow, const int width, const float scale, const float offset)
+    {
+        auto x = 0;
+        #ifdef WITH_AVX
+            const __m256 mmScale = _mm256_set1_ps(scale);
+            const __m256 mmOffset = _mm256_set1_ps(offset);
+            const __m256 mmZero = _mm256_setzero_ps();
+            const __m256 mmOne = _mm256_set1_ps(1.f);
+            const __m256 mmFour = _mm256_set1_ps(4.f);
+            const __m256 mm256 = _mm256_set1_ps(256.f);
+            const __m256 mm255 = _mm256_set1_ps(255.f);
+            float blues[8];
+            float greens[8];
+            float reds[8];
+            for (; x < width-7 ; x += 8)
+            {
+                const __m256 value = _mm256_min_ps(_mm256_max_ps(
+                    _mm256_fmadd_ps(_mm256_loadu_ps(&valueRow[x]), mmScale, mmOffset), mmZero), mmOne);
+                const __m256 value4 = _mm256_mul_ps(value, mmFour);
+                const __m256 blue = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(mm256, _mm256_min_ps(
+                    _mm256_sub_ps(value4, _mm256_set1_ps(1.5f)), _mm256_sub_ps(_mm256_set1_ps(4.5f), value4))),
+                    mmZero), mm255);
+                const __m256 green = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(mm256, _mm256_min_ps(
+                    _mm256_sub_ps(value4, _mm256_set1_ps(0.5f)), _mm256_sub_ps(_mm256_set1_ps(3.5f), value4))),
+                    mmZero), mm255);
+                const __m256 red = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(mm256, _mm256_min_ps(
+                    _mm256_add_ps(value4, _mm256_set1_ps(0.5f)), _mm256_sub_ps(_mm256_set1_ps(2.5f), value4))),
+                    mmZero), mm255);
+                _mm256_storeu_ps(blues, blue);
+                _mm256_storeu_ps(greens, green);
+                _mm256_storeu_ps(reds, red);
+                for (auto i = 0 ; i < 8 ; i++)
+                {
+                    colorRow[3*(x+i)] = blues[i];
+                    colorRow[3*(x+i)+1] = greens[i];
+                    colorRow[3*(x+i)+2] = reds[i];
+                }
+            }
+        #endif
+        for (; x < width ; x++)
+        {
+            const auto value4 = 4.f * fastTruncate(scale*valueRow[x] + offset);
+            colorRow[3*x] = fastTruncate(256.f * fastMin(value4 - 1.5f, 4.5f - value4), 0.f, 255.f);
+            colorRow[3*x+1] = fastTruncate(256.f * fastMin(value4 - 0.5f, 3.5f - value4), 0.f, 255.f);
+            colorRow[3*x+2] = fastTruncate(256.f * fastMin(value4 + 0.5f, 2.5f - value4), 0.f, 255.f);
+        }
+    }
+
+    // Same than getColorXYAffinity() in renderPose.cu, adding the result to colorPtr (in BGR order)
+    inline void addColorXYAffinity(float* colorPtr, const float x, const float y)
+    {
+        const auto RY = 15.f;
+        const auto YG =  6.f;
+        const auto GC =  4.f;
+        const auto CB = 11.f;
+        const auto BM = 13.f;
+        const auto MR =  6.f;
+        const auto summed = RY+YG+GC+CB+BM+MR;       // 55
+        const auto rad = fastMin(1.f, std::sqrt(x*x + y*y));
+        auto fk = (std::atan2(-y,-x) / PI + 1.f) / 2.f; // 0 to 1
+        if (std::isnan(fk))
+            fk = 0.f;
+        const auto vTrunc = fastTruncate(fk) * summed;
+        std::array<float, 3> rgb;
+        if (vTrunc < RY)
+            rgb = {{255.f,                              255.f*(vTrunc/(RY)),                0.f}};
+        else if (vTrunc < RY+YG)
+            rgb = {{255.f*(1-((vTrunc-RY)/(YG))),       255.f,                              0.f}};
+        else if (vTrunc < RY+YG+GC)
+            rgb = {{0.f,                                255.f,                              255.f*((vTrunc-RY-YG)/(GC))}};
+        else if (vTrunc < RY+YG+GC+CB)
+            rgb = {{0.f,                                255.f*(1-((vTrunc-RY-YG-GC)/(CB))), 255.f}};
+        else if (vTrunc < summed-MR)
+            rgb = {{255.f*((vTrunc-RY-YG-GC-CB)/(BM)),  0.f,                                255.f}};
+        else if (vTrunc < summed)
+            rgb = {{255.f,                              0.f,                                255.f*(1-((vTrunc-RY-YG-GC-CB-BM)/(MR)))}};
+        else
+            rgb = {{255.f,                              0.f,                                0.f}};
+        colorPtr[0] += rad*rgb[2];
+        colorPtr[1] += rad*rgb[1];
+        colorPtr[2] += rad*rgb[0];
+    }
+
+    // frameRow = alpha * colorRow + (1 - alpha) * frameRow
+    inline void blendRow(float* frameRow, const float* const colorRow, const int volume, const float alphaBlending)
+    {
+        auto i = 0;
+        #ifdef WITH_AVX
+            const __m256 mmAlpha = _mm256_set1_ps(alphaBlending);
+            for (; i < volume-7 ; i += 8)
+            {
+                const __m256 frame = _mm256_loadu_ps(&frameRow[i]);
+                _mm256_storeu_ps(
+                    &frameRow[i], _mm256_fmadd_ps(mmAlpha, _mm256_sub_ps(_mm256_loadu_ps(&colorRow[i]), frame), frame));
+            }
+        #endif
+        for (; i < volume ; i++)
+            frameRow[i] += alphaBlending * (colorRow[i] - frameRow[i]);
+    }
+
     void renderPoseKeypointsCpu(Array<float>& frameArray, const Array<float>& poseKeypoints, const PoseModel poseModel,
                                 const float renderThreshold, const bool blendOriginalFrame)
     {
@@ -32,4 +322,240 @@ namespace op
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
+
+    void renderPoseHeatMapCpu(
+        Array<float>& frameArray, const float* const heatMapPtr, const Point<int>& heatMapSize,
+        const float scaleToKeepRatio, const float alphaBlending, const ScaleMode heatMapScaleMode)
+    {
+        try
+        {
+            checkAlpha(alphaBlending);
+            if (!frameArray.empty())
+            {
+                // Bicubic interpolation taps
+                const auto width = frameArray.getSize(1);
+                const auto height = frameArray.getSize(0);
+                std::vector<int> xIndexes, yIndexes;
+                std::vector<float> xWeights, yWeights;
+                getInterpolationTaps(xIndexes, xWeights, 4, width, heatMapSize.x, scaleToKeepRatio);
+                getInterpolationTaps(yIndexes, yWeights, 4, height, heatMapSize.y, scaleToKeepRatio);
+                const auto normalization = getHeatMapNormalization(heatMapScaleMode, false);
+                // Render
+                auto* framePtr = frameArray.getPtr();
+                parallelForRows(height, [&](const int yBegin, const int yEnd)
+                {
+                    std::vector<float> heatMapRow(heatMapSize.x);
+                    std::vector<float> valueRow(width);
+                    std::vector<float> colorRow(3*width);
+                    for (auto y = yBegin ; y < yEnd ; y++)
+                    {
+                        interpolateRows(
+                            heatMapRow.data(), heatMapPtr, heatMapSize.x, &yIndexes[4*y], &yWeights[4*y], 4);
+                        interpolateColumns(valueRow.data(), heatMapRow.data(), width, xIndexes, xWeights, 4);
+                        getColorHeatMapRow(
+                            colorRow.data(), valueRow.data(), width, normalization.first, normalization.second);
+                        blendRow(&framePtr[3*width*y], colorRow.data(), 3*width, alphaBlending);
+                    }
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void renderPoseHeatMapsCpu(
+        Array<float>& frameArray, const PoseModel poseModel, const float* const heatMapPtr,
+        const Point<int>& heatMapSize, const float scaleToKeepRatio, const float alphaBlending,
+        const ScaleMode heatMapScaleMode)
+    {
+        try
+        {
+            checkAlpha(alphaBlending);
+            if (!frameArray.empty())
+            {
+                // Nearest neighbor taps
+                const auto width = frameArray.getSize(1);
+                const auto height = frameArray.getSize(0);
+                const auto xIndexes = getNearestTaps(width, heatMapSize.x, scaleToKeepRatio);
+                const auto yIndexes = getNearestTaps(height, heatMapSize.y, scaleToKeepRatio);
+                const auto normalization = getHeatMapNormalization(heatMapScaleMode, false);
+                const auto numberBodyParts = (int)getPoseNumberBodyParts(poseModel);
+                const auto& colors = getPoseColors(PoseModel::COCO_18);
+                const auto numberColors = (int)colors.size()/3;
+                const auto heatMapArea = heatMapSize.area();
+                // Render
+                auto* framePtr = frameArray.getPtr();
+                parallelForRows(height, [&](const int yBegin, const int yEnd)
+                {
+                    // Colors are accumulated at heat map resolution, and then resized
+                    std::vector<std::vector<float>> rgbRows(3, std::vector<float>(heatMapSize.x));
+                    std::vector<float> colorRow(3*width);
+                    auto yHeatMapPrevious = -1;
+                    for (auto y = yBegin ; y < yEnd ; y++)
+                    {
+                        const auto yHeatMap = yIndexes[y];
+                        // Re-use the previous row if it comes from the same heat map row
+                        if (yHeatMap != yHeatMapPrevious)
+                        {
+                            yHeatMapPrevious = yHeatMap;
+                            for (auto& rgbRow : rgbRows)
+                                std::fill(rgbRow.begin(), rgbRow.end(), 0.f);
+                            for (auto part = 0 ; part < numberBodyParts ; part++)
+                            {
+                                const auto* const heatMapRow = heatMapPtr + part*heatMapArea + yHeatMap*heatMapSize.x;
+                                const auto* const color = &colors[3*(part%numberColors)];
+                                auto x = 0;
+                                #ifdef WITH_AVX
+                                    const __m256 mmScale = _mm256_set1_ps(normalization.first);
+                                    const __m256 mmOffset = _mm256_set1_ps(normalization.second);
+                                    const __m256 mmZero = _mm256_setzero_ps();
+                                    const __m256 mmOne = _mm256_set1_ps(1.f);
+                                    for (; x < heatMapSize.x-7 ; x += 8)
+                                    {
+                                        const __m256 value = _mm256_min_ps(_mm256_max_ps(_mm256_fmadd_ps(
+                                            _mm256_loadu_ps(&heatMapRow[x]), mmScale, mmOffset), mmZero), mmOne);
+                                        for (auto c = 0 ; c < 3 ; c++)
+                                            _mm256_storeu_ps(&rgbRows[c][x], _mm256_fmadd_ps(
+                                                value, _mm256_set1_ps(color[c]), _mm256_loadu_ps(&rgbRows[c][x])));
+                                    }
+                                #endif
+                                for (; x < heatMapSize.x ; x++)
+                                {
+                                    const auto value = fastTruncate(
+                                        normalization.first*heatMapRow[x] + normalization.second);
+                                    for (auto c = 0 ; c < 3 ; c++)
+                                        rgbRows[c][x] += value*color[c];
+                                }
+                            }
+                        }
+                        // Resize (RGB to BGR)
+                        for (auto x = 0 ; x < width ; x++)
+                        {
+                            const auto xHeatMap = xIndexes[x];
+                            colorRow[3*x] = rgbRows[2][xHeatMap];
+                            colorRow[3*x+1] = rgbRows[1][xHeatMap];
+                            colorRow[3*x+2] = rgbRows[0][xHeatMap];
+                        }
+                        blendRow(&framePtr[3*width*y], colorRow.data(), 3*width, alphaBlending);
+                    }
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void renderPosePAFCpu(
+        Array<float>& frameArray, const float* const heatMapPtr, const Point<int>& heatMapSize,
+        const float scaleToKeepRatio, const float alphaBlending, const ScaleMode heatMapScaleMode)
+    {
+        try
+        {
+            checkAlpha(alphaBlending);
+            if (!frameArray.empty())
+            {
+                // Bilinear interpolation taps
+                const auto width = frameArray.getSize(1);
+                const auto height = frameArray.getSize(0);
+                std::vector<int> xIndexes, yIndexes;
+                std::vector<float> xWeights, yWeights;
+                getInterpolationTaps(xIndexes, xWeights, 2, width, heatMapSize.x, scaleToKeepRatio);
+                getInterpolationTaps(yIndexes, yWeights, 2, height, heatMapSize.y, scaleToKeepRatio);
+                const auto normalization = getHeatMapNormalization(heatMapScaleMode, true);
+                const auto* const heatMapPtrY = heatMapPtr + heatMapSize.area();
+                // Render
+                auto* framePtr = frameArray.getPtr();
+                parallelForRows(height, [&](const int yBegin, const int yEnd)
+                {
+                    std::vector<float> heatMapRowX(heatMapSize.x);
+                    std::vector<float> heatMapRowY(heatMapSize.x);
+                    std::vector<float> valueRowX(width);
+                    std::vector<float> valueRowY(width);
+                    std::vector<float> colorRow(3*width);
+                    for (auto y = yBegin ; y < yEnd ; y++)
+                    {
+                        interpolateRows(
+                            heatMapRowX.data(), heatMapPtr, heatMapSize.x, &yIndexes[2*y], &yWeights[2*y], 2);
+                        interpolateRows(
+                            heatMapRowY.data(), heatMapPtrY, heatMapSize.x, &yIndexes[2*y], &yWeights[2*y], 2);
+                        interpolateColumns(valueRowX.data(), heatMapRowX.data(), width, xIndexes, xWeights, 2);
+                        interpolateColumns(valueRowY.data(), heatMapRowY.data(), width, xIndexes, xWeights, 2);
+                        std::fill(colorRow.begin(), colorRow.end(), 0.f);
+                        for (auto x = 0 ; x < width ; x++)
+                            addColorXYAffinity(
+                                &colorRow[3*x], normalization.first*valueRowX[x] + normalization.second,
+                                normalization.first*valueRowY[x] + normalization.second);
+                        blendRow(&framePtr[3*width*y], colorRow.data(), 3*width, alphaBlending);
+                    }
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void renderPosePAFsCpu(
+        Array<float>& frameArray, const PoseModel poseModel, const float* const heatMapPtr,
+        const Point<int>& heatMapSize, const float scaleToKeepRatio, const float alphaBlending,
+        const ScaleMode heatMapScaleMode)
+    {
+        try
+        {
+            checkAlpha(alphaBlending);
+            if (!frameArray.empty())
+            {
+                // Nearest neighbor taps
+                const auto width = frameArray.getSize(1);
+                const auto height = frameArray.getSize(0);
+                const auto xIndexes = getNearestTaps(width, heatMapSize.x, scaleToKeepRatio);
+                const auto yIndexes = getNearestTaps(height, heatMapSize.y, scaleToKeepRatio);
+                const auto normalization = getHeatMapNormalization(heatMapScaleMode, true);
+                const auto numberPAFChannels = (int)getPosePartPairs(poseModel).size();
+                const auto heatMapArea = heatMapSize.area();
+                // Render
+                auto* framePtr = frameArray.getPtr();
+                parallelForRows(height, [&](const int yBegin, const int yEnd)
+                {
+                    // Colors are accumulated at heat map resolution (BGR order), and then resized
+                    std::vector<float> bgrRow(3*heatMapSize.x);
+                    std::vector<float> colorRow(3*width);
+                    auto yHeatMapPrevious = -1;
+                    for (auto y = yBegin ; y < yEnd ; y++)
+                    {
+                        const auto yHeatMap = yIndexes[y];
+                        // Re-use the previous row if it comes from the same heat map row
+                        if (yHeatMap != yHeatMapPrevious)
+                        {
+                            yHeatMapPrevious = yHeatMap;
+                            std::fill(bgrRow.begin(), bgrRow.end(), 0.f);
+                            for (auto channel = 0 ; channel < numberPAFChannels ; channel += 2)
+                            {
+                                const auto* const heatMapRowX = heatMapPtr + channel*heatMapArea
+                                                              + yHeatMap*heatMapSize.x;
+                                const auto* const heatMapRowY = heatMapRowX + heatMapArea;
+                                for (auto x = 0 ; x < heatMapSize.x ; x++)
+                                    addColorXYAffinity(
+                                        &bgrRow[3*x], normalization.first*heatMapRowX[x] + normalization.second,
+                                        normalization.first*heatMapRowY[x] + normalization.second);
+                            }
+                        }
+                        // Resize
+                        for (auto x = 0 ; x < width ; x++)
+                            std::copy(&bgrRow[3*xIndexes[x]], &bgrRow[3*xIndexes[x]+3], &colorRow[3*x]);
+                        blendRow(&framePtr[3*width*y], colorRow.data(), 3*width, alphaBlending);
+                    }
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
 }
@@ -1,4 +1,5 @@
 #include <openpose/producer/datumProducer.hpp>
+#include <openpose/producer/netOutputReader.hpp>
 #include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
 
 namespace op
@@ -23,7 +24,8 @@ namespace op
             // Set frame first and step
             if (producerSharedPtr->getType() != ProducerType::FlirCamera
                 && producerSharedPtr->getType() != ProducerType::IPCamera
-                && producerSharedPtr->getType() != ProducerType::Webcam)
+                && producerSharedPtr->getType() != ProducerType::Webcam
+                && producerSharedPtr->getType() != ProducerType::MultiStream)
             {
                 // Frame first
                 producerSharedPtr->set(CV_CAP_PROP_POS_FRAMES, (double)frameFirst);
@@ -142,4 +144,18 @@ namespace op
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
+
+    Array<float> datumProducerConstructorRunningAndGetDatumNetOutput(
+        const std::shared_ptr<Producer>& producerSharedPtr)
+    {
+        try
+        {
+            return std::static_pointer_cast<NetOutputReader>(producerSharedPtr)->getNetOutput();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
 }
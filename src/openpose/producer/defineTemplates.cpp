@@ -2,6 +2,7 @@
 
 namespace op
 {
+    template class OP_API DatumPool<BASE_DATUM>;
     template class OP_API DatumProducer<BASE_DATUM>;
     template class OP_API WDatumProducer<BASE_DATUM>;
 }
@@ -0,0 +1,442 @@
+#include <openpose/producer/multiStreamReader.hpp>
+#include <cmath> // std::round
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <openpose/utilities/fileSystem.hpp>
+#include <openpose/utilities/string.hpp>
+#include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+
+namespace op
+{
+    struct MultiStreamReader::ImplMultiStreamReader
+    {
+        struct Stream
+        {
+            std::shared_ptr<Producer> spProducer;
+            bool isLive;
+            // Protected by mMutex
+            Matrix nextFrame;
+            Matrix lastFrame;
+            bool isClosed;
+            // Black frame filling its view while it has no frame to be repeated (i.e., before its first frame or once
+            // it ended)
+            Matrix blackFrame;
+            bool isBlackLogged;
+            std::string captureError;
+            // Stats
+            unsigned long long capturedFrames;
+            unsigned long long usedFrames;
+            unsigned long long droppedFrames;
+            unsigned long long repeatedFrames;
+            unsigned long long blackFrames;
+        };
+
+        const std::chrono::microseconds mStreamTimeout;
+        std::vector<Stream> mStreams;
+        std::mutex mMutex;
+        std::condition_variable mConditionFrameAdded;
+        std::condition_variable mConditionFrameRemoved;
+        bool mIsRunning;
+        std::vector<std::thread> mCaptureThreads;
+        std::chrono::steady_clock::time_point mStartTime;
+        bool mStatsLogged;
+
+        ImplMultiStreamReader(const std::vector<std::shared_ptr<Producer>>& producers, const double streamTimeoutMs) :
+            mStreamTimeout{(long long)std::round(1e3 * streamTimeoutMs)},
+            mIsRunning{true},
+            mStartTime{std::chrono::steady_clock::now()},
+            mStatsLogged{false}
+        {
+            for (const auto& producer : producers)
+            {
+                const auto type = (producer != nullptr ? producer->getType() : ProducerType::None);
+                const auto isLive = (type == ProducerType::IPCamera || type == ProducerType::Webcam
+                                     || type == ProducerType::FlirCamera);
+                mStreams.emplace_back(Stream{
+                    producer, isLive, Matrix(), Matrix(), false, Matrix(), false, "", 0ull, 0ull, 0ull, 0ull, 0ull});
+            }
+        }
+
+        // All the frames of a stream are read on its own thread, so slow or blocking sources (e.g., IP cameras) do
+        // not delay the other streams
+        void captureThread(const unsigned long long streamIndex)
+        {
+            // No error() calls in here: an exception thrown on this thread would terminate the program, so it only
+            // closes this stream (and it is logged by logStats())
+            auto& stream = mStreams[streamIndex];
+            try
+            {
+                while (true)
+                {
+                    // Videos and images: wait until the previous frame is consumed (no frames are dropped)
+                    {
+                        std::unique_lock<std::mutex> lock{mMutex};
+                        mConditionFrameRemoved.wait(
+                            lock, [this, &stream]{ return !mIsRunning || stream.isLive || stream.nextFrame.empty(); });
+                        if (!mIsRunning)
+                            break;
+                    }
+                    auto frame = stream.spProducer->getFrame();
+                    if (frame.empty())
+                    {
+                        if (!stream.spProducer->isOpened())
+                        {
+                            std::lock_guard<std::mutex> lock{mMutex};
+                            stream.isClosed = true;
+                            mConditionFrameAdded.notify_all();
+                            break;
+                        }
+                        // Open but no frame yet (e.g., an IP camera reconnecting): back off rather than busy-waiting
+                        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock{mMutex};
+                        // Live streams: only the latest frame is kept
+                        if (!stream.nextFrame.empty())
+                            stream.droppedFrames++;
+                        stream.nextFrame = frame;
+                        stream.capturedFrames++;
+                        mConditionFrameAdded.notify_all();
+                    }
+                }
+            }
+            catch (const std::exception& e)
+            {
+                std::lock_guard<std::mutex> lock{mMutex};
+                stream.captureError = e.what();
+                stream.isClosed = true;
+                mConditionFrameAdded.notify_all();
+            }
+        }
+
+        // Every open stream has a new frame
+        bool allStreamsReady() const
+        {
+            for (const auto& stream : mStreams)
+                if (stream.nextFrame.empty() && !stream.isClosed)
+                    return false;
+            return true;
+        }
+
+        // At least 1 new frame (the streams without it repeat their last frame, or use a black one if they have not
+        // delivered any yet)
+        bool someStreamsReady() const
+        {
+            for (const auto& stream : mStreams)
+                if (!stream.nextFrame.empty())
+                    return true;
+            return false;
+        }
+
+        void stopThreads()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mMutex};
+                mIsRunning = false;
+            }
+            mConditionFrameAdded.notify_all();
+            mConditionFrameRemoved.notify_all();
+            for (auto& captureThread : mCaptureThreads)
+                if (captureThread.joinable())
+                    captureThread.join();
+            mCaptureThreads.clear();
+        }
+
+        void logStats()
+        {
+            if (!mStatsLogged)
+            {
+                mStatsLogged = true;
+                const auto seconds = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - mStartTime).count();
+                for (auto i = 0u ; i < mStreams.size() ; i++)
+                {
+                    const auto& stream = mStreams[i];
+                    opLog("Stream " + std::to_string(i) + ": " + std::to_string(stream.capturedFrames)
+                          + " frames captured, " + std::to_string(stream.usedFrames) + " processed ("
+                          + std::to_string(seconds > 0. ? stream.usedFrames / seconds : 0.) + " fps), "
+                          + std::to_string(stream.droppedFrames) + " dropped, "
+                          + std::to_string(stream.repeatedFrames) + " repeated, "
+                          + std::to_string(stream.blackFrames) + " black."
+                          + (stream.captureError.empty() ? "" : " Capture failed: " + stream.captureError),
+                          Priority::High);
+                }
+            }
+        }
+    };
+
+    MultiStreamReader::MultiStreamReader(
+        const std::vector<std::shared_ptr<Producer>>& producers, const double streamTimeoutMs) :
+        Producer{ProducerType::MultiStream, "", false, (int)producers.size()},
+        upImpl{new ImplMultiStreamReader{producers, streamTimeoutMs}},
+        mFrameNameCounter{0ull}
+    {
+        try
+        {
+            // Sanity checks
+            if (producers.empty())
+                error("At least 1 stream must be given.", __LINE__, __FUNCTION__, __FILE__);
+            if (streamTimeoutMs <= 0.)
+                error("The stream timeout must be > 0 ms.", __LINE__, __FUNCTION__, __FILE__);
+            for (auto i = 0u ; i < producers.size() ; i++)
+            {
+                if (producers[i] == nullptr || !producers[i]->isOpened())
+                    error("Stream " + std::to_string(i) + " could not be opened.", __LINE__, __FUNCTION__, __FILE__);
+                if (producers[i]->get(ProducerProperty::NumberViews) > 1.)
+                    error("Each stream must return a single view (stream " + std::to_string(i) + ").",
+                          __LINE__, __FUNCTION__, __FILE__);
+            }
+            // Start capture threads
+            for (auto i = 0u ; i < producers.size() ; i++)
+                upImpl->mCaptureThreads.emplace_back(
+                    std::thread{&ImplMultiStreamReader::captureThread, upImpl.get(), (unsigned long long)i});
+            opLog("Multi-stream reader started with " + std::to_string(producers.size()) + " streams.",
+                  Priority::High);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    MultiStreamReader::~MultiStreamReader()
+    {
+        try
+        {
+            upImpl->stopThreads();
+            upImpl->logStats();
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    std::string MultiStreamReader::getNextFrameName()
+    {
+        try
+        {
+            const auto stringLength = 12u;
+            return toFixedLengthString(mFrameNameCounter, stringLength);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    bool MultiStreamReader::isOpened() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            if (upImpl->mIsRunning)
+                for (const auto& stream : upImpl->mStreams)
+                    if (!stream.isClosed || !stream.nextFrame.empty())
+                        return true;
+            return false;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void MultiStreamReader::release()
+    {
+        try
+        {
+            upImpl->stopThreads();
+            for (auto& stream : upImpl->mStreams)
+                stream.spProducer->release();
+            upImpl->logStats();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    double MultiStreamReader::get(const int capProperty)
+    {
+        try
+        {
+            // Each stream might have a different resolution and frame rate
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH || capProperty == CV_CAP_PROP_FRAME_HEIGHT
+                || capProperty == CV_CAP_PROP_FPS)
+                return -1.;
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                return (double)mFrameNameCounter;
+            else if (capProperty == CV_CAP_PROP_FRAME_COUNT)
+                return -1.;
+            else
+            {
+                opLog("Unknown property", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+                return -1.;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0.;
+        }
+    }
+
+    void MultiStreamReader::set(const int capProperty, const double value)
+    {
+        try
+        {
+            UNUSED(value);
+            if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                opLog("Seeking is not supported with multiple streams.", Priority::Max,
+                      __LINE__, __FUNCTION__, __FILE__);
+            else if (capProperty == CV_CAP_PROP_FRAME_WIDTH || capProperty == CV_CAP_PROP_FRAME_HEIGHT
+                     || capProperty == CV_CAP_PROP_FRAME_COUNT || capProperty == CV_CAP_PROP_FPS)
+                opLog("This property is read-only.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+            else
+                opLog("Unknown property", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Matrix MultiStreamReader::getRawFrame()
+    {
+        try
+        {
+            const auto frames = getRawFrames();
+            return (frames.empty() ? Matrix() : frames[0]);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Matrix();
+        }
+    }
+
+    std::vector<Matrix> MultiStreamReader::getRawFrames()
+    {
+        try
+        {
+            auto& streams = upImpl->mStreams;
+            std::unique_lock<std::mutex> lock{upImpl->mMutex};
+            // Wait for a new frame of all the streams. After the timeout, slower streams repeat their last frame
+            const auto isRunningAndAllReady = [this]{ return !upImpl->mIsRunning || upImpl->allStreamsReady(); };
+            if (!upImpl->mConditionFrameAdded.wait_for(lock, upImpl->mStreamTimeout, isRunningAndAllReady))
+                upImpl->mConditionFrameAdded.wait(
+                    lock, [this]{ return !upImpl->mIsRunning || upImpl->allStreamsReady()
+                                         || upImpl->someStreamsReady(); });
+            // All streams closed (or reader released)
+            auto newFrames = false;
+            for (const auto& stream : streams)
+                newFrames |= !stream.nextFrame.empty();
+            if (!upImpl->mIsRunning || !newFrames)
+                return {};
+            // Producer::getFrames() rotates and flips the frames in place, so the frame kept for repetition must be
+            // a copy
+            const auto modifiedInPlace = (Producer::get(ProducerProperty::Flip) == 1.
+                                          || Producer::get(ProducerProperty::Rotation) != 0.);
+            // Size of the black frames of the streams that have not delivered any frame yet
+            Matrix referenceFrame;
+            for (const auto& stream : streams)
+                if (referenceFrame.empty() && !stream.nextFrame.empty())
+                    referenceFrame = stream.nextFrame;
+            // Each stream always keeps the same view index (so each output file keeps the same stream)
+            std::vector<Matrix> frames(streams.size());
+            for (auto i = 0u ; i < streams.size() ; i++)
+            {
+                auto& stream = streams[i];
+                if (!stream.nextFrame.empty())
+                {
+                    frames[i] = stream.nextFrame;
+                    stream.lastFrame = (modifiedInPlace ? stream.nextFrame.clone() : stream.nextFrame);
+                    stream.nextFrame = Matrix();
+                    stream.usedFrames++;
+                }
+                // Open streams without a new frame repeat their last one
+                else if (!stream.isClosed && !stream.lastFrame.empty())
+                {
+                    frames[i] = (modifiedInPlace ? stream.lastFrame.clone() : stream.lastFrame);
+                    stream.repeatedFrames++;
+                }
+                // Streams that ended (all their frames already consumed) or that have not delivered any frame yet
+                // (after the stream timeout) are filled with a black frame of their same size
+                else
+                {
+                    if (stream.blackFrame.empty())
+                    {
+                        const auto& sizeFrame = (stream.lastFrame.empty() ? referenceFrame : stream.lastFrame);
+                        stream.blackFrame = Matrix(sizeFrame.rows(), sizeFrame.cols(), sizeFrame.type());
+                        stream.blackFrame.setTo(0.);
+                    }
+                    if (stream.isClosed)
+                        stream.lastFrame = Matrix();
+                    if (!stream.isBlackLogged)
+                    {
+                        stream.isBlackLogged = true;
+                        opLog("Stream " + std::to_string(i) + (stream.isClosed
+                              ? " ended, its view is filled with black frames until all the streams end."
+                              : " has not delivered any frame yet, its view is filled with black frames meanwhile.")
+                              + (stream.captureError.empty() ? "" : " Capture error: " + stream.captureError),
+                              Priority::High);
+                    }
+                    frames[i] = (modifiedInPlace ? stream.blackFrame.clone() : stream.blackFrame);
+                    stream.blackFrames++;
+                }
+                // First frame of a stream that was filled with black frames
+                if (!stream.lastFrame.empty() && !stream.isClosed && !stream.blackFrame.empty())
+                {
+                    stream.blackFrame = Matrix();
+                    stream.isBlackLogged = false;
+                }
+            }
+            lock.unlock();
+            upImpl->mConditionFrameRemoved.notify_all();
+            mFrameNameCounter++;
+            return frames;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    std::vector<std::shared_ptr<Producer>> createMultiStreamProducers(
+        const std::string& multiStreamString, const Point<int>& cameraResolution)
+    {
+        try
+        {
+            std::vector<std::shared_ptr<Producer>> producers;
+            for (const auto& source : splitString(multiStreamString, ","))
+            {
+                if (source.empty())
+                    continue;
+                ProducerType producerType;
+                if (source.find("://") != std::string::npos)
+                    producerType = ProducerType::IPCamera;
+                else if (source.find_first_not_of("0123456789") == std::string::npos)
+                    producerType = ProducerType::Webcam;
+                else if (existDirectory(source))
+                    producerType = ProducerType::ImageDirectory;
+                else
+                    producerType = ProducerType::Video;
+                // Streams are not undistorted (no camera parameters per stream)
+                producers.emplace_back(createProducer(producerType, source, cameraResolution, "", false, 1));
+            }
+            return producers;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+}
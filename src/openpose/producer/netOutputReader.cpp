@@ -0,0 +1,269 @@
+#include <openpose/producer/netOutputReader.hpp>
+#include <cstdint> // uint32_t, int32_t, uint64_t
+#include <cstring> // std::memcmp
+#include <fstream> // std::ifstream
+#include <openpose/filestream/netOutputSaver.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+
+namespace op
+{
+    struct NetOutputRecordIndex
+    {
+        std::streamoff offset;
+        unsigned long long frameNumber;
+        std::string name;
+        Point<int> inputResolution;
+    };
+
+    struct NetOutputReader::ImplNetOutputReader
+    {
+        const std::string mNetOutputPath;
+        std::ifstream mIfstream;
+        std::vector<NetOutputRecordIndex> mRecordIndexes;
+        Point<int> mResolution;
+        Array<float> mNetOutput;
+
+        explicit ImplNetOutputReader(const std::string& netOutputPath) :
+            mNetOutputPath{netOutputPath},
+            mIfstream{netOutputPath, std::ios::in | std::ios::binary}
+        {
+        }
+    };
+
+    template<typename T>
+    T readNetOutputBinary(std::ifstream& ifstream)
+    {
+        T value;
+        ifstream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        return value;
+    }
+
+    std::vector<int> readNetOutputSize(std::ifstream& ifstream)
+    {
+        std::vector<int> size(readNetOutputBinary<uint32_t>(ifstream));
+        for (auto& sizeI : size)
+            sizeI = readNetOutputBinary<int32_t>(ifstream);
+        return size;
+    }
+
+    void readNetOutputRecordMetadata(std::ifstream& ifstream, NetOutputRecord& netOutputRecord)
+    {
+        try
+        {
+            netOutputRecord.frameNumber = readNetOutputBinary<uint64_t>(ifstream);
+            netOutputRecord.name.resize(readNetOutputBinary<uint32_t>(ifstream));
+            if (!netOutputRecord.name.empty())
+                ifstream.read(&netOutputRecord.name[0], netOutputRecord.name.size());
+            netOutputRecord.inputResolution.x = readNetOutputBinary<int32_t>(ifstream);
+            netOutputRecord.inputResolution.y = readNetOutputBinary<int32_t>(ifstream);
+            netOutputRecord.netInputSize = readNetOutputSize(ifstream);
+            netOutputRecord.scaleInputToNetInput = readNetOutputBinary<double>(ifstream);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    NetOutputReader::NetOutputReader(const std::string& netOutputPath) :
+        Producer{ProducerType::NetOutput, "", false, 1},
+        upImpl{new ImplNetOutputReader{netOutputPath}},
+        mFrameNameCounter{0ll}
+    {
+        try
+        {
+            auto& ifstream = upImpl->mIfstream;
+            if (!ifstream.is_open())
+                error("Net output file `" + netOutputPath + "` could not be opened.", __LINE__, __FUNCTION__, __FILE__);
+            // Header
+            char magic[sizeof(NET_OUTPUT_FILE_MAGIC) - 1];
+            ifstream.read(magic, sizeof(magic));
+            const auto version = readNetOutputBinary<uint32_t>(ifstream);
+            if (!ifstream.good() || std::memcmp(magic, NET_OUTPUT_FILE_MAGIC, sizeof(magic)) != 0)
+                error("`" + netOutputPath + "` is not a net output file (recorded with `--write_net_output`).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (version != NET_OUTPUT_FILE_VERSION)
+                error("Net output file version " + std::to_string(version) + " not supported (expected "
+                      + std::to_string(NET_OUTPUT_FILE_VERSION) + ").", __LINE__, __FUNCTION__, __FILE__);
+            // Index all records (skipping their net output data)
+            while (ifstream.peek() != std::ifstream::traits_type::eof())
+            {
+                NetOutputRecordIndex recordIndex;
+                recordIndex.offset = ifstream.tellg();
+                NetOutputRecord netOutputRecord;
+                readNetOutputRecordMetadata(ifstream, netOutputRecord);
+                const auto netOutputSize = readNetOutputSize(ifstream);
+                auto netOutputVolume = (netOutputSize.empty() ? 0ll : 1ll);
+                for (const auto& sizeI : netOutputSize)
+                    netOutputVolume *= sizeI;
+                ifstream.seekg(netOutputVolume * (long long)sizeof(float), std::ios::cur);
+                if (!ifstream.good())
+                    error("Net output file `" + netOutputPath + "` is truncated or corrupted (record "
+                          + std::to_string(upImpl->mRecordIndexes.size()) + ").", __LINE__, __FUNCTION__, __FILE__);
+                recordIndex.frameNumber = netOutputRecord.frameNumber;
+                recordIndex.name = netOutputRecord.name;
+                recordIndex.inputResolution = netOutputRecord.inputResolution;
+                upImpl->mRecordIndexes.emplace_back(recordIndex);
+            }
+            ifstream.clear();
+            // Sanity check
+            if (upImpl->mRecordIndexes.empty())
+                error("No frames were found on " + netOutputPath, __LINE__, __FUNCTION__, __FILE__);
+            upImpl->mResolution = upImpl->mRecordIndexes[0].inputResolution;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    NetOutputReader::~NetOutputReader()
+    {
+    }
+
+    std::string NetOutputReader::getNextFrameName()
+    {
+        try
+        {
+            return upImpl->mRecordIndexes.at(mFrameNameCounter).name;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return "";
+        }
+    }
+
+    Array<float> NetOutputReader::getNetOutput()
+    {
+        try
+        {
+            Array<float> netOutput;
+            std::swap(netOutput, upImpl->mNetOutput);
+            return netOutput;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Array<float>{};
+        }
+    }
+
+    void NetOutputReader::release()
+    {
+        try
+        {
+            mFrameNameCounter = {-1ll};
+            upImpl->mNetOutput.reset();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    Matrix NetOutputReader::getRawFrame()
+    {
+        try
+        {
+            // Read net output
+            const auto& recordIndex = upImpl->mRecordIndexes.at(mFrameNameCounter++);
+            auto& ifstream = upImpl->mIfstream;
+            ifstream.seekg(recordIndex.offset);
+            NetOutputRecord netOutputRecord;
+            readNetOutputRecordMetadata(ifstream, netOutputRecord);
+            upImpl->mNetOutput.reset(readNetOutputSize(ifstream));
+            ifstream.read(reinterpret_cast<char*>(upImpl->mNetOutput.getPtr()),
+                          upImpl->mNetOutput.getVolume() * sizeof(float));
+            if (!ifstream.good())
+                error("Net output of frame " + std::to_string(recordIndex.frameNumber) + " could not be read.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            // Skip frames if frame step > 1
+            const auto frameStep = Producer::get(ProducerProperty::FrameStep);
+            if (frameStep > 1)
+                set(CV_CAP_PROP_POS_FRAMES, mFrameNameCounter + frameStep-1);
+            // Black frame with the recorded input resolution (so the input-to-net scale is the recorded one)
+            upImpl->mResolution = recordIndex.inputResolution;
+            Matrix frame(upImpl->mResolution.y, upImpl->mResolution.x, CV_8UC3);
+            frame.setTo(0.);
+            return frame;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return Matrix();
+        }
+    }
+
+    std::vector<Matrix> NetOutputReader::getRawFrames()
+    {
+        try
+        {
+            return std::vector<Matrix>{getRawFrame()};
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
+
+    double NetOutputReader::get(const int capProperty)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_FRAME_WIDTH)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.x;
+                else
+                    return upImpl->mResolution.y;
+            }
+            else if (capProperty == CV_CAP_PROP_FRAME_HEIGHT)
+            {
+                if (Producer::get(ProducerProperty::Rotation) == 0.
+                    || Producer::get(ProducerProperty::Rotation) == 180.)
+                    return upImpl->mResolution.y;
+                else
+                    return upImpl->mResolution.x;
+            }
+            else if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                return (double)mFrameNameCounter;
+            else if (capProperty == CV_CAP_PROP_FRAME_COUNT)
+                return (double)upImpl->mRecordIndexes.size();
+            else if (capProperty == CV_CAP_PROP_FPS)
+                return -1.;
+            else
+            {
+                opLog("Unknown property", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+                return -1.;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0.;
+        }
+    }
+
+    void NetOutputReader::set(const int capProperty, const double value)
+    {
+        try
+        {
+            if (capProperty == CV_CAP_PROP_POS_FRAMES)
+                mFrameNameCounter = fastTruncate(
+                    (long long)value, 0ll, (long long)upImpl->mRecordIndexes.size()-1);
+            else if (capProperty == CV_CAP_PROP_FRAME_WIDTH || capProperty == CV_CAP_PROP_FRAME_HEIGHT
+                     || capProperty == CV_CAP_PROP_FRAME_COUNT || capProperty == CV_CAP_PROP_FPS)
+                opLog("This property is read-only.", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+            else
+                opLog("Unknown property", Priority::Max, __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
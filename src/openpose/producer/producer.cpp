@@ -39,7 +39,8 @@ namespace op
             mProperties[(unsigned int)ProducerProperty::NumberViews] = numberViews;
             auto& mNumberViews = mProperties[(unsigned int)ProducerProperty::NumberViews];
             // Camera (distortion, intrinsic, and extrinsic) parameters
-            if (mType != ProducerType::FlirCamera)
+            // MultiStream: each view is an independent stream (no camera parameters)
+            if (mType != ProducerType::FlirCamera && mType != ProducerType::MultiStream)
             {
                 // Undistort image?
                 mCameraParameterReader.setUndistortImage(undistortImage);
@@ -247,9 +248,10 @@ namespace op
                 if (property == ProducerProperty::AutoRepeat)
                 {
                     checkBool(
-                        value != 1. || (mType == ProducerType::ImageDirectory || mType == ProducerType::Video),
-                        "ProducerProperty::AutoRepeat only implemented for ProducerType::ImageDirectory and"
-                        " Video.", __LINE__, __FUNCTION__, __FILE__);
+                        value != 1. || (mType == ProducerType::ImageDirectory || mType == ProducerType::NetOutput
+                                        || mType == ProducerType::Video),
+                        "ProducerProperty::AutoRepeat only implemented for ProducerType::ImageDirectory,"
+                        " NetOutput, and Video.", __LINE__, __FUNCTION__, __FILE__);
                 }
                 else if (property == ProducerProperty::Rotation)
                 {
@@ -324,7 +326,7 @@ namespace op
                 // closed keeping the 0-index frame counting
                 if (mNumberEmptyFrames > 2
                     || (mType != ProducerType::FlirCamera && mType != ProducerType::IPCamera
-                        && mType != ProducerType::Webcam
+                        && mType != ProducerType::Webcam && mType != ProducerType::MultiStream
                         && get(CV_CAP_PROP_POS_FRAMES) >= get(CV_CAP_PROP_FRAME_COUNT)))
                 {
                     // Repeat video
@@ -424,9 +426,16 @@ namespace op
             else if (producerType == ProducerType::Video)
                 return std::make_shared<VideoReader>(
                     producerString, cameraParameterPath, undistortImage, numberViews);
+            // Recorded network outputs
+            else if (producerType == ProducerType::NetOutput)
+                return std::make_shared<NetOutputReader>(producerString);
             // IP camera
             else if (producerType == ProducerType::IPCamera)
                 return std::make_shared<IpCameraReader>(producerString, cameraParameterPath, undistortImage);
+            // Multiple streams (comma-separated sources)
+            else if (producerType == ProducerType::MultiStream)
+                return std::make_shared<MultiStreamReader>(
+                    createMultiStreamProducers(producerString, cameraResolution));
             // Flir camera
             else if (producerType == ProducerType::FlirCamera)
                 return std::make_shared<FlirReader>(
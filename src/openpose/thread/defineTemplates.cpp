@@ -26,6 +26,7 @@ namespace op
     // W-classes
     DEFINE_TEMPLATE_DATUM(WFpsMax);
     DEFINE_TEMPLATE_DATUM(WIdGenerator);
+    DEFINE_TEMPLATE_DATUM(WLatencyGuard);
     template class OP_API WQueueAssembler<BASE_DATUMS>;
     DEFINE_TEMPLATE_DATUM(WQueueOrderer);
 }
@@ -0,0 +1,241 @@
+#include <openpose/thread/latencyController.hpp>
+#include <map>
+#include <mutex>
+#include <set>
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    struct LatencyController::ImplLatencyController
+    {
+        const unsigned long long mLatencyTargetNanoseconds;
+        const LatencyPolicy mLatencyPolicy;
+        const bool mTrackDroppedIds;
+        mutable std::mutex mMutex;
+        std::set<unsigned long long> mDroppedIds;
+        // Multi-view frames: ID -> (whether it is dropped, number of views not checked yet)
+        std::map<unsigned long long, std::pair<bool, unsigned long long>> mMultiViewDecisions;
+        // Stats
+        unsigned long long mCheckedFrames;
+        unsigned long long mStaleFrames;
+        unsigned long long mDroppedFrames;
+        unsigned long long mSkippedFaceFrames;
+        unsigned long long mSkippedHandFrames;
+        unsigned long long mMaxAgeNanoseconds;
+
+        ImplLatencyController(
+            const double latencyTargetMs, const LatencyPolicy latencyPolicy, const bool trackDroppedIds) :
+            mLatencyTargetNanoseconds{uLongLongRound(fastMax(0., latencyTargetMs) * 1e6)},
+            mLatencyPolicy{latencyPolicy},
+            mTrackDroppedIds{trackDroppedIds},
+            mCheckedFrames{0ull},
+            mStaleFrames{0ull},
+            mDroppedFrames{0ull},
+            mSkippedFaceFrames{0ull},
+            mSkippedHandFrames{0ull},
+            mMaxAgeNanoseconds{0ull}
+        {
+        }
+
+        // It must be called with mMutex locked
+        bool checkStale(const unsigned long long captureNanoseconds)
+        {
+            // Unknown capture time
+            if (captureNanoseconds == 0ull)
+                return false;
+            const auto now = getSteadyTimeNanoseconds();
+            const auto ageNanoseconds = (now > captureNanoseconds ? now - captureNanoseconds : 0ull);
+            const auto isStale = (ageNanoseconds > mLatencyTargetNanoseconds);
+            mCheckedFrames++;
+            if (isStale)
+                mStaleFrames++;
+            mMaxAgeNanoseconds = fastMax(mMaxAgeNanoseconds, ageNanoseconds);
+            return isStale;
+        }
+
+        // It must be called with mMutex locked
+        void recordDrop(const unsigned long long id)
+        {
+            if (mTrackDroppedIds)
+                mDroppedIds.emplace(id);
+            mDroppedFrames++;
+        }
+    };
+
+    LatencyController::LatencyController(
+        const double latencyTargetMs, const LatencyPolicy latencyPolicy, const bool trackDroppedIds) :
+        upImpl{new ImplLatencyController{latencyTargetMs, latencyPolicy, trackDroppedIds}}
+    {
+        try
+        {
+            // Sanity checks
+            if (latencyTargetMs <= 0.)
+                error("The latency target must be > 0 ms.", __LINE__, __FUNCTION__, __FILE__);
+            if (latencyPolicy >= LatencyPolicy::Size)
+                error("Unknown LatencyPolicy.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    LatencyController::~LatencyController()
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            if (upImpl->mCheckedFrames > 0)
+                opLog("Latency target " + std::to_string(upImpl->mLatencyTargetNanoseconds * 1e-6) + " ms: "
+                      + std::to_string(upImpl->mStaleFrames) + " stale frames out of "
+                      + std::to_string(upImpl->mCheckedFrames) + " checks (" + std::to_string(upImpl->mDroppedFrames)
+                      + " dropped, face skipped in " + std::to_string(upImpl->mSkippedFaceFrames)
+                      + ", hand skipped in " + std::to_string(upImpl->mSkippedHandFrames)
+                      + "), maximum checked age " + std::to_string(upImpl->mMaxAgeNanoseconds * 1e-6) + " ms.",
+                      Priority::High);
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    LatencyPolicy LatencyController::getPolicy() const
+    {
+        try
+        {
+            return upImpl->mLatencyPolicy;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return LatencyPolicy::DropFrames;
+        }
+    }
+
+    bool LatencyController::isStale(const unsigned long long captureNanoseconds)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->checkStale(captureNanoseconds);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    bool LatencyController::dropIfStale(
+        const unsigned long long id, const unsigned long long subIdMax, const unsigned long long numberViews,
+        const unsigned long long captureNanoseconds)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            // Single view
+            if (subIdMax == 0)
+            {
+                const auto isDropped = upImpl->checkStale(captureNanoseconds);
+                if (isDropped)
+                    upImpl->recordDrop(id);
+                return isDropped;
+            }
+            // Multi-view - The first group of views of this ID decides for all of them
+            auto decision = upImpl->mMultiViewDecisions.find(id);
+            if (decision == upImpl->mMultiViewDecisions.end())
+            {
+                const auto isDropped = upImpl->checkStale(captureNanoseconds);
+                if (isDropped)
+                    upImpl->recordDrop(id);
+                decision = upImpl->mMultiViewDecisions.emplace(
+                    id, std::make_pair(isDropped, subIdMax + 1)).first;
+            }
+            const auto isDropped = decision->second.first;
+            // All the views of this ID checked
+            if (decision->second.second <= numberViews)
+                upImpl->mMultiViewDecisions.erase(decision);
+            else
+                decision->second.second -= numberViews;
+            return isDropped;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void LatencyController::recordSkip(const LatencyAction latencyAction)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            if (latencyAction == LatencyAction::SkipFace)
+                upImpl->mSkippedFaceFrames++;
+            else if (latencyAction == LatencyAction::SkipHand)
+                upImpl->mSkippedHandFrames++;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    bool LatencyController::popDrop(const unsigned long long id)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return (upImpl->mDroppedIds.erase(id) > 0);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    unsigned long long LatencyController::getDroppedFrames() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mDroppedFrames;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    unsigned long long LatencyController::getSkippedFaceFrames() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mSkippedFaceFrames;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    unsigned long long LatencyController::getSkippedHandFrames() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mSkippedHandFrames;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+}
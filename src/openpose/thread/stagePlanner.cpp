@@ -0,0 +1,224 @@
+#include <openpose/thread/stagePlanner.hpp>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <openpose/utilities/fastMath.hpp>
+
+namespace op
+{
+    struct StagePlanner::ImplStagePlanner
+    {
+        struct Stage
+        {
+            std::string name;
+            long long previousStage;
+            bool isFused;
+            // Current window
+            unsigned long long windowFrames;
+            unsigned long long windowNanoseconds;
+            // Cost of the last complete window (in ms), or < 0 if not measured yet
+            double costMs;
+            // Whole run (for the final report)
+            unsigned long long totalFrames;
+            std::vector<unsigned long long> totalWorkerNanoseconds;
+        };
+
+        const double mFusionThresholdMs;
+        const unsigned long long mWarmUpFrames;
+        std::mutex mMutex;
+        std::vector<Stage> mStages;
+        // std::deque does not move its elements, so it can hold (not copyable) atomics
+        std::deque<std::atomic<unsigned long long>> mHostStages;
+        std::deque<std::atomic<bool>> mIsClosed;
+
+        ImplStagePlanner(const double fusionThresholdMs, const unsigned long long warmUpFrames) :
+            mFusionThresholdMs{fusionThresholdMs},
+            mWarmUpFrames{fastMax(1ull, warmUpFrames)}
+        {
+        }
+
+        std::string getPlan() const
+        {
+            std::string plan;
+            for (auto i = 0u ; i < mStages.size() ; i++)
+            {
+                const auto& stage = mStages[i];
+                plan += (i == 0 ? "" : (stage.isFused ? " + " : " | ")) + stage.name
+                      + (stage.costMs < 0 ? "" : " (" + std::to_string(stage.costMs) + " ms)");
+            }
+            return plan;
+        }
+
+        // Greedy plan in pipeline order: each stage is fused into the group of its previous one if the cost of the
+        // resulting group is lower than the threshold (or than twice the threshold if it was already fused)
+        void updatePlan()
+        {
+            auto planChanged = false;
+            std::vector<double> groupCostsMs(mStages.size(), 0.);
+            for (auto i = 0u ; i < mStages.size() ; i++)
+            {
+                auto& stage = mStages[i];
+                const auto costMs = fastMax(0., stage.costMs);
+                // Stages never measured (e.g., a GPU thread hosting the following ones) count as 0 ms
+                if (stage.previousStage >= 0 && stage.costMs >= 0)
+                {
+                    const auto limitMs = (stage.isFused ? 2 * mFusionThresholdMs : mFusionThresholdMs);
+                    const auto isFused = (groupCostsMs[stage.previousStage] + costMs <= limitMs);
+                    planChanged |= (isFused != stage.isFused);
+                    stage.isFused = isFused;
+                }
+                groupCostsMs[i] = (stage.isFused ? groupCostsMs[stage.previousStage] + costMs : costMs);
+                mHostStages[i] = (stage.isFused ? mHostStages[stage.previousStage].load() : (unsigned long long)i);
+            }
+            if (planChanged)
+                opLog("Stage fusion plan (`+` = same thread, `|` = new thread): " + getPlan() + ".", Priority::High);
+        }
+    };
+
+    StagePlanner::StagePlanner(const double fusionThresholdMs, const unsigned long long warmUpFrames) :
+        upImpl{new ImplStagePlanner{fusionThresholdMs, warmUpFrames}}
+    {
+        try
+        {
+            // Sanity check
+            if (fusionThresholdMs <= 0.)
+                error("The stage fusion threshold must be > 0 ms.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    StagePlanner::~StagePlanner()
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            for (const auto& stage : upImpl->mStages)
+            {
+                if (stage.totalFrames > 0)
+                {
+                    std::string workerCosts;
+                    for (const auto& workerNanoseconds : stage.totalWorkerNanoseconds)
+                        workerCosts += (workerCosts.empty() ? "" : ", ")
+                                     + std::to_string(workerNanoseconds * 1e-6 / stage.totalFrames);
+                    opLog("Stage `" + stage.name + "`: " + std::to_string(stage.totalFrames) + " frames, "
+                          + (stage.isFused ? "fused" : "own thread") + ", worker costs (ms/frame): " + workerCosts
+                          + ".", Priority::High);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            errorDestructor(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    unsigned long long StagePlanner::addStage(const std::string& stageName, const long long previousStage)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            const auto stageIndex = (unsigned long long)upImpl->mStages.size();
+            // Sanity check
+            if (previousStage >= (long long)stageIndex)
+                error("The previous stage must be added first.", __LINE__, __FUNCTION__, __FILE__);
+            upImpl->mStages.emplace_back(ImplStagePlanner::Stage{
+                stageName, previousStage, false, 0ull, 0ull, -1., 0ull, std::vector<unsigned long long>{}});
+            upImpl->mHostStages.emplace_back(stageIndex);
+            upImpl->mIsClosed.emplace_back(false);
+            return stageIndex;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
+    unsigned long long StagePlanner::getHostStage(const unsigned long long stageIndex) const
+    {
+        try
+        {
+            const auto hostStage = upImpl->mHostStages[stageIndex].load();
+            // If the host thread is finishing, the stage goes back to its own thread
+            return (hostStage == stageIndex || !upImpl->mIsClosed[hostStage] ? hostStage : stageIndex);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return stageIndex;
+        }
+    }
+
+    void StagePlanner::recordCosts(
+        const unsigned long long stageIndex, const std::vector<unsigned long long>& workerCosts)
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            auto& stage = upImpl->mStages.at(stageIndex);
+            if (stage.totalWorkerNanoseconds.size() < workerCosts.size())
+                stage.totalWorkerNanoseconds.resize(workerCosts.size(), 0ull);
+            for (auto i = 0u ; i < workerCosts.size() ; i++)
+            {
+                stage.totalWorkerNanoseconds[i] += workerCosts[i];
+                stage.windowNanoseconds += workerCosts[i];
+            }
+            stage.totalFrames++;
+            stage.windowFrames++;
+            // Window completed
+            if (stage.windowFrames == upImpl->mWarmUpFrames)
+            {
+                stage.costMs = stage.windowNanoseconds * 1e-6 / stage.windowFrames;
+                stage.windowFrames = 0ull;
+                stage.windowNanoseconds = 0ull;
+                upImpl->updatePlan();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void StagePlanner::setClosed(const unsigned long long stageIndex)
+    {
+        try
+        {
+            upImpl->mIsClosed.at(stageIndex) = true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    bool StagePlanner::isClosed(const unsigned long long stageIndex) const
+    {
+        try
+        {
+            return upImpl->mIsClosed.at(stageIndex);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return true;
+        }
+    }
+
+    unsigned long long StagePlanner::getNumberStages() const
+    {
+        try
+        {
+            std::lock_guard<std::mutex> lock{upImpl->mMutex};
+            return upImpl->mStages.size();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+}
@@ -0,0 +1,375 @@
+#include <openpose/tracking/personRoiMosaic.hpp>
+#include <algorithm> // std::count, std::max_element, std::sort
+#include <cmath> // std::ceil, std::sqrt
+#include <mutex>
+#include <openpose/core/cvMatToOpInput.hpp>
+#include <openpose/utilities/fastMath.hpp>
+#include <openpose/utilities/keypoint.hpp>
+#include <openpose/utilities/openCv.hpp>
+#include <openpose_private/utilities/openCvMultiversionHeaders.hpp>
+
+namespace op
+{
+    // Minimum gap between mosaic tiles (in net input pixels), so PAFs do not connect people from different tiles
+    const auto MOSAIC_GAP_NET_PIXELS = 32.;
+    const auto MOSAIC_KEYPOINT_THRESHOLD = 0.05f;
+    // The mosaic size is rounded up to multiples of 1/MOSAIC_SIZE_BUCKETS of the frame size, so the network only sees
+    // a few different input sizes (rather than being reshaped every frame)
+    const auto MOSAIC_SIZE_BUCKETS = 4;
+
+    struct PersonRoiMosaicViewState
+    {
+        long long lastFrameId;
+        std::vector<Rectangle<float>> personRectangles;
+        std::vector<Point<float>> personVelocities;
+
+        PersonRoiMosaicViewState() :
+            lastFrameId{-1ll}
+        {
+        }
+    };
+
+    bool rectanglesOverlap(const Rectangle<int>& a, const Rectangle<int>& b, const int gap)
+    {
+        return a.x < b.x + b.width + gap && b.x < a.x + a.width + gap
+            && a.y < b.y + b.height + gap && b.y < a.y + a.height + gap;
+    }
+
+    Rectangle<int> getUnion(const Rectangle<int>& a, const Rectangle<int>& b)
+    {
+        const auto x = fastMin(a.x, b.x);
+        const auto y = fastMin(a.y, b.y);
+        return Rectangle<int>{
+            x, y, fastMax(a.x + a.width, b.x + b.width) - x, fastMax(a.y + a.height, b.y + b.height) - y};
+    }
+
+    struct PersonRoiMosaic::ImplPersonRoiMosaic
+    {
+        const PoseModel mPoseModel;
+        const int mFullFramePeriod;
+        const float mRoiMargin;
+        const float mMaximumAreaRatio;
+        std::mutex mMutex;
+        std::vector<PersonRoiMosaicViewState> mViewStates;
+
+        ImplPersonRoiMosaic(
+            const PoseModel poseModel, const int fullFramePeriod, const float roiMargin,
+            const float maximumAreaRatio) :
+            mPoseModel{poseModel},
+            mFullFramePeriod{fullFramePeriod},
+            mRoiMargin{roiMargin},
+            mMaximumAreaRatio{maximumAreaRatio}
+        {
+        }
+    };
+
+    PersonRoiMosaic::PersonRoiMosaic(
+        const PoseModel poseModel, const int fullFramePeriod, const float roiMargin, const float maximumAreaRatio) :
+        spImpl{new ImplPersonRoiMosaic{poseModel, fullFramePeriod, roiMargin, maximumAreaRatio}}
+    {
+        try
+        {
+            // Sanity checks
+            if (fullFramePeriod < 1)
+                error("The full-frame period must be at least 1 frame.", __LINE__, __FUNCTION__, __FILE__);
+            if (roiMargin < 0.f)
+                error("The ROI margin cannot be negative.", __LINE__, __FUNCTION__, __FILE__);
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    PersonRoiMosaic::~PersonRoiMosaic()
+    {
+    }
+
+    bool PersonRoiMosaic::createMosaicNetInput(
+        std::vector<Array<float>>& mosaicNetInput, std::vector<double>& mosaicScaleInputToNetInputs,
+        Point<int>& mosaicSize, std::vector<Rectangle<int>>& mosaicRegions, std::vector<Point<int>>& mosaicOffsets,
+        const Matrix& cvInputData, const std::vector<double>& scaleInputToNetInputs,
+        const unsigned long long frameId, const unsigned long long imageViewIndex)
+    {
+        try
+        {
+            // Full-frame pass
+            if (frameId % spImpl->mFullFramePeriod == 0 || scaleInputToNetInputs.empty() || cvInputData.empty())
+                return false;
+            // Copy state of this view
+            PersonRoiMosaicViewState viewState;
+            {
+                const std::lock_guard<std::mutex> lock{spImpl->mMutex};
+                if (spImpl->mViewStates.size() > imageViewIndex)
+                    viewState = spImpl->mViewStates[imageViewIndex];
+            }
+            // No previous results
+            if (viewState.lastFrameId < 0)
+                return false;
+            // Predicted person regions (velocity extrapolation + margin), clipped to the frame
+            const Point<int> frameSize{cvInputData.cols(), cvInputData.rows()};
+            const auto framesElapsed = float((long long)frameId - viewState.lastFrameId);
+            std::vector<Rectangle<int>> regions;
+            for (auto person = 0u ; person < viewState.personRectangles.size() ; person++)
+            {
+                const auto& rectangle = viewState.personRectangles[person];
+                const auto& velocity = viewState.personVelocities[person];
+                const auto marginX = spImpl->mRoiMargin * rectangle.width;
+                const auto marginY = spImpl->mRoiMargin * rectangle.height;
+                const auto x0 = fastTruncate(
+                    positiveIntRound(rectangle.x + velocity.x * framesElapsed - marginX), 0, frameSize.x);
+                const auto y0 = fastTruncate(
+                    positiveIntRound(rectangle.y + velocity.y * framesElapsed - marginY), 0, frameSize.y);
+                const auto x1 = fastTruncate(positiveIntRound(
+                    rectangle.x + rectangle.width + velocity.x * framesElapsed + marginX), 0, frameSize.x);
+                const auto y1 = fastTruncate(positiveIntRound(
+                    rectangle.y + rectangle.height + velocity.y * framesElapsed + marginY), 0, frameSize.y);
+                if (x1 > x0 && y1 > y0)
+                    regions.emplace_back(Rectangle<int>{x0, y0, x1-x0, y1-y0});
+            }
+            // Merge overlapping (or too close) regions
+            const auto scaleInputToNetInput = scaleInputToNetInputs[0];
+            const auto gap = positiveIntRound(MOSAIC_GAP_NET_PIXELS / scaleInputToNetInput);
+            auto merged = true;
+            while (merged)
+            {
+                merged = false;
+                for (auto i = 0u ; i < regions.size() && !merged ; i++)
+                {
+                    for (auto j = i+1 ; j < regions.size() && !merged ; j++)
+                    {
+                        if (rectanglesOverlap(regions[i], regions[j], gap))
+                        {
+                            regions[i] = getUnion(regions[i], regions[j]);
+                            regions.erase(regions.begin() + j);
+                            merged = true;
+                        }
+                    }
+                }
+            }
+            mosaicRegions = regions;
+            mosaicOffsets.clear();
+            mosaicNetInput.clear();
+            mosaicScaleInputToNetInputs.clear();
+            mosaicSize = Point<int>{0, 0};
+            // No people - Skip network
+            if (regions.empty())
+                return true;
+            // Pack regions into shelves (sorted by height), no wider than the frame
+            std::vector<int> order(regions.size());
+            for (auto i = 0u ; i < order.size() ; i++)
+                order[i] = (int)i;
+            std::sort(order.begin(), order.end(), [&regions](const int a, const int b)
+                {
+                    return regions[a].height > regions[b].height;
+                });
+            mosaicOffsets.resize(regions.size());
+            auto shelfX = 0;
+            auto shelfY = 0;
+            auto shelfHeight = 0;
+            for (const auto index : order)
+            {
+                const auto& region = regions[index];
+                if (shelfX > 0 && shelfX + region.width > frameSize.x)
+                {
+                    shelfY += shelfHeight + gap;
+                    shelfX = 0;
+                    shelfHeight = 0;
+                }
+                mosaicOffsets[index] = Point<int>{shelfX, shelfY};
+                mosaicSize.x = fastMax(mosaicSize.x, shelfX + region.width);
+                shelfX += region.width + gap;
+                shelfHeight = fastMax(shelfHeight, region.height);
+            }
+            mosaicSize.y = shelfY + shelfHeight;
+            // Round up to the size buckets (the extra area keeps the black background)
+            const Point<int> bucketSize{
+                positiveIntRound(std::ceil(frameSize.x / float(MOSAIC_SIZE_BUCKETS))),
+                positiveIntRound(std::ceil(frameSize.y / float(MOSAIC_SIZE_BUCKETS)))};
+            mosaicSize.x = fastMax(mosaicSize.x, fastMin(
+                frameSize.x, bucketSize.x * positiveIntRound(std::ceil(mosaicSize.x / float(bucketSize.x)))));
+            mosaicSize.y = fastMax(mosaicSize.y, fastMin(
+                frameSize.y, bucketSize.y * positiveIntRound(std::ceil(mosaicSize.y / float(bucketSize.y)))));
+            // Not worth it (e.g., too many people or people too spread)
+            if (mosaicSize.area() > spImpl->mMaximumAreaRatio * frameSize.area())
+            {
+                mosaicRegions.clear();
+                mosaicOffsets.clear();
+                return false;
+            }
+            // Create mosaic image (black background, i.e., same value than the net input padding)
+            const cv::Mat cvMatInput = OP_OP2CVCONSTMAT(cvInputData);
+            cv::Mat cvMatMosaic(mosaicSize.y, mosaicSize.x, cvMatInput.type(), cv::Scalar::all(0));
+            for (auto i = 0u ; i < regions.size() ; i++)
+            {
+                const auto& region = regions[i];
+                const cv::Rect cvRegion{region.x, region.y, region.width, region.height};
+                cvMatInput(cvRegion).copyTo(cvMatMosaic(
+                    cv::Rect{mosaicOffsets[i].x, mosaicOffsets[i].y, region.width, region.height}));
+            }
+            // Net input - Same scales than the full frame, so the net input is proportional to the mosaic area
+            // (scales re-computed after rounding to multiples of 16, as done by ScaleAndSizeExtractor)
+            std::vector<Point<int>> mosaicNetInputSizes(scaleInputToNetInputs.size());
+            mosaicScaleInputToNetInputs.resize(scaleInputToNetInputs.size());
+            for (auto i = 0u ; i < scaleInputToNetInputs.size() ; i++)
+            {
+                mosaicNetInputSizes[i] = Point<int>{
+                    16 * fastMax(1, positiveIntRound(std::ceil(mosaicSize.x * scaleInputToNetInputs[i] / 16.))),
+                    16 * fastMax(1, positiveIntRound(std::ceil(mosaicSize.y * scaleInputToNetInputs[i] / 16.)))};
+                mosaicScaleInputToNetInputs[i] = resizeGetScaleFactor(mosaicSize, mosaicNetInputSizes[i]);
+            }
+            // CPU resize (stateless, so thread-safe)
+            CvMatToOpInput cvMatToOpInput{spImpl->mPoseModel};
+            const Matrix opMosaic = OP_CV2OPCONSTMAT(cvMatMosaic);
+            mosaicNetInput = cvMatToOpInput.createArray(opMosaic, mosaicScaleInputToNetInputs, mosaicNetInputSizes);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return false;
+        }
+    }
+
+    void PersonRoiMosaic::mosaicToFrame(
+        Array<float>& poseKeypoints, Array<float>& poseScores, const std::vector<Rectangle<int>>& mosaicRegions,
+        const std::vector<Point<int>>& mosaicOffsets) const
+    {
+        try
+        {
+            if (poseKeypoints.empty())
+                return;
+            const auto numberPeople = poseKeypoints.getSize(0);
+            const auto numberBodyParts = poseKeypoints.getSize(1);
+            const auto numberTiles = (int)mosaicRegions.size();
+            // Assign each person to the tile with most of its keypoints
+            std::vector<int> personTiles(numberPeople, -1);
+            for (auto person = 0 ; person < numberPeople ; person++)
+            {
+                std::vector<int> votes(numberTiles, 0);
+                for (auto part = 0 ; part < numberBodyParts ; part++)
+                {
+                    const auto baseIndex = poseKeypoints.getSize(2)*(person*numberBodyParts + part);
+                    if (poseKeypoints[baseIndex+2] > 0.f)
+                    {
+                        const auto x = poseKeypoints[baseIndex];
+                        const auto y = poseKeypoints[baseIndex+1];
+                        for (auto tile = 0 ; tile < numberTiles ; tile++)
+                        {
+                            const auto& offset = mosaicOffsets[tile];
+                            if (offset.x <= x && x < offset.x + mosaicRegions[tile].width
+                                && offset.y <= y && y < offset.y + mosaicRegions[tile].height)
+                            {
+                                votes[tile]++;
+                                break;
+                            }
+                        }
+                    }
+                }
+                const auto maxVotes = std::max_element(votes.begin(), votes.end());
+                if (maxVotes != votes.end() && *maxVotes > 0)
+                    personTiles[person] = (int)(maxVotes - votes.begin());
+            }
+            // Remap kept people to frame coordinates
+            const auto numberPeopleKept = (int)(personTiles.size()
+                - std::count(personTiles.begin(), personTiles.end(), -1));
+            Array<float> poseKeypointsFrame;
+            Array<float> poseScoresFrame;
+            if (numberPeopleKept > 0)
+            {
+                poseKeypointsFrame.reset({numberPeopleKept, numberBodyParts, poseKeypoints.getSize(2)}, 0.f);
+                poseScoresFrame.reset(numberPeopleKept, 0.f);
+                auto personKept = 0;
+                for (auto person = 0 ; person < numberPeople ; person++)
+                {
+                    const auto tile = personTiles[person];
+                    if (tile < 0)
+                        continue;
+                    const auto& offset = mosaicOffsets[tile];
+                    const auto& region = mosaicRegions[tile];
+                    for (auto part = 0 ; part < numberBodyParts ; part++)
+                    {
+                        const auto baseIndex = poseKeypoints.getSize(2)*(person*numberBodyParts + part);
+                        const auto baseIndexKept = poseKeypoints.getSize(2)*(personKept*numberBodyParts + part);
+                        const auto x = poseKeypoints[baseIndex];
+                        const auto y = poseKeypoints[baseIndex+1];
+                        // Keypoints outside its tile are spurious (other people or padding)
+                        if (poseKeypoints[baseIndex+2] > 0.f
+                            && offset.x <= x && x < offset.x + region.width
+                            && offset.y <= y && y < offset.y + region.height)
+                        {
+                            poseKeypointsFrame[baseIndexKept] = x - offset.x + region.x;
+                            poseKeypointsFrame[baseIndexKept+1] = y - offset.y + region.y;
+                            poseKeypointsFrame[baseIndexKept+2] = poseKeypoints[baseIndex+2];
+                        }
+                    }
+                    if (!poseScores.empty())
+                        poseScoresFrame[personKept] = poseScores[person];
+                    personKept++;
+                }
+            }
+            poseKeypoints = poseKeypointsFrame;
+            poseScores = poseScoresFrame;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+
+    void PersonRoiMosaic::update(
+        const Array<float>& poseKeypoints, const Point<int>& frameSize, const unsigned long long frameId,
+        const unsigned long long imageViewIndex)
+    {
+        try
+        {
+            UNUSED(frameSize);
+            // Person bounding boxes
+            std::vector<Rectangle<float>> personRectangles;
+            const auto numberPeople = (poseKeypoints.empty() ? 0 : poseKeypoints.getSize(0));
+            for (auto person = 0 ; person < numberPeople ; person++)
+            {
+                const auto personRectangle = getKeypointsRectangle(poseKeypoints, person, MOSAIC_KEYPOINT_THRESHOLD);
+                if (personRectangle.area() > 0)
+                    personRectangles.emplace_back(personRectangle);
+            }
+            const std::lock_guard<std::mutex> lock{spImpl->mMutex};
+            if (spImpl->mViewStates.size() <= imageViewIndex)
+                spImpl->mViewStates.resize(imageViewIndex+1);
+            auto& viewState = spImpl->mViewStates[imageViewIndex];
+            // Older frame (out-of-order multi-GPU processing)
+            if ((long long)frameId <= viewState.lastFrameId)
+                return;
+            // Velocities - Matching each person with the closest previous one (if close enough)
+            std::vector<Point<float>> personVelocities(personRectangles.size(), Point<float>{0.f, 0.f});
+            const auto framesElapsed = float((long long)frameId - viewState.lastFrameId);
+            if (viewState.lastFrameId >= 0)
+            {
+                for (auto person = 0u ; person < personRectangles.size() ; person++)
+                {
+                    const auto center = personRectangles[person].center();
+                    const auto maxDistance = fastMax(personRectangles[person].width, personRectangles[person].height);
+                    auto minDistance = maxDistance;
+                    for (const auto& previousRectangle : viewState.personRectangles)
+                    {
+                        const auto difference = center - previousRectangle.center();
+                        const auto distance = std::sqrt(difference.x*difference.x + difference.y*difference.y);
+                        if (distance < minDistance)
+                        {
+                            minDistance = distance;
+                            personVelocities[person] = Point<float>{
+                                difference.x / framesElapsed, difference.y / framesElapsed};
+                        }
+                    }
+                }
+            }
+            viewState.lastFrameId = (long long)frameId;
+            viewState.personRectangles = personRectangles;
+            viewState.personVelocities = personVelocities;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
+}
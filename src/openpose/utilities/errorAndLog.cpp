@@ -1,10 +1,14 @@
 #include <openpose/utilities/errorAndLog.hpp>
+#include <algorithm> // std::sort
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <ctime> // std::tm, std::time_t
 #include <fstream> // std::ifstream, std::ofstream
 #include <iostream> // std::cout, std::endl
+#include <memory> // std::shared_ptr
 #include <stdexcept> // std::runtime_error
+#include <thread>
 
 namespace op
 {
@@ -155,6 +159,264 @@ namespace op
         loggingFile.close();
     }
 
+    namespace AsyncLog
+    {
+        // Maximum number of pending messages per thread (new ones are dropped if full)
+        const auto THREAD_BUFFER_CAPACITY = 1024ull;
+        // Sleeping time of the writer thread between consecutive drains
+        const auto WRITER_PERIOD = std::chrono::milliseconds{5};
+
+        struct LogRecord
+        {
+            unsigned long long sequence;
+            long long timestampUs;
+            unsigned int threadIndex;
+            Priority priority;
+            int line;
+            unsigned int repetitions;
+            std::string message;
+            std::string function;
+            std::string file;
+        };
+
+        // Single-producer (its thread) single-consumer (the drainer) lock-free ring buffer
+        struct ThreadLogBuffer
+        {
+            std::vector<LogRecord> records;
+            std::atomic<unsigned long long> head;
+            std::atomic<unsigned long long> tail;
+            std::atomic<unsigned long long> dropped;
+            // Rate limiting (only accessed by the producer thread)
+            std::string lastMessageKey;
+            long long lastTimestampUs;
+            unsigned int repetitions;
+
+            ThreadLogBuffer() :
+                records(THREAD_BUFFER_CAPACITY),
+                head{0ull},
+                tail{0ull},
+                dropped{0ull},
+                lastTimestampUs{0ll},
+                repetitions{0u}
+            {
+            }
+        };
+
+        // AsyncLog - Private variables
+        std::atomic<bool> sAsynchronous                                 {false};
+        std::atomic<long long> sRepeatedMessageIntervalUs               {1000000ll};
+        std::atomic<unsigned long long> sSequence                       {0ull};
+        std::atomic<unsigned int> sNumberThreads                        {0u};
+        std::string sBinaryRecordsPath                                  {};
+        std::mutex sBuffersMutex                                        {};
+        std::vector<std::shared_ptr<ThreadLogBuffer>> sBuffers          {};
+        // Only 1 drainer at a time (writer thread or flush())
+        std::mutex sDrainMutex                                          {};
+        std::ofstream sBinaryRecordsFile                                {};
+        std::thread sWriterThread                                       {};
+
+        long long getTimestampUs()
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        unsigned int getThreadIndex()
+        {
+            thread_local const unsigned int sThreadIndex = sNumberThreads++;
+            return sThreadIndex;
+        }
+
+        ThreadLogBuffer& getThreadBuffer()
+        {
+            // Registered once per thread. The registry keeps it alive after the thread ends until it is drained
+            thread_local const std::shared_ptr<ThreadLogBuffer> spThreadBuffer = []() -> std::shared_ptr<ThreadLogBuffer>
+            {
+                const auto threadBuffer = std::make_shared<ThreadLogBuffer>();
+                const std::lock_guard<std::mutex> lock{sBuffersMutex};
+                sBuffers.emplace_back(threadBuffer);
+                return threadBuffer;
+            }();
+            return *spThreadBuffer;
+        }
+
+        void push(
+            const std::string& message, const Priority priority, const int line, const std::string& function,
+            const std::string& file)
+        {
+            auto& threadBuffer = getThreadBuffer();
+            const auto timestampUs = getTimestampUs();
+            // Rate limiting: Same message (and location) than the previous one of this thread
+            const auto repeatedMessageIntervalUs = sRepeatedMessageIntervalUs.load();
+            if (repeatedMessageIntervalUs > 0)
+            {
+                auto messageKey = message + '\0' + std::to_string(line) + '\0' + function + '\0' + file;
+                if (messageKey == threadBuffer.lastMessageKey
+                    && timestampUs - threadBuffer.lastTimestampUs < repeatedMessageIntervalUs)
+                {
+                    threadBuffer.repetitions++;
+                    return;
+                }
+                threadBuffer.lastMessageKey = std::move(messageKey);
+                threadBuffer.lastTimestampUs = timestampUs;
+            }
+            // Push it (or drop it if the buffer is full)
+            const auto head = threadBuffer.head.load(std::memory_order_relaxed);
+            if (head - threadBuffer.tail.load(std::memory_order_acquire) >= THREAD_BUFFER_CAPACITY)
+            {
+                threadBuffer.dropped.fetch_add(1ull, std::memory_order_relaxed);
+                return;
+            }
+            auto& record = threadBuffer.records[head % THREAD_BUFFER_CAPACITY];
+            record.sequence = sSequence++;
+            record.timestampUs = timestampUs;
+            record.threadIndex = getThreadIndex();
+            record.priority = priority;
+            record.line = line;
+            record.repetitions = threadBuffer.repetitions;
+            record.message = message;
+            record.function = function;
+            record.file = file;
+            threadBuffer.repetitions = 0u;
+            threadBuffer.head.store(head + 1ull, std::memory_order_release);
+        }
+
+        void writeBinaryString(const std::string& string)
+        {
+            const auto length = (unsigned int)string.size();
+            sBinaryRecordsFile.write((const char*)&length, sizeof(length));
+            sBinaryRecordsFile.write(string.data(), length);
+        }
+
+        void writeBinaryRecord(const LogRecord& record)
+        {
+            const auto priority = (unsigned char)record.priority;
+            sBinaryRecordsFile.write((const char*)&record.sequence, sizeof(record.sequence));
+            sBinaryRecordsFile.write((const char*)&record.timestampUs, sizeof(record.timestampUs));
+            sBinaryRecordsFile.write((const char*)&record.threadIndex, sizeof(record.threadIndex));
+            sBinaryRecordsFile.write((const char*)&priority, sizeof(priority));
+            sBinaryRecordsFile.write((const char*)&record.line, sizeof(record.line));
+            sBinaryRecordsFile.write((const char*)&record.repetitions, sizeof(record.repetitions));
+            writeBinaryString(record.message);
+            writeBinaryString(record.function);
+            writeBinaryString(record.file);
+        }
+
+        void drain()
+        {
+            const std::lock_guard<std::mutex> drainLock{sDrainMutex};
+            // Pop the pending records of all threads
+            std::vector<std::shared_ptr<ThreadLogBuffer>> threadBuffers;
+            {
+                const std::lock_guard<std::mutex> lock{sBuffersMutex};
+                threadBuffers = sBuffers;
+            }
+            std::vector<LogRecord> records;
+            auto dropped = 0ull;
+            for (auto& threadBuffer : threadBuffers)
+            {
+                const auto tail = threadBuffer->tail.load(std::memory_order_relaxed);
+                const auto head = threadBuffer->head.load(std::memory_order_acquire);
+                for (auto index = tail ; index < head ; index++)
+                    records.emplace_back(std::move(threadBuffer->records[index % THREAD_BUFFER_CAPACITY]));
+                threadBuffer->tail.store(head, std::memory_order_release);
+                dropped += threadBuffer->dropped.exchange(0ull, std::memory_order_relaxed);
+            }
+            // Remove the buffers of finished threads (only owned by the registry and already drained)
+            {
+                const std::lock_guard<std::mutex> lock{sBuffersMutex};
+                threadBuffers.clear();
+                sBuffers.erase(
+                    std::remove_if(sBuffers.begin(), sBuffers.end(),
+                        [](const std::shared_ptr<ThreadLogBuffer>& threadBuffer)
+                        {
+                            return threadBuffer.use_count() == 1
+                                && threadBuffer->head.load() == threadBuffer->tail.load();
+                        }),
+                    sBuffers.end());
+            }
+            if (records.empty() && dropped == 0ull)
+                return;
+            // Call order
+            std::sort(records.begin(), records.end(),
+                      [](const LogRecord& a, const LogRecord& b) { return a.sequence < b.sequence; });
+            // Write them (a single std::cout flush per drain)
+            const auto logStdCout = checkIfLoggingHas(LogMode::StdCout);
+            const auto logFile = checkIfLoggingHas(LogMode::FileLogging);
+            std::string text;
+            for (const auto& record : records)
+            {
+                auto infoMessage = createFullMessage(record.message, record.line, record.function, record.file);
+                if (record.repetitions > 0u)
+                    infoMessage = "[Previous message repeated " + std::to_string(record.repetitions)
+                                + " more times]\n" + infoMessage;
+                if (logStdCout)
+                    text += infoMessage + "\n";
+                if (logFile)
+                    fileLogging(infoMessage);
+                if (sBinaryRecordsFile.is_open())
+                    writeBinaryRecord(record);
+            }
+            if (dropped > 0ull)
+            {
+                const auto droppedMessage = "[" + std::to_string(dropped) + " log messages dropped (full buffers)]";
+                if (logStdCout)
+                    text += droppedMessage + "\n";
+                if (logFile)
+                    fileLogging(droppedMessage);
+            }
+            if (!text.empty())
+                std::cout << text << std::flush;
+            if (sBinaryRecordsFile.is_open())
+                sBinaryRecordsFile.flush();
+        }
+
+        void writerLoop()
+        {
+            try
+            {
+                while (sAsynchronous)
+                {
+                    drain();
+                    std::this_thread::sleep_for(WRITER_PERIOD);
+                }
+                drain();
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Asynchronous logging thread stopped: " << e.what() << std::endl;
+            }
+        }
+
+        void start()
+        {
+            if (!sAsynchronous)
+            {
+                if (!sBinaryRecordsPath.empty())
+                {
+                    sBinaryRecordsFile.open(sBinaryRecordsPath, std::ios::binary | std::ios::trunc);
+                    if (!sBinaryRecordsFile.is_open())
+                        error("Binary log records file could not be opened: " + sBinaryRecordsPath + ".",
+                              __LINE__, __FUNCTION__, __FILE__);
+                }
+                sAsynchronous = true;
+                sWriterThread = std::thread{&writerLoop};
+            }
+        }
+
+        void stop()
+        {
+            if (sAsynchronous)
+            {
+                sAsynchronous = false;
+                if (sWriterThread.joinable())
+                    sWriterThread.join();
+                if (sBinaryRecordsFile.is_open())
+                    sBinaryRecordsFile.close();
+            }
+        }
+    }
+
     void errorAux(
         const int errorMode, const std::string& message, const int line, const std::string& function,
         const std::string& file)
@@ -203,6 +465,10 @@ namespace op
                 errorMessageToPrint = errorMessageToPropagate.substr(0, errorMessageToPropagate.size()-1);
         }
 
+        // Asynchronous messages logged before this error
+        if (AsyncLog::sAsynchronous)
+            AsyncLog::drain();
+
         // std::cerr
         if (checkIfErrorHas(ErrorMode::StdCerr))
             #ifdef NDEBUG
@@ -247,9 +513,14 @@ namespace op
 
     std::string getThreadId()
     {
-        std::stringstream threadId;
-        threadId << std::this_thread::get_id();
-        return threadId.str();
+        // Cached (built only once per thread)
+        thread_local const std::string sThreadId = []() -> std::string
+        {
+            std::stringstream threadId;
+            threadId << std::this_thread::get_id();
+            return threadId.str();
+        }();
+        return sThreadId;
     }
 
     bool getIfInMainThreadOrEmpty()
@@ -301,6 +572,17 @@ namespace op
     {
         if (priority >= ConfigureLog::getPriorityThreshold())
         {
+            // Asynchronous: Written (and rate limited) by the writer thread
+            if (AsyncLog::sAsynchronous)
+            {
+                AsyncLog::push(message, priority, line, function, file);
+                // Unity log
+                #ifdef USE_UNITY_SUPPORT
+                    UnityDebugger::opLog(createFullMessage(message, line, function, file));
+                #endif
+                return;
+            }
+
             const auto infoMessage = createFullMessage(message, line, function, file);
 
             // std::cout
@@ -375,5 +657,59 @@ namespace op
             // const std::lock_guard<std::mutex> lock{sConfigureLogMutex};
             sLoggingModes = loggingModes;
         }
+
+        void setAsynchronous(const bool asynchronous)
+        {
+            if (asynchronous)
+                AsyncLog::start();
+            else
+                AsyncLog::stop();
+        }
+
+        bool getAsynchronous()
+        {
+            return AsyncLog::sAsynchronous;
+        }
+
+        void setRepeatedMessageInterval(const double repeatedMessageInterval)
+        {
+            AsyncLog::sRepeatedMessageIntervalUs = (long long)(1e6 * repeatedMessageInterval);
+        }
+
+        void setBinaryRecordsPath(const std::string& binaryRecordsPath)
+        {
+            AsyncLog::sBinaryRecordsPath = binaryRecordsPath;
+        }
+
+        void flush()
+        {
+            if (AsyncLog::sAsynchronous)
+                AsyncLog::drain();
+        }
+    }
+
+
+
+
+
+    namespace AsyncLog
+    {
+        // It writes the pending messages at exit. Defined last, so it is destroyed before any other variable of
+        // this file (e.g., sLoggingModes)
+        struct WriterStopper
+        {
+            ~WriterStopper()
+            {
+                try
+                {
+                    stop();
+                }
+                catch (const std::exception& e)
+                {
+                    std::cerr << e.what() << std::endl;
+                }
+            }
+        };
+        WriterStopper sWriterStopper;
     }
 }
@@ -1,5 +1,6 @@
 #include <openpose/utilities/flagsToOpenPose.hpp>
 #include <cstdio> // sscanf
+#include <sstream> // std::stringstream
 #include <openpose/utilities/check.hpp>
 
 namespace op
@@ -163,7 +164,7 @@ namespace op
 
     ProducerType flagsToProducerType(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath,
-        const int webcamIndex, const bool flirCamera)
+        const int webcamIndex, const bool flirCamera, const String& netOutputPath, const String& multiStream)
     {
         try
         {
@@ -171,15 +172,20 @@ namespace op
             const std::string& imageDirectoryStd = imageDirectory.getStdString();
             const std::string& videoPathStd = videoPath.getStdString();
             const std::string& ipCameraPathStd = ipCameraPath.getStdString();
+            const std::string& netOutputPathStd = netOutputPath.getStdString();
+            const std::string& multiStreamStd = multiStream.getStdString();
             // Avoid duplicates (e.g., selecting at the time camera & video)
             if (int(!imageDirectoryStd.empty()) + int(!videoPathStd.empty()) + int(webcamIndex > 0)
-                + int(flirCamera) + int(!ipCameraPathStd.empty()) > 1)
+                + int(flirCamera) + int(!ipCameraPathStd.empty()) + int(!netOutputPathStd.empty())
+                + int(!multiStreamStd.empty()) > 1)
                 error("Selected simultaneously"
                       " image directory (seletected: " + (imageDirectoryStd.empty() ? "no" : imageDirectoryStd) + "),"
                       " video (seletected: " + (videoPathStd.empty() ? "no" : videoPathStd) + "),"
                       " camera (selected: " + (webcamIndex > 0 ? std::to_string(webcamIndex) : "no") + "),"
-                      " flirCamera (selected: " + (flirCamera ? "yes" : "no") + ","
-                      " and/or IP camera (selected: " + (ipCameraPathStd.empty() ? "no" : ipCameraPathStd) + ")."
+                      " flirCamera (selected: " + (flirCamera ? "yes" : "no") + "),"
+                      " IP camera (selected: " + (ipCameraPathStd.empty() ? "no" : ipCameraPathStd) + "),"
+                      " net output (selected: " + (netOutputPathStd.empty() ? "no" : netOutputPathStd) + "),"
+                      " and/or multi-stream (selected: " + (multiStreamStd.empty() ? "no" : multiStreamStd) + ")."
                       " Please, select only one.", __LINE__, __FUNCTION__, __FILE__);
 
             // Get desired ProducerType
@@ -189,6 +195,10 @@ namespace op
                 return ProducerType::Video;
             else if (!ipCameraPathStd.empty())
                 return ProducerType::IPCamera;
+            else if (!netOutputPathStd.empty())
+                return ProducerType::NetOutput;
+            else if (!multiStreamStd.empty())
+                return ProducerType::MultiStream;
             else if (flirCamera)
                 return ProducerType::FlirCamera;
             else
@@ -203,13 +213,14 @@ namespace op
 
     std::pair<ProducerType, String> flagsToProducer(
         const String& imageDirectory, const String& videoPath, const String& ipCameraPath,
-        const int webcamIndex, const bool flirCamera, const int flirCameraIndex)
+        const int webcamIndex, const bool flirCamera, const int flirCameraIndex, const String& netOutputPath,
+        const String& multiStream)
     {
         try
         {
             opLog("", Priority::Low, __LINE__, __FUNCTION__, __FILE__);
             const auto type = flagsToProducerType(
-                imageDirectory, videoPath, ipCameraPath, webcamIndex, flirCamera);
+                imageDirectory, videoPath, ipCameraPath, webcamIndex, flirCamera, netOutputPath, multiStream);
 
             if (type == ProducerType::ImageDirectory)
                 return std::make_pair(ProducerType::ImageDirectory, imageDirectory);
@@ -217,6 +228,10 @@ namespace op
                 return std::make_pair(ProducerType::Video, videoPath);
             else if (type == ProducerType::IPCamera)
                 return std::make_pair(ProducerType::IPCamera, ipCameraPath);
+            else if (type == ProducerType::NetOutput)
+                return std::make_pair(ProducerType::NetOutput, netOutputPath);
+            else if (type == ProducerType::MultiStream)
+                return std::make_pair(ProducerType::MultiStream, multiStream);
             // Flir camera
             else if (type == ProducerType::FlirCamera)
                 return std::make_pair(ProducerType::FlirCamera, String(std::to_string(flirCameraIndex)));
@@ -340,4 +355,29 @@ namespace op
             return Point<int>{};
         }
     }
+
+    std::vector<int> flagsToNetResolutionBuckets(const String& bucketsString)
+    {
+        try
+        {
+            std::vector<int> buckets;
+            std::stringstream bucketsStream{bucketsString.getStdString()};
+            std::string bucketString;
+            while (std::getline(bucketsStream, bucketString, ','))
+            {
+                int bucket;
+                char extraCharacter;
+                if (sscanf(bucketString.c_str(), "%d %c", &bucket, &extraCharacter) != 1 || bucket <= 0)
+                    error("Invalid net resolution bucket: `" + bucketString + "`, it should be a comma-separated"
+                          " list of positive sizes, e.g., `368,496,656`.", __LINE__, __FUNCTION__, __FILE__);
+                buckets.emplace_back(bucket);
+            }
+            return buckets;
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return {};
+        }
+    }
 }
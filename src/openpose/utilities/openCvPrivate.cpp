@@ -51,4 +51,34 @@ namespace op
             error(e.what(), __LINE__, __FUNCTION__, __FILE__);
         }
     }
+
+    void hconcatViews(cv::Mat& concatenatedCvMat, const std::vector<cv::Mat>& cvMats)
+    {
+        try
+        {
+            if (cvMats.empty())
+                concatenatedCvMat = cv::Mat();
+            else
+            {
+                const auto rows = cvMats[0].rows;
+                std::vector<cv::Mat> resizedCvMats(cvMats.size());
+                for (auto i = 0u ; i < cvMats.size() ; i++)
+                {
+                    if (cvMats[i].rows == rows || cvMats[i].rows == 0)
+                        resizedCvMats[i] = cvMats[i];
+                    else
+                    {
+                        const auto cols = fastMax(1, positiveIntRound(cvMats[i].cols * rows / (double)cvMats[i].rows));
+                        cv::resize(cvMats[i], resizedCvMats[i], cv::Size{cols, rows}, 0, 0,
+                                   (cvMats[i].rows < rows ? cv::INTER_CUBIC : cv::INTER_AREA));
+                    }
+                }
+                cv::hconcat(resizedCvMats.data(), resizedCvMats.size(), concatenatedCvMat);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+        }
+    }
 }
@@ -54,6 +54,20 @@ namespace op
         }
     }
 
+    unsigned long long getSteadyTimeNanoseconds()
+    {
+        try
+        {
+            return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+        catch (const std::exception& e)
+        {
+            error(e.what(), __LINE__, __FUNCTION__, __FILE__);
+            return 0ull;
+        }
+    }
+
     #ifdef PROFILER_ENABLED
 
         std::map<std::string, std::tuple<double, unsigned long long, std::chrono::high_resolution_clock::time_point>> sProfilerTuple{
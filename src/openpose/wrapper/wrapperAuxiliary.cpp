@@ -19,6 +19,7 @@ namespace op
             // Disable netInputSizeDynamicBehavior if not images and not custom input
             // (i.e., fixed resolution stream like webcam or video)
             if (wrapperStructInput.producerType != ProducerType::ImageDirectory
+                && wrapperStructInput.producerType != ProducerType::NetOutput
                 && wrapperStructInput.producerType != ProducerType::None)
             {
                 wrapperStructPose.netInputSizeDynamicBehavior = -1.f;
@@ -32,6 +33,32 @@ namespace op
             if (wrapperStructPose.scaleGap <= 0.f && wrapperStructPose.scalesNumber > 1)
                 error("The scale gap must be greater than 0 (it has no effect if the number of scales is 1).",
                       __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructFace.reuseFrames < 0 || wrapperStructHand.reuseFrames < 0)
+                error("The number of frames to re-use the face and hand keypoints (`--face_reuse_frames` and"
+                      " `--hand_reuse_frames`) cannot be negative.", __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructFace.detectorPeriod < 0)
+                error("The OpenCV face detector period (`--face_detector_period`) cannot be negative.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructInput.producerType == ProducerType::NetOutput
+                && (wrapperStructPose.poseMode != PoseMode::NoNetwork || wrapperStructPose.scalesNumber != 1))
+                error("Replaying recorded network outputs (`--net_output`) requires disabling the internal body"
+                      " network (`--body 2`) and a single scale (`--scale_number 1`).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (!wrapperStructOutput.writeNetOutput.empty()
+                && (wrapperStructPose.poseMode == PoseMode::Disabled || wrapperStructPose.scalesNumber != 1))
+                error("Recording the network output (`--write_net_output`) requires body keypoint detection"
+                      " (`--body 1`) and a single scale (`--scale_number 1`).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructOutput.writeVideoAsyncQueue < 0)
+                error("The asynchronous video encoding queue size (`--write_video_async_queue`) cannot be negative.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructOutput.writeImagesMemory <= 0)
+                error("The image writer memory (`--write_images_memory`) must be > 0 MB.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructOutput.writePngCompression < 0 || wrapperStructOutput.writePngCompression > 9
+                || wrapperStructOutput.writeJpgQuality < 0 || wrapperStructOutput.writeJpgQuality > 100)
+                error("The PNG compression (`--write_png_compression`) must be in the range [0, 9] and the JPG"
+                      " quality (`--write_jpg_quality`) in the range [0, 100].", __LINE__, __FUNCTION__, __FILE__);
             if (!renderOutput && (!wrapperStructOutput.writeImages.empty()
                 || !wrapperStructOutput.writeVideo.empty()))
             {
@@ -67,10 +94,15 @@ namespace op
                     !wrapperStructOutput.writeImages.empty() || !wrapperStructOutput.writeVideo.empty()
                         || !wrapperStructOutput.writeKeypoint.empty() || !wrapperStructOutput.writeJson.empty()
                         || !wrapperStructOutput.writeCocoJson.empty() || !wrapperStructOutput.writeHeatMaps.empty()
+                        || !wrapperStructOutput.writeNetOutput.empty()
                 );
                 const auto savingCvOutput = (
                     !wrapperStructOutput.writeImages.empty() || !wrapperStructOutput.writeVideo.empty()
+                        || (!wrapperStructOutput.writeSharedMemory.empty()
+                            && wrapperStructOutput.writeSharedMemoryImage)
                 );
+                // Streaming results to other processes (not saved, so compatible with frames repetition)
+                const auto publishingSomething = !wrapperStructOutput.writeSharedMemory.empty();
                 const bool guiEnabled = (wrapperStructGui.displayMode != DisplayMode::NoDisplay);
                 if (!guiEnabled && !savingCvOutput && renderOutput)
                 {
@@ -79,7 +111,7 @@ namespace op
                                          + additionalMessage;
                     error(message, __LINE__, __FUNCTION__, __FILE__);
                 }
-                if (!guiEnabled && !savingSomething)
+                if (!guiEnabled && !savingSomething && !publishingSomething)
                 {
                     const auto message = "No output is selected (`--display 0`) and no results are generated (no"
                                          " `--write_X` flags enabled). Thus, no output would be generated."
@@ -144,6 +176,132 @@ namespace op
                 error("Set `--number_people_max 1` when using `--3d`. The 3-D reconstruction demo assumes there is"
                       " at most 1 person on each image.", __LINE__, __FUNCTION__, __FILE__);
             }
+            // ROI mosaic requires the body network
+            if (wrapperStructExtra.roiMosaic < 0)
+                error("The full-frame period of `--roi_mosaic` cannot be negative.", __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructExtra.roiMosaic > 0 && wrapperStructPose.poseMode != PoseMode::Enabled)
+                error("`--roi_mosaic` requires the body keypoint detector to be enabled (`--body 1`).",
+                      __LINE__, __FUNCTION__, __FILE__);
+            // Only the keypoints are mapped back from the mosaic into the frame coordinates
+            if (wrapperStructExtra.roiMosaic > 0
+                && (!wrapperStructPose.heatMapTypes.empty() || wrapperStructPose.addPartCandidates
+                    || wrapperStructPose.defaultPartToRender != 0))
+                error("`--roi_mosaic` is not compatible with `--heatmaps_add_X`, `--part_candidates`, nor"
+                      " `--part_to_show` (the heat maps and part candidates of the mosaic frames are not in the frame"
+                      " coordinates).", __LINE__, __FUNCTION__, __FILE__);
+            // The mosaic changes the net input size each frame, only the Caffe CUDA version can reshape it
+            #if defined USE_MKL || defined USE_OPENCL
+                if (wrapperStructExtra.roiMosaic > 0)
+                    error("`--roi_mosaic` is not supported in MKL (MKL CPU Caffe) and OpenCL Caffe versions, given"
+                          " that the network cannot be reshaped.", __LINE__, __FUNCTION__, __FILE__);
+            #endif
+            // Temporal connection requires consecutive frames in a fixed coordinate system
+            if (wrapperStructPose.temporalConnection)
+            {
+                if (wrapperStructExtra.roiMosaic > 0)
+                    error("`--temporal_connection` is not compatible with `--roi_mosaic`.",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (wrapperStructInput.producerType == ProducerType::ImageDirectory)
+                {
+                    opLog("`--temporal_connection` has no effect on independent images (`--image_dir`), so it"
+                          " will be disabled.", Priority::High);
+                    wrapperStructPose.temporalConnection = false;
+                }
+                else if (getGpuMode() != GpuMode::NoGpu)
+                    opLog("`--temporal_connection` only speeds up the CPU version, the CUDA and OpenCL versions"
+                          " already compute all the PAF scores in parallel.", Priority::High);
+            }
+            // Shape bucketing only applies to the -1 dimension of the net resolution
+            if (!wrapperStructPose.netInputSizeBuckets.empty()
+                && wrapperStructPose.netInputSize.x > 0 && wrapperStructPose.netInputSize.y > 0)
+            {
+                opLog("`--net_resolution_buckets` has no effect if no dimension of `--net_resolution` is -1, so it"
+                      " will be disabled.", Priority::High);
+                wrapperStructPose.netInputSizeBuckets.clear();
+            }
+            // OpenCV DNN network (no Caffe)
+            #if !defined USE_CAFFE && defined USE_OPEN_CV_DNN
+                if (!wrapperStructPose.openCvDnn && wrapperStructPose.poseMode != PoseMode::Disabled)
+                {
+                    opLog("OpenPose was compiled without Caffe, so the OpenCV DNN module will be used for the body"
+                          " network (`--opencv_dnn`).", Priority::High);
+                    wrapperStructPose.openCvDnn = true;
+                }
+            #endif
+            if (wrapperStructPose.openCvDnn)
+            {
+                #ifndef USE_OPEN_CV_DNN
+                    error("`--opencv_dnn` requires OpenPose to be compiled with the OpenCV DNN module (CMake"
+                          " `DL_FRAMEWORK` set to `OPEN_CV_DNN`, or `WITH_OPEN_CV_DNN` enabled).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                #endif
+                if (wrapperStructPose.openCvDnnBackend >= OpenCvDnnBackend::Size
+                    || wrapperStructPose.openCvDnnTarget >= OpenCvDnnTarget::Size
+                    || wrapperStructPose.openCvDnnPrecision >= OpenCvDnnPrecision::Size)
+                    error("Unknown value for `--opencv_dnn_backend`, `--opencv_dnn_target`, or"
+                          " `--opencv_dnn_precision`.", __LINE__, __FUNCTION__, __FILE__);
+                // Its results are only in CPU memory (no GPU rendering nor GPU face/hand detection)
+                if (getGpuMode() == GpuMode::Cuda)
+                    error("`--opencv_dnn` is not compatible with the CUDA version of OpenPose, which already runs"
+                          " the body network on the GPU.", __LINE__, __FUNCTION__, __FILE__);
+            }
+            // Latency target (backpressure)
+            if (wrapperStructPose.latencyTargetMs > 0.)
+            {
+                if (wrapperStructPose.latencyPolicy >= LatencyPolicy::Size)
+                    error("Unknown value for `--latency_policy`.", __LINE__, __FUNCTION__, __FILE__);
+                if (wrapperStructPose.latencyPolicy == LatencyPolicy::SkipFaceHand
+                    && !wrapperStructFace.enable && !wrapperStructHand.enable)
+                    opLog("`--latency_policy 1` only skips the face and hand keypoint detection, but both are"
+                          " disabled, so `--latency_target` has no effect.", Priority::High);
+                if (wrapperStructInput.producerType != ProducerType::Webcam
+                    && wrapperStructInput.producerType != ProducerType::FlirCamera
+                    && wrapperStructInput.producerType != ProducerType::IPCamera
+                    && wrapperStructInput.producerType != ProducerType::None)
+                    opLog("`--latency_target` is meant for live inputs (e.g., webcam). For videos or images, it will"
+                          " skip frames whenever OpenPose is slower than the latency target.", Priority::High);
+            }
+            // Multiple streams
+            if (wrapperStructInput.multiStreamBatch < 1)
+                error("The number of streams per batch (`--multi_stream_batch`) must be >= 1.",
+                      __LINE__, __FUNCTION__, __FILE__);
+            if (wrapperStructInput.producerType == ProducerType::MultiStream)
+            {
+                if (wrapperStructExtra.reconstruct3d)
+                    error("`--3d` requires calibrated views of the same scene, so it is not compatible with"
+                          " independent streams (`--multi_stream`).", __LINE__, __FUNCTION__, __FILE__);
+                // The state kept across frames by each extractor thread would mix different streams
+                if (wrapperStructExtra.tracking > -1 || wrapperStructExtra.identification
+                    || wrapperStructExtra.roiMosaic > 0)
+                    error("`--tracking`, `--identification`, and `--roi_mosaic` keep state across consecutive frames,"
+                          " so they are not compatible with independent streams (`--multi_stream`).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (wrapperStructPose.netInputSizeAdaptive > 0.f)
+                    error("`--net_resolution_adaptive` adapts the net resolution to the previous frames, so it is not"
+                          " compatible with independent streams (`--multi_stream`).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if ((wrapperStructFace.enable && wrapperStructFace.reuseFrames > 0)
+                    || (wrapperStructHand.enable && wrapperStructHand.reuseFrames > 0))
+                    error("`--face_reuse_frames` and `--hand_reuse_frames` re-use the keypoints of previous frames,"
+                          " so they are not compatible with independent streams (`--multi_stream`).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if ((wrapperStructFace.enable && wrapperStructFace.detector == Detector::OpenCV
+                        && wrapperStructFace.detectorPeriod > 0)
+                    || (wrapperStructHand.enable && wrapperStructHand.detector == Detector::BodyWithTracking))
+                    error("The tracked-region OpenCV face detector (`--face_detector_period`) and the hand tracking"
+                          " detector (`--hand_detector 3`) look for faces and hands where they were in previous"
+                          " frames, so they are not compatible with independent streams (`--multi_stream`).",
+                          __LINE__, __FUNCTION__, __FILE__);
+                if (wrapperStructPose.temporalConnection)
+                {
+                    opLog("`--temporal_connection` is not compatible with `--multi_stream` (consecutive frames of"
+                          " each extractor thread belong to different streams), so it will be disabled.",
+                          Priority::High);
+                    wrapperStructPose.temporalConnection = false;
+                }
+            }
+            else if (wrapperStructInput.multiStreamBatch > 1)
+                opLog("`--multi_stream_batch` only has effect with `--multi_stream`.", Priority::High);
             // If CPU mode, #GPU cannot be > 0
             if (getGpuMode() == GpuMode::NoGpu)
                 if (wrapperStructPose.gpuNumber > 0)
@@ -4,12 +4,13 @@ namespace op
 {
     WrapperStructExtra::WrapperStructExtra(
         const bool reconstruct3d_, const int minViews3d_, const bool identification_, const int tracking_,
-        const int ikThreads_) :
+        const int ikThreads_, const int roiMosaic_) :
         reconstruct3d{reconstruct3d_},
         minViews3d{minViews3d_},
         identification{identification_},
         tracking{tracking_},
-        ikThreads{ikThreads_}
+        ikThreads{ikThreads_},
+        roiMosaic{roiMosaic_}
     {
     }
 }
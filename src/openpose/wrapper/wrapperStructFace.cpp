@@ -4,14 +4,17 @@ namespace op
 {
     WrapperStructFace::WrapperStructFace(
         const bool enable_, const Detector detector_, const Point<int>& netInputSize_, const RenderMode renderMode_,
-        const float alphaKeypoint_, const float alphaHeatMap_, const float renderThreshold_) :
+        const float alphaKeypoint_, const float alphaHeatMap_, const float renderThreshold_,
+        const int reuseFrames_, const int detectorPeriod_) :
         enable{enable_},
         detector{detector_},
         netInputSize{netInputSize_},
         renderMode{renderMode_},
         alphaKeypoint{alphaKeypoint_},
         alphaHeatMap{alphaHeatMap_},
-        renderThreshold{renderThreshold_}
+        renderThreshold{renderThreshold_},
+        reuseFrames{reuseFrames_},
+        detectorPeriod{detectorPeriod_}
     {
     }
 }
@@ -5,7 +5,8 @@ namespace op
     WrapperStructHand::WrapperStructHand(
         const bool enable_, const Detector detector_, const Point<int>& netInputSize_, const int scalesNumber_,
         const float scaleRange_, const RenderMode renderMode_, const float alphaKeypoint_, const float alphaHeatMap_,
-        const float renderThreshold_) :
+        const float renderThreshold_,
+        const int reuseFrames_) :
         enable{enable_},
         detector{detector_},
         netInputSize{netInputSize_},
@@ -14,7 +15,8 @@ namespace op
         renderMode{renderMode_},
         alphaKeypoint{alphaKeypoint_},
         alphaHeatMap{alphaHeatMap_},
-        renderThreshold{renderThreshold_}
+        renderThreshold{renderThreshold_},
+        reuseFrames{reuseFrames_}
     {
     }
 }
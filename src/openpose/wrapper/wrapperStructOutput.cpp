@@ -9,7 +9,10 @@ namespace op
         const String& writeVideo_, const double writeVideoFps_, const bool writeVideoWithAudio_,
         const String& writeHeatMaps_, const String& writeHeatMapsFormat_, const String& writeVideo3D_,
         const String& writeVideoAdam_, const String& writeBvh_, const String& udpHost_,
-        const String& udpPort_) :
+        const String& udpPort_, const String& writeSharedMemory_, const bool writeSharedMemoryImage_,
+        const String& writeNetOutput_, const int writeVideoAsyncQueue_, const bool writeVideoAsyncDrop_,
+        const int writeImagesThreads_, const int writeImagesMemory_, const int writePngCompression_,
+        const int writeJpgQuality_) :
         verbose{verbose_},
         writeKeypoint{writeKeypoint_},
         writeKeypointFormat{writeKeypointFormat_},
@@ -28,7 +31,16 @@ namespace op
         writeVideoAdam{writeVideoAdam_},
         writeBvh{writeBvh_},
         udpHost{udpHost_},
-        udpPort{udpPort_}
+        udpPort{udpPort_},
+        writeSharedMemory{writeSharedMemory_},
+        writeSharedMemoryImage{writeSharedMemoryImage_},
+        writeNetOutput{writeNetOutput_},
+        writeVideoAsyncQueue{writeVideoAsyncQueue_},
+        writeVideoAsyncDrop{writeVideoAsyncDrop_},
+        writeImagesThreads{writeImagesThreads_},
+        writeImagesMemory{writeImagesMemory_},
+        writePngCompression{writePngCompression_},
+        writeJpgQuality{writeJpgQuality_}
     {
         try
         {
@@ -11,7 +11,13 @@ namespace op
         const std::vector<HeatMapType>& heatMapTypes_, const ScaleMode heatMapScaleMode_,
         const bool addPartCandidates_, const float renderThreshold_, const int numberPeopleMax_,
         const bool maximizePositives_, const double fpsMax_, const String& protoTxtPath_,
-        const String& caffeModelPath_, const float upsamplingRatio_, const bool enableGoogleLogging_) :
+        const String& caffeModelPath_, const float upsamplingRatio_, const bool enableGoogleLogging_,
+        const float netInputSizeAdaptive_, const bool temporalConnection_,
+        const std::vector<int>& netInputSizeBuckets_, const bool openCvDnn_,
+        const OpenCvDnnBackend openCvDnnBackend_, const OpenCvDnnTarget openCvDnnTarget_,
+        const OpenCvDnnPrecision openCvDnnPrecision_, const int openCvDnnThreads_,
+        const String& modelCacheFolder_, const double latencyTargetMs_, const LatencyPolicy latencyPolicy_,
+        const double stageFusionMs_) :
         poseMode{poseMode_},
         netInputSize{netInputSize_},
         netInputSizeDynamicBehavior{netInputSizeDynamicBehavior_},
@@ -38,7 +44,19 @@ namespace op
         protoTxtPath{protoTxtPath_},
         caffeModelPath{caffeModelPath_},
         upsamplingRatio{upsamplingRatio_},
-        enableGoogleLogging{enableGoogleLogging_}
+        enableGoogleLogging{enableGoogleLogging_},
+        netInputSizeAdaptive{netInputSizeAdaptive_},
+        temporalConnection{temporalConnection_},
+        netInputSizeBuckets{netInputSizeBuckets_},
+        openCvDnn{openCvDnn_},
+        openCvDnnBackend{openCvDnnBackend_},
+        openCvDnnTarget{openCvDnnTarget_},
+        openCvDnnPrecision{openCvDnnPrecision_},
+        openCvDnnThreads{openCvDnnThreads_},
+        modelCacheFolder{modelCacheFolder_},
+        latencyTargetMs{latencyTargetMs_},
+        latencyPolicy{latencyPolicy_},
+        stageFusionMs{stageFusionMs_}
     {
     }
 }